@@ -0,0 +1,88 @@
+# This benchmark measures the number of serial port calls (queries and reads) made by the TransportLayer class for each
+# received packet and the per-packet reception time while the emulated microcontroller continuously streams packets,
+# writing them to the serial port in bursts of different sizes. The reader thread repeatedly calls receive_data() with
+# a long timeout until it receives all packets.
+#
+# Each read requests twice as many bytes as arrived with the previous read, and the reads that return all requested
+# bytes are followed by direct reads that skip the port query. Since the packets accumulate in the serial port while
+# the reader processes the previous packets, each read collects many packets, so the number of port calls per packet
+# falls well below 1. The count includes the port queries made while waiting for the next packet, so the result
+# depends on how fast the sender writes the packets. This benchmark only works on Linux and macOS.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+import os
+import time
+from threading import Thread
+
+import numpy as np
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import TransportLayer
+
+# The benchmarked numbers of packets in each burst.
+BURST_SIZES = (1, 8, 64, 256)
+# The size of each payload, in bytes.
+PAYLOAD_SIZE = 32
+# The number of packets received during each benchmark stage.
+PACKET_COUNT = 8192
+
+
+def build_packet() -> bytes:
+    """Returns the byte-stream of a single serialized packet."""
+    generator = TransportLayer(port="MOCK", microcontroller_serial_buffer_size=256, baudrate=115200, test_mode=True)
+    generator.write_data(np.arange(PAYLOAD_SIZE, dtype=np.uint8))
+    generator.send_data()
+
+    # noinspection PyProtectedMember
+    return generator._port.tx_buffer
+
+
+def send(descriptor: int, burst: bytes, burst_count: int) -> None:
+    """Writes the bursts of packets to the controller end of the pseudo-terminal without pausing between the bursts."""
+    for _ in range(burst_count):
+        os.write(descriptor, burst)
+
+
+def main() -> None:
+    """Runs the benchmark stage for each burst size and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    packet = build_packet()
+    console.echo(f"Serial port calls made to receive {PAYLOAD_SIZE}-byte payloads streamed in bursts:")
+    console.echo(f"{'Burst':<8}{'Calls / packet':>16}{'Time / packet, us':>20}")
+    for burst_size in BURST_SIZES:
+        # Opens the pseudo-terminal pair. The TransportLayer connects to the 'device' end, and the sender thread
+        # emulates the microcontroller using the 'controller' end.
+        controller, device = os.openpty()
+        transport_layer = TransportLayer(
+            port=os.ttyname(device), microcontroller_serial_buffer_size=256, baudrate=115200
+        )
+
+        # Compiles all JIT methods before measuring the performance. The warm-up packet is excluded from the statistics.
+        os.write(controller, packet)
+        transport_layer.receive_data(timeout=1_000_000)
+        calls_before = transport_layer.reception_port_calls
+
+        sender = Thread(target=send, args=(controller, packet * burst_size, PACKET_COUNT // burst_size))
+        start = time.perf_counter()
+        sender.start()
+        for _ in range(PACKET_COUNT):
+            while not transport_layer.receive_data(timeout=1_000_000):
+                pass
+        elapsed = (time.perf_counter() - start) * 1_000_000
+        sender.join()
+
+        calls_per_packet = (transport_layer.reception_port_calls - calls_before) / PACKET_COUNT
+        console.echo(f"{burst_size:<8}{calls_per_packet:>16.3f}{elapsed / PACKET_COUNT:>20.2f}")
+
+        os.close(controller)
+        os.close(device)
+
+    console.echo("Adaptive read benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
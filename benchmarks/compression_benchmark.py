@@ -0,0 +1,98 @@
+# This benchmark evaluates the payload compression mode of the TransportLayer class for several typical payload types.
+# For each payload type, it sends the same payload with compression disabled and enabled through a mocked serial
+# connection and compares the sizes of the resulting packets. Based on the packet sizes, it reports the effective
+# payload throughput of a link that transfers 10 bits per byte (8N1 UART framing) at the benchmarked baudrate. It also
+# reports the time the host spends compressing and decompressing each payload.
+#
+# Compression only helps on bandwidth-bound links, where the time saved by sending fewer bytes exceeds the time spent
+# compressing the payload. Incompressible payloads are sent uncompressed, so they only lose the 1-byte compression
+# header. See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+import numpy as np
+from numpy.typing import NDArray
+from ataraxis_time import PrecisionTimer, TimerPrecisions
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import LZProcessor, TransportLayer
+
+# The benchmarked baudrate. The link transfers 1 byte per 10 bits.
+BAUDRATE = 115200
+# The size of each payload, in bytes.
+PAYLOAD_SIZE = 240
+# The number of compression and decompression cycles used to measure the host processing time.
+CYCLE_COUNT = 2000
+
+
+def build_payloads() -> dict[str, NDArray[np.uint8]]:
+    """Returns the benchmarked payloads, each serialized to a PAYLOAD_SIZE-byte array."""
+    generator = np.random.default_rng(seed=42)
+
+    # An event array where ~5% of the entries store an event code.
+    events = np.zeros(PAYLOAD_SIZE, dtype=np.uint8)
+    indices = generator.choice(PAYLOAD_SIZE, size=PAYLOAD_SIZE // 20, replace=False)
+    events[indices] = generator.integers(1, 256, size=indices.size, dtype=np.uint8)
+
+    # A configuration table that repeats the same 4 uint32 parameters for each of the 15 channels.
+    table = np.tile(np.array([1000, 250, 0, 5], dtype=np.uint32), PAYLOAD_SIZE // 16)
+
+    # A slowly changing uint32 encoder count stream.
+    counts = np.cumsum(generator.integers(-20, 21, size=PAYLOAD_SIZE // 4)).astype(np.uint32) + np.uint32(100_000)
+
+    return {
+        "sparse events": events,
+        "configuration table": table.view(np.uint8),
+        "encoder counts": counts.view(np.uint8),
+        "random": generator.integers(0, 256, size=PAYLOAD_SIZE, dtype=np.uint8),
+    }
+
+
+def packet_size(payload: NDArray[np.uint8], *, compression: bool) -> int:
+    """Returns the size of the packet used to send the payload, in bytes."""
+    transport_layer = TransportLayer(
+        port="MOCK", microcontroller_serial_buffer_size=256, baudrate=BAUDRATE, test_mode=True, compression=compression
+    )
+    transport_layer.write_data(payload)
+    transport_layer.send_data()
+
+    # noinspection PyProtectedMember
+    return len(transport_layer._port.tx_buffer)
+
+
+def processing_time(processor: LZProcessor, payload: NDArray[np.uint8]) -> float:
+    """Returns the time, in microseconds, the host spends compressing and decompressing the payload."""
+    # Compiles the compression methods before measuring the performance.
+    processor.decompress(processor.compress(payload))
+
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    for _ in range(CYCLE_COUNT):
+        processor.processor.decompress(processor.processor.compress(payload))
+    return timer.elapsed / CYCLE_COUNT
+
+
+def main() -> None:
+    """Runs the benchmark for each payload type and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    processor = LZProcessor()
+    link_rate = BAUDRATE / 10  # Bytes per second
+
+    console.echo(f"Effective payload throughput at {BAUDRATE} baud ({PAYLOAD_SIZE}-byte payloads):")
+    console.echo(f"{'Payload':<22}{'Raw, B':>8}{'LZ, B':>8}{'Raw, KB/s':>11}{'LZ, KB/s':>10}{'Gain':>7}{'CPU, us':>9}")
+    for name, payload in build_payloads().items():
+        raw_size = packet_size(payload, compression=False)
+        compressed_size = packet_size(payload, compression=True)
+        raw_rate = link_rate * PAYLOAD_SIZE / raw_size / 1000
+        compressed_rate = link_rate * PAYLOAD_SIZE / compressed_size / 1000
+        console.echo(
+            f"{name:<22}{raw_size:>8}{compressed_size:>8}{raw_rate:>11.2f}{compressed_rate:>10.2f}"
+            f"{compressed_rate / raw_rate:>6.2f}x{processing_time(processor, payload):>9.1f}"
+        )
+
+    console.echo("Compression benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
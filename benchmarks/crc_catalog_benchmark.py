@@ -0,0 +1,80 @@
+# This benchmark measures how long it takes to set up the CRC processors for a host that communicates with many
+# microcontrollers. For each CRC width, it creates one CRC processor per port in three ways: by compiling a new
+# jitclass for each processor (how the processors were created before the jitclasses were shared), by initializing
+# the CRCProcessor class directly (which reuses the jitclass compiled for the CRC width), and by requesting the
+# shared (interned) processor of a preset. It also reports the time it takes to initialize a mocked TransportLayer
+# instance for each port.
+#
+# The shared processors are created once per process and reused by all later requests, so after the first port, the
+# setup cost drops to a dictionary lookup. See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more
+# details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+from numba import uint8, uint16, uint32  # type: ignore[import-untyped]
+from ataraxis_time import PrecisionTimer, TimerPrecisions
+from numba.experimental import jitclass  # type: ignore[import-untyped]
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import CRCPreset, CRCProcessor, TransportLayer
+from ataraxis_transport_layer_pc.helper_modules import _CRC_PRESETS, _CRCProcessor
+
+# The benchmarked presets, one for each CRC width.
+PRESETS = (CRCPreset.CRC_8_SMBUS, CRCPreset.CRC_16_IBM_3740, CRCPreset.CRC_32_MPEG_2)
+# The number of ports (CRC processors) set up by the host.
+PORT_COUNT = 30
+
+
+def per_instance_jitclass(preset: CRCPreset) -> None:
+    """Creates a CRC processor for the preset by compiling a new _CRCProcessor jitclass."""
+    polynomial, initial_crc_value, final_xor_value = _CRC_PRESETS[preset]
+    crc_type = {1: uint8, 2: uint16, 4: uint32}[polynomial.dtype.itemsize]
+    spec = [
+        ("polynomial", crc_type),
+        ("initial_crc_value", crc_type),
+        ("final_xor_value", crc_type),
+        ("crc_byte_length", uint8),
+        ("crc_table", crc_type[:]),
+    ]
+    jitclass(cls_or_spec=_CRCProcessor, spec=spec)(polynomial, initial_crc_value, final_xor_value)
+
+
+def direct(preset: CRCPreset) -> None:
+    """Creates a CRC processor for the preset by initializing the CRCProcessor class."""
+    CRCProcessor(*_CRC_PRESETS[preset])
+
+
+def shared(preset: CRCPreset) -> None:
+    """Requests the shared CRC processor of the preset."""
+    CRCProcessor.from_preset(preset)
+
+
+def transport_layer(preset: CRCPreset) -> None:
+    """Initializes a mocked TransportLayer instance that uses the preset."""
+    TransportLayer(
+        port="MOCK", microcontroller_serial_buffer_size=256, baudrate=1000000, test_mode=True, crc_preset=preset
+    )
+
+
+def main() -> None:
+    """Runs the benchmark for each CRC width and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    console.echo(f"Time to set up the CRC processors for {PORT_COUNT} ports (milliseconds):")
+    console.echo(f"{'Preset':<18}{'Per-instance jitclass':>23}{'Direct':>10}{'Shared':>10}{'TransportLayer':>16}")
+    for preset in PRESETS:
+        results = []
+        for function in (per_instance_jitclass, direct, shared, transport_layer):
+            timer.reset()
+            for _ in range(PORT_COUNT):
+                function(preset)
+            results.append(timer.elapsed / 1000)
+        console.echo(f"{preset:<18}{results[0]:>23.1f}{results[1]:>10.1f}{results[2]:>10.1f}{results[3]:>16.1f}")
+
+    console.echo("CRC catalog benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
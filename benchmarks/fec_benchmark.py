@@ -0,0 +1,118 @@
+# This benchmark evaluates the forward error correction (FEC) mode of the TransportLayer class. First, it measures the
+# throughput of the Reed-Solomon decoder for intact codewords and for codewords with the maximum correctable number of
+# corrupted bytes. Then, it sends packets through a mocked serial connection that corrupts each byte with the
+# requested probability and reports the share of packets lost at each error rate and parity size.
+#
+# Without FEC, any corrupted byte causes the packet to be lost. With FEC, the packet is only lost if the number of
+# corrupted bytes exceeds half of the parity bytes, or if the corruption affects the unprotected preamble (start byte
+# and payload size). The printed tables can be used to select the parity size that matches the noise level of the link.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+import numpy as np
+from ataraxis_time import PrecisionTimer, TimerPrecisions
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import TransportLayer, ReedSolomonProcessor
+
+# The benchmarked numbers of parity bytes. 0 disables forward error correction.
+PARITY_SIZES = (0, 4, 8, 16)
+# The benchmarked probabilities of each transmitted byte being corrupted.
+ERROR_RATES = (0.001, 0.005, 0.01, 0.02, 0.05)
+# The size of each transmitted payload, in bytes.
+PAYLOAD_SIZE = 64
+# The number of codewords decoded during each throughput benchmark stage.
+CODEWORD_COUNT = 20000
+# The number of packets sent during each loss benchmark stage.
+PACKET_COUNT = 1000
+
+
+def measure_decode_throughput(parity_size: int, generator: np.random.Generator) -> tuple[float, float]:
+    """Returns the number of intact and corrupted codewords decoded per second by the Reed-Solomon decoder."""
+    processor = ReedSolomonProcessor(parity_size=parity_size).processor
+    data = generator.integers(0, 256, size=PAYLOAD_SIZE + 3, dtype=np.uint8)
+    codeword = np.concatenate((data, processor.encode(data)))
+    corrupted = codeword.copy()
+    corrupted[generator.choice(codeword.size, size=parity_size // 2, replace=False)] ^= np.uint8(0xA5)
+
+    rates = []
+    for source in (codeword, corrupted):
+        # Compiles the decoder before measuring the throughput.
+        processor.decode(source.copy())
+        buffers = [source.copy() for _ in range(CODEWORD_COUNT)]
+        timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+        for buffer in buffers:
+            processor.decode(buffer)
+        rates.append(CODEWORD_COUNT / (timer.elapsed / 1_000_000))
+
+    return rates[0], rates[1]
+
+
+def measure_packet_loss(parity_size: int, error_rate: float, generator: np.random.Generator) -> float:
+    """Returns the share of packets lost, in percent, when each transmitted byte is corrupted with the input
+    probability.
+    """
+    sender, receiver = (
+        TransportLayer(
+            port="MOCK",
+            microcontroller_serial_buffer_size=256,
+            baudrate=115200,
+            test_mode=True,
+            fec_parity_size=parity_size,
+        )
+        for _ in range(2)
+    )
+    payload = np.arange(PAYLOAD_SIZE, dtype=np.uint8)
+    prototype = np.zeros(PAYLOAD_SIZE, dtype=np.uint8)
+    sender.write_data(payload)
+    sender.send_data()
+
+    # noinspection PyProtectedMember
+    packet = np.frombuffer(sender._port.tx_buffer, dtype=np.uint8)
+
+    lost = 0
+    for _ in range(PACKET_COUNT):
+        corrupted = packet.copy()
+        mask = generator.random(packet.size) < error_rate
+        corrupted[mask] ^= generator.integers(1, 256, size=int(mask.sum()), dtype=np.uint8)
+
+        # Delivers each packet separately and discards any leftover bytes, so that a lost packet does not affect the
+        # reception of the following packets.
+        # noinspection PyProtectedMember
+        receiver._port.rx_buffer = corrupted.tobytes()
+        try:
+            if not receiver.receive_data() or not np.array_equal(receiver.read_data(prototype), payload):
+                lost += 1
+        except (RuntimeError, ValueError):
+            lost += 1
+        # noinspection PyProtectedMember
+        receiver._rx.stream_size = 0
+
+    return lost / PACKET_COUNT * 100
+
+
+def main() -> None:
+    """Runs the decoder throughput and packet loss benchmarks and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    generator = np.random.default_rng(seed=42)
+
+    console.echo(f"Decoder throughput ({PAYLOAD_SIZE}-byte payloads), codewords / s:")
+    console.echo(f"{'Parity bytes':<14}{'Intact':>12}{'Corrected':>12}")
+    for parity_size in PARITY_SIZES[1:]:
+        intact, corrected = measure_decode_throughput(parity_size, generator)
+        console.echo(f"{parity_size:<14}{intact:>12.0f}{corrected:>12.0f}")
+
+    console.echo(f"Packet loss ({PAYLOAD_SIZE}-byte payloads), %:")
+    console.echo(f"{'Parity bytes':<14}" + "".join(f"{f'BER {rate}':>12}" for rate in ERROR_RATES))
+    for parity_size in PARITY_SIZES:
+        losses = [measure_packet_loss(parity_size, rate, generator) for rate in ERROR_RATES]
+        console.echo(f"{parity_size:<14}" + "".join(f"{loss:>12.1f}" for loss in losses))
+
+    console.echo("Forward error correction benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
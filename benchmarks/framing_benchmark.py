@@ -0,0 +1,92 @@
+# This benchmark compares the framing codecs supported by the TransportLayer class. For each codec and payload type, it
+# measures the time it takes to encode and decode the payload and reports the wire overhead, which is the number of
+# bytes the codec adds to the payload.
+#
+# COBS always adds exactly 2 bytes. COBS/R adds 1 or 2 bytes, depending on the last payload byte. SLIP and HDLC add 1
+# byte plus 1 byte for each payload byte that has to be escaped, so their overhead depends on how often the payload
+# contains their delimiter and escape byte-values. The printed table can be used to select the codec that best matches
+# the expected payloads, if the microcontroller supports multiple codecs.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+import numpy as np
+from numpy.typing import NDArray
+from ataraxis_time import PrecisionTimer, TimerPrecisions
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import COBSProcessor, COBSRProcessor, ByteStuffingProcessor
+
+# The benchmarked codecs.
+CODECS = {
+    "COBS": COBSProcessor(),
+    "COBS/R": COBSRProcessor(),
+    "SLIP": ByteStuffingProcessor(scheme="slip"),
+    "HDLC": ByteStuffingProcessor(scheme="hdlc"),
+}
+# The size of each payload, in bytes.
+PAYLOAD_SIZE = 200
+# The number of encoding and decoding cycles used to measure the processing time of each payload.
+CYCLE_COUNT = 20000
+
+
+def build_payloads() -> dict[str, NDArray[np.uint8]]:
+    """Returns the benchmarked payloads."""
+    generator = np.random.default_rng(seed=42)
+
+    # An event array where ~5% of the entries store an event code.
+    events = np.zeros(PAYLOAD_SIZE, dtype=np.uint8)
+    indices = generator.choice(PAYLOAD_SIZE, size=PAYLOAD_SIZE // 20, replace=False)
+    events[indices] = generator.integers(1, 256, size=indices.size, dtype=np.uint8)
+
+    # Every other byte matches the SLIP or HDLC delimiter, which is the worst case for the byte-stuffing codecs.
+    delimiters = np.tile(np.array([0xC0, 0x7E], dtype=np.uint8), PAYLOAD_SIZE // 2)
+
+    return {
+        "random": generator.integers(0, 256, size=PAYLOAD_SIZE, dtype=np.uint8),
+        "sparse events": events,
+        "ascii text": generator.integers(0x20, 0x7B, size=PAYLOAD_SIZE, dtype=np.uint8),
+        "stuffing worst case": delimiters,
+    }
+
+
+def measure(
+    processor: COBSProcessor | COBSRProcessor | ByteStuffingProcessor, payload: NDArray[np.uint8]
+) -> tuple[int, float, float]:
+    """Returns the wire overhead, in bytes, and the encoding and decoding times, in microseconds, of the payload."""
+    # Compiles and verifies the codec before measuring the performance.
+    packet = processor.encode_payload(payload)
+    if not np.array_equal(processor.decode_payload(packet), payload):
+        console.error(message="The decoded payload does not match the encoded payload.", error=RuntimeError)
+
+    jitclass = processor.processor
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    for _ in range(CYCLE_COUNT):
+        jitclass.encode_payload(payload)
+    encode_time = timer.elapsed / CYCLE_COUNT
+
+    timer.reset()
+    for _ in range(CYCLE_COUNT):
+        jitclass.decode_payload(packet)
+    decode_time = timer.elapsed / CYCLE_COUNT
+
+    return packet.size - payload.size, encode_time, decode_time
+
+
+def main() -> None:
+    """Runs the benchmark for each payload type and codec and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    console.echo(f"Framing codecs ({PAYLOAD_SIZE}-byte payloads):")
+    console.echo(f"{'Payload':<22}{'Codec':<8}{'Overhead, B':>13}{'Encode, us':>12}{'Decode, us':>12}")
+    for name, payload in build_payloads().items():
+        for codec, processor in CODECS.items():
+            overhead, encode_time, decode_time = measure(processor, payload)
+            console.echo(f"{name:<22}{codec:<8}{overhead:>13}{encode_time:>12.2f}{decode_time:>12.2f}")
+
+    console.echo("Framing benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
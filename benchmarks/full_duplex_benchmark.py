@@ -0,0 +1,152 @@
+# This benchmark measures the throughput of the TransportLayer class over a link-bound serial connection. It first
+# measures the one-way transmission (TX) and reception (RX) rates and then runs both directions at the same time from
+# two different threads. Since the TX and RX paths of the TransportLayer class are independent, the full-duplex
+# throughput should match the sum of the two one-way rates. The benchmark fails if the full-duplex throughput falls
+# below MINIMUM_EFFICIENCY of the summed one-way throughput.
+#
+# The microcontroller is emulated by the threads that service the 'controller' end of a pseudo-terminal pair. These
+# threads pace their reads and writes to match the configured baudrate, so that the emulated serial link (and not the
+# host CPU) is the bottleneck, as it would be for a real UART connection. This benchmark only works on Linux and macOS.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+import os
+from threading import Thread
+
+import numpy as np
+from ataraxis_time import PrecisionTimer, TimerPrecisions
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import TransportLayer
+
+# The emulated UART baudrate. Each byte is transmitted as 10 bits (start bit + 8 data bits + stop bit).
+BAUDRATE = 115200
+# The number of packets to send and receive during each benchmark stage.
+PACKET_COUNT = 200
+# The size of each transmitted and received payload, in bytes.
+PAYLOAD_SIZE = 64
+# The minimum fraction of the summed one-way throughput that the full-duplex stage has to reach.
+MINIMUM_EFFICIENCY = 0.95
+
+
+def build_stream(packet_count: int, payload_size: int) -> bytes:
+    """Returns the byte-stream that contains the requested number of serialized packets.
+
+    Uses a mocked TransportLayer instance to serialize the packets, so the stream matches the byte-stream the tested
+    instance exchanges with the emulated microcontroller.
+    """
+    generator = TransportLayer(port="MOCK", microcontroller_serial_buffer_size=256, baudrate=BAUDRATE, test_mode=True)
+    for index in range(packet_count):
+        generator.write_data(np.full(shape=payload_size, fill_value=index % 256, dtype=np.uint8))
+        generator.send_data()
+
+    # noinspection PyProtectedMember
+    return generator._port.tx_buffer
+
+
+def paced_write(descriptor: int, data: bytes) -> None:
+    """Writes the data to the controller end of the pseudo-terminal at the emulated link rate."""
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    bytes_per_second = BAUDRATE / 10
+    written = 0
+    while written < len(data):
+        written += os.write(descriptor, data[written : written + 64])
+
+        # Blocks until the emulated link would have finished transmitting all bytes written so far.
+        remaining = int(written / bytes_per_second * 1_000_000) - timer.elapsed
+        if remaining > 0:
+            timer.delay(delay=remaining, allow_sleep=True, block=False)
+
+
+def paced_read(descriptor: int, byte_count: int) -> None:
+    """Reads the requested number of bytes from the controller end of the pseudo-terminal at the emulated link rate."""
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    bytes_per_second = BAUDRATE / 10
+    received = 0
+    while received < byte_count:
+        received += len(os.read(descriptor, min(64, byte_count - received)))
+
+        # Blocks until the emulated link would have finished transmitting all bytes read so far.
+        remaining = int(received / bytes_per_second * 1_000_000) - timer.elapsed
+        if remaining > 0:
+            timer.delay(delay=remaining, allow_sleep=True, block=False)
+
+
+def transmit(transport_layer: TransportLayer, packet_count: int) -> None:
+    """Sends the requested number of payloads to the emulated microcontroller."""
+    for index in range(packet_count):
+        transport_layer.write_data(np.full(shape=PAYLOAD_SIZE, fill_value=index % 256, dtype=np.uint8))
+        transport_layer.send_data()
+
+
+def receive(transport_layer: TransportLayer, packet_count: int) -> None:
+    """Receives the requested number of payloads from the emulated microcontroller."""
+    prototype = np.zeros(shape=PAYLOAD_SIZE, dtype=np.uint8)
+    received = 0
+    while received < packet_count:
+        if transport_layer.receive_data():
+            transport_layer.read_data(prototype)
+            received += 1
+
+
+def run_stage(transport_layer: TransportLayer, controller: int, stream: bytes, *, tx: bool, rx: bool) -> float:
+    """Runs a single benchmark stage and returns the aggregate throughput in packets per second."""
+    threads = []
+    if tx:
+        threads.append(Thread(target=transmit, args=(transport_layer, PACKET_COUNT)))
+        threads.append(Thread(target=paced_read, args=(controller, len(stream))))
+    if rx:
+        threads.append(Thread(target=paced_write, args=(controller, stream)))
+        threads.append(Thread(target=receive, args=(transport_layer, PACKET_COUNT)))
+
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    elapsed = timer.elapsed / 1_000_000
+
+    return (PACKET_COUNT * (int(tx) + int(rx))) / elapsed
+
+
+def main() -> None:
+    """Runs the one-way and full-duplex benchmark stages and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    # Opens the pseudo-terminal pair. The TransportLayer connects to the 'device' end, and the benchmark threads
+    # emulate the microcontroller using the 'controller' end.
+    controller, device = os.openpty()
+    transport_layer = TransportLayer(port=os.ttyname(device), microcontroller_serial_buffer_size=256, baudrate=BAUDRATE)
+    stream = build_stream(packet_count=PACKET_COUNT, payload_size=PAYLOAD_SIZE)
+
+    # Runs a short cycle in both directions to compile all JIT methods before measuring the throughput.
+    run_stage(transport_layer, controller, stream, tx=True, rx=True)
+
+    tx_rate = run_stage(transport_layer, controller, stream, tx=True, rx=False)
+    rx_rate = run_stage(transport_layer, controller, stream, tx=False, rx=True)
+    duplex_rate = run_stage(transport_layer, controller, stream, tx=True, rx=True)
+
+    console.echo(f"One-way TX throughput: {tx_rate:.1f} packets / s.")
+    console.echo(f"One-way RX throughput: {rx_rate:.1f} packets / s.")
+    console.echo(f"Full-duplex throughput: {duplex_rate:.1f} packets / s.")
+
+    os.close(controller)
+    os.close(device)
+
+    # Verifies that running both directions at the same time does not slow down either of them.
+    efficiency = duplex_rate / (tx_rate + rx_rate)
+    if efficiency < MINIMUM_EFFICIENCY:
+        message = (
+            f"Full-duplex benchmark: Failed. The full-duplex throughput reached {efficiency * 100:.1f}% of the summed "
+            f"one-way throughput, which is below the required {MINIMUM_EFFICIENCY * 100:.1f}%."
+        )
+        console.error(message=message, error=RuntimeError)
+    console.echo(
+        f"Full-duplex efficiency: {efficiency * 100:.1f}% of the summed one-way throughput.", level=LogLevel.SUCCESS
+    )
+
+
+if __name__ == "__main__":
+    main()
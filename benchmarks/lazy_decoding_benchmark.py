@@ -0,0 +1,107 @@
+# This benchmark compares the time it takes to receive a packet and route it by its first payload byte with eager
+# (default) and lazy payload decoding. The routing step is modeled after applications that only process a subset of
+# the received messages (for example, filtering the messages by their protocol code) and drop the rest without reading
+# their payloads. The benchmark also reports the time it takes to receive and fully read each payload in both modes.
+# The benchmark uses a mocked serial connection, so it measures the host-side processing overhead.
+#
+# With lazy decoding, the reception only verifies the packet's CRC checksum, and the first payload byte is extracted
+# from the encoded packet during its verification. Dropped payloads are never decoded, while fully read payloads pay
+# for an additional compiled function call that decodes them.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+from collections.abc import Callable
+
+import numpy as np
+from ataraxis_time import PrecisionTimer, TimerPrecisions
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import FramingCodec, TransportLayer
+
+# The benchmarked payload sizes, in bytes.
+PAYLOAD_SIZES = (16, 64, 254)
+# The benchmarked framing codecs.
+FRAMING_CODECS = (FramingCodec.COBS, FramingCodec.SLIP)
+# The number of packets received during a single repetition.
+PACKET_COUNT = 1000
+# The number of repetitions of each measurement. The benchmark reports the fastest repetition to exclude the delays
+# caused by other processes.
+REPEAT_COUNT = 40
+
+
+def best_time(function: Callable[[], object]) -> float:
+    """Returns the fastest per-packet time of the input function across all repetitions, in microseconds."""
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    times = []
+    for _ in range(REPEAT_COUNT):
+        timer.reset()
+        function()
+        times.append(timer.elapsed / PACKET_COUNT)
+    return min(times)
+
+
+def measure(framing_codec: FramingCodec, payload_size: int, *, lazy_decoding: bool) -> tuple[float, float]:
+    """Returns the per-packet routing and full reading times for the input configuration, in microseconds."""
+    protocol = TransportLayer(
+        port="MOCK",
+        microcontroller_serial_buffer_size=1024,
+        baudrate=1000000,
+        test_mode=True,
+        framing_codec=framing_codec,
+        lazy_decoding=lazy_decoding,
+    )
+
+    # Pre-generates the serialized packets. The payloads store random data, so that the codecs have to escape some of
+    # the payload bytes.
+    payload = np.random.default_rng(seed=0).integers(0, 256, size=payload_size, dtype=np.uint8)
+    protocol.write_data(payload)
+    protocol.send_data()
+    # noinspection PyProtectedMember
+    packet = protocol._port.tx_buffer
+    prototype = np.zeros(payload_size, dtype=np.uint8)
+
+    # The mocked port is refilled with a single packet before each reception, as it copies its unread bytes during
+    # each read.
+    def route() -> None:
+        for _ in range(PACKET_COUNT):
+            # noinspection PyProtectedMember
+            protocol._port.rx_buffer = packet
+            protocol.receive_data()
+            protocol.peek_payload()
+
+    def read() -> None:
+        for _ in range(PACKET_COUNT):
+            # noinspection PyProtectedMember
+            protocol._port.rx_buffer = packet
+            protocol.receive_data()
+            protocol.read_data(prototype)
+
+    # Compiles all methods used by the measured functions before measuring the performance.
+    route()
+    read()
+
+    return best_time(route), best_time(read)
+
+
+def main() -> None:
+    """Runs the benchmark for each framing codec and payload size and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    console.echo("Eager and lazy payload decoding (times in microseconds per packet):")
+    console.echo(f"{'Codec':<7}{'Payload':<9}{'eager route':>13}{'lazy route':>12}{'eager read':>12}{'lazy read':>11}")
+    for framing_codec in FRAMING_CODECS:
+        for payload_size in PAYLOAD_SIZES:
+            eager_route, eager_read = measure(framing_codec, payload_size, lazy_decoding=False)
+            lazy_route, lazy_read = measure(framing_codec, payload_size, lazy_decoding=True)
+            console.echo(
+                f"{framing_codec.value:<7}{payload_size:<9}{eager_route:>13.2f}{lazy_route:>12.2f}{eager_read:>12.2f}"
+                f"{lazy_read:>11.2f}"
+            )
+
+    console.echo("Lazy decoding benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,115 @@
+# This benchmark measures how the aggregate packet throughput of the TransportLayer class scales with the number of
+# concurrently driven serial ports. Each port is serviced by its own TransportLayer instance and thread, which
+# repeatedly sends a payload and waits to receive it back. Since TransportLayer instances do not share any mutable
+# state, the aggregate throughput should scale with the number of ports, up to the number of available CPU cores.
+#
+# On standard (GIL) Python builds, the scaling is limited by the GIL, as only the numba-compiled and syscall portions of
+# each cycle run in parallel. On free-threaded (no-GIL) Python builds, all portions of each cycle can run in parallel.
+# The microcontrollers are emulated by the threads that echo all data received by the 'controller' end of each
+# pseudo-terminal pair back to the TransportLayer instance. This benchmark only works on Linux and macOS.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+import os
+import sys
+from threading import Event, Thread
+
+import numpy as np
+from ataraxis_time import PrecisionTimer, TimerPrecisions
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import TransportLayer
+
+# The numbers of concurrently driven ports to benchmark.
+PORT_COUNTS = (1, 2, 4, 8)
+# The number of round-trip cycles executed by each port during each benchmark stage.
+CYCLE_COUNT = 2000
+# The size of each transmitted and received payload, in bytes.
+PAYLOAD_SIZE = 64
+
+
+def echo(descriptor: int, stop: Event) -> None:
+    """Emulates the microcontroller by sending all data received by the controller end of the pseudo-terminal back
+    to the TransportLayer instance.
+    """
+    while not stop.is_set():
+        try:
+            data = os.read(descriptor, 4096)
+        except OSError:
+            return
+        os.write(descriptor, data)
+
+
+def drive(transport_layer: TransportLayer, cycle_count: int) -> None:
+    """Executes the requested number of send-and-receive cycles using the input TransportLayer instance."""
+    payload = np.arange(PAYLOAD_SIZE, dtype=np.uint8)
+    prototype = np.zeros(shape=PAYLOAD_SIZE, dtype=np.uint8)
+    for _ in range(cycle_count):
+        transport_layer.write_data(payload)
+        transport_layer.send_data()
+        while not transport_layer.receive_data():
+            pass
+        transport_layer.read_data(prototype)
+
+
+def run_stage(transport_layers: list[TransportLayer], cycle_count: int) -> float:
+    """Drives all input TransportLayer instances concurrently and returns the aggregate throughput in packets per
+    second.
+    """
+    threads = [Thread(target=drive, args=(transport_layer, cycle_count)) for transport_layer in transport_layers]
+
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    elapsed = timer.elapsed / 1_000_000
+
+    return (cycle_count * len(transport_layers)) / elapsed
+
+
+def main() -> None:
+    """Runs the benchmark stage for each requested number of ports and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    # Python 3.13+ exposes whether the GIL is enabled for the running interpreter.
+    gil_enabled = getattr(sys, "_is_gil_enabled", lambda: True)()
+    console.echo(f"Python {sys.version.split()[0]}, GIL enabled: {gil_enabled}, CPU cores: {os.cpu_count()}.")
+
+    # Opens one pseudo-terminal pair and one TransportLayer instance for the maximum number of benchmarked ports. The
+    # TransportLayer instances connect to the 'device' ends, and the echo threads use the 'controller' ends.
+    stop = Event()
+    descriptors = []
+    transport_layers = []
+    echo_threads = []
+    for _ in range(max(PORT_COUNTS)):
+        controller, device = os.openpty()
+        descriptors.extend((controller, device))
+        transport_layers.append(
+            TransportLayer(port=os.ttyname(device), microcontroller_serial_buffer_size=256, baudrate=115200)
+        )
+        echo_threads.append(Thread(target=echo, args=(controller, stop), daemon=True))
+        echo_threads[-1].start()
+
+    # Runs a short cycle on all ports to compile all JIT methods before measuring the throughput.
+    run_stage(transport_layers, cycle_count=10)
+
+    baseline = 0.0
+    for port_count in PORT_COUNTS:
+        rate = run_stage(transport_layers[:port_count], cycle_count=CYCLE_COUNT)
+        baseline = baseline or rate
+        console.echo(
+            f"{port_count} port(s): {rate:.1f} packets / s aggregate, {rate / baseline:.2f}x the single-port rate."
+        )
+
+    console.echo("Multi-port scaling benchmark: Complete.", level=LogLevel.SUCCESS)
+
+    stop.set()
+    for descriptor in descriptors:
+        os.close(descriptor)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,96 @@
+# This benchmark measures how long the send_data() calls of the TransportLayer class block the producer thread when the
+# emulated microcontroller reads the transmitted bytes slower than they are sent. The reader thread drains the
+# controller end of a pseudo-terminal at a fixed rate, while the producer sends the packets as fast as possible.
+#
+# In the blocking mode, the send_data() calls wait for the serial port to accept each packet once the pseudo-terminal's
+# queue fills up, so the worst-case call duration grows with the reader's delay. In the non-blocking mode, the calls
+# store the bytes the serial port does not accept in the transmission ring and return immediately, and the pending
+# bytes are written at the end with the flush_transmission() method. This benchmark only works on Linux and macOS.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+import os
+import time
+from threading import Event, Thread
+
+import numpy as np
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import TransportLayer
+
+# The benchmarked sizes of the transmission ring, in bytes. The size of 0 selects the blocking mode.
+RING_SIZES = (0, 1 << 20)
+# The size of each payload, in bytes.
+PAYLOAD_SIZE = 64
+# The number of packets sent during each benchmark stage.
+PACKET_COUNT = 8192
+# The number of bytes the reader thread reads from the pseudo-terminal at each step.
+READ_SIZE = 1024
+# The delay between the reader thread's reads, in seconds.
+READ_DELAY = 0.001
+
+
+def drain(descriptor: int, stop: Event) -> None:
+    """Reads the bytes sent to the controller end of the pseudo-terminal at a limited rate until stopped."""
+    while not stop.is_set():
+        try:
+            os.read(descriptor, READ_SIZE)
+        except BlockingIOError:
+            pass
+        time.sleep(READ_DELAY)
+
+
+def main() -> None:
+    """Runs the benchmark stage for each ring size and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    payload = np.arange(PAYLOAD_SIZE, dtype=np.uint8)
+    console.echo(f"Duration of send_data() calls for {PAYLOAD_SIZE}-byte payloads read by a slow receiver:")
+    console.echo(f"{'Ring, bytes':<14}{'Median, us':>12}{'Maximum, us':>14}{'Total, ms':>12}")
+    for ring_size in RING_SIZES:
+        # Opens the pseudo-terminal pair. The TransportLayer connects to the 'device' end, and the reader thread
+        # emulates the microcontroller using the 'controller' end.
+        controller, device = os.openpty()
+        os.set_blocking(controller, False)
+        transport_layer = TransportLayer(
+            port=os.ttyname(device),
+            microcontroller_serial_buffer_size=256,
+            baudrate=115200,
+            transmission_ring_size=ring_size,
+        )
+
+        # Compiles all JIT methods before measuring the performance.
+        transport_layer.write_data(payload)
+        transport_layer.send_data()
+
+        stop = Event()
+        reader = Thread(target=drain, args=(controller, stop))
+        reader.start()
+
+        durations = np.empty(PACKET_COUNT, dtype=np.float64)
+        start = time.perf_counter()
+        for index in range(PACKET_COUNT):
+            call_start = time.perf_counter()
+            transport_layer.write_data(payload)
+            transport_layer.send_data()
+            durations[index] = (time.perf_counter() - call_start) * 1_000_000
+        send_time = (time.perf_counter() - start) * 1000
+
+        # Waits for the reader thread to receive the bytes left in the ring before closing the pseudo-terminal.
+        transport_layer.flush_transmission(timeout=60_000_000)
+        stop.set()
+        reader.join()
+
+        console.echo(f"{ring_size:<14}{np.median(durations):>12.2f}{durations.max():>14.2f}{send_time:>12.2f}")
+
+        del transport_layer
+        os.close(controller)
+        os.close(device)
+
+    console.echo("Non-blocking transmission benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
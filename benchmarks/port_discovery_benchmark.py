@@ -0,0 +1,56 @@
+# This benchmark measures how long it takes to discover the serial ports available on the host. It compares the
+# pySerial's enumeration with the sysfs-based discovery used by the list_available_ports() function on Linux, with and
+# without the port filters and the cache. The cached discovery only reads the kernel's device event counter, unless a
+# device was connected or disconnected since the previous scan. This benchmark only works on Linux.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+import time
+from collections.abc import Callable
+
+import numpy as np
+from serial.tools import list_ports
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import list_available_ports
+
+# The number of times each discovery method is timed.
+REPEAT_COUNT = 200
+# The USB vendor ID used by the filtered discovery. 0x2341 is the vendor ID of the Arduino boards.
+VENDOR_ID = 0x2341
+
+
+def measure(discover: Callable[[], object]) -> tuple[float, float]:
+    """Returns the median and the maximum duration of the input discovery method, in microseconds."""
+    discover()
+    durations = np.empty(REPEAT_COUNT, dtype=np.float64)
+    for index in range(REPEAT_COUNT):
+        start = time.perf_counter()
+        discover()
+        durations[index] = (time.perf_counter() - start) * 1_000_000
+    return float(np.median(durations)), float(durations.max())
+
+
+def main() -> None:
+    """Times each discovery method and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    methods: tuple[tuple[str, Callable[[], object]], ...] = (
+        ("pySerial comports()", list_ports.comports),
+        ("sysfs scan", list_available_ports),
+        ("sysfs scan, VID filter", lambda: list_available_ports(vid=VENDOR_ID)),
+        ("cached", lambda: list_available_ports(use_cache=True)),
+    )
+    console.echo(f"Serial port discovery time ({len(list_ports.comports())} ports found by pySerial):")
+    console.echo(f"{'Method':<26}{'Median, us':>12}{'Maximum, us':>14}")
+    for name, discover in methods:
+        median, maximum = measure(discover)
+        console.echo(f"{name:<26}{median:>12.1f}{maximum:>14.1f}")
+
+    console.echo("Port discovery benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,100 @@
+# This benchmark compares the time it takes to upload a batch of small fixed-size records (such as a trial schedule)
+# to the microcontroller using three approaches: writing each record with the write_data() method and flushing the
+# transmission buffer with the send_data() method whenever the next record does not fit, sending a sequence of
+# dataclass records with the send_records() method, and sending a numpy structured array with the send_records() method.
+# The benchmark uses a mocked serial connection, so it measures the host-side packing and framing overhead.
+#
+# The send_records() method packs as many whole records as fit into each payload and frames all packets before handing
+# them to the serial port in a single write. With structured arrays, there is no per-record interpreter overhead left.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+from collections.abc import Callable
+from dataclasses import dataclass
+
+import numpy as np
+from ataraxis_time import PrecisionTimer, TimerPrecisions
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import TransportLayer
+
+# The benchmarked numbers of records in each batch.
+RECORD_COUNTS = (50, 500)
+# The number of repetitions of each measurement. The benchmark reports the fastest repetition to exclude the delays
+# caused by other processes.
+REPEAT_COUNT = 20
+
+
+@dataclass
+class TrialRecord:
+    """Stores the parameters of a single trial."""
+
+    trial: np.uint16
+    delay: np.float32
+    targets: np.ndarray
+
+
+# The structured datatype that matches the layout of the TrialRecord dataclass.
+TRIAL_DTYPE = np.dtype([("trial", np.uint16), ("delay", np.float32), ("targets", np.uint8, (3,))])
+
+
+def best_time(function: Callable[[], object], record_count: int) -> float:
+    """Returns the fastest per-record time of the input function across all repetitions, in microseconds."""
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    times = []
+    for _ in range(REPEAT_COUNT):
+        timer.reset()
+        function()
+        times.append(timer.elapsed / record_count)
+    return min(times)
+
+
+def main() -> None:
+    """Runs the benchmark for each batch size and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    protocol = TransportLayer(port="MOCK", microcontroller_serial_buffer_size=256, baudrate=1000000, test_mode=True)
+    # noinspection PyProtectedMember
+    maximum_payload_size = int(protocol._max_tx_payload_size)
+
+    console.echo("Time to upload a batch of 9-byte records (microseconds per record):")
+    console.echo(f"{'Records':<9}{'write_data loop':>17}{'dataclasses':>13}{'structured':>12}")
+    for record_count in RECORD_COUNTS:
+        records = np.zeros(record_count, dtype=TRIAL_DTYPE)
+        records["trial"] = np.arange(record_count)
+        trial_records = [
+            TrialRecord(trial=record["trial"], delay=record["delay"], targets=record["targets"].copy())
+            for record in records
+        ]
+
+        def write_loop(batch: list[TrialRecord] = trial_records) -> None:
+            for record in batch:
+                if protocol.bytes_in_transmission_buffer + TRIAL_DTYPE.itemsize > maximum_payload_size:
+                    protocol.send_data()
+                protocol.write_data(record)
+            protocol.send_data()
+            # noinspection PyProtectedMember
+            protocol._port.tx_buffer = b""
+
+        def send_batch(batch: object) -> None:
+            protocol.send_records(batch)
+            # noinspection PyProtectedMember
+            protocol._port.tx_buffer = b""
+
+        # Compiles all methods used by each approach before measuring the performance.
+        write_loop()
+        send_batch(trial_records)
+        send_batch(records)
+
+        loop_time = best_time(write_loop, record_count)
+        dataclass_time = best_time(lambda batch=trial_records: send_batch(batch), record_count)
+        structured_time = best_time(lambda batch=records: send_batch(batch), record_count)
+        console.echo(f"{record_count:<9}{loop_time:>17.2f}{dataclass_time:>13.2f}{structured_time:>12.2f}")
+
+    console.echo("Record batching benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
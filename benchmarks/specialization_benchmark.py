@@ -0,0 +1,137 @@
+# This benchmark compares the generic JIT-compiled packet processing methods of the TransportLayer class with the
+# packet pipeline specialized for the instance's configuration. For each supported CRC width, it measures the time it
+# takes to construct a packet and to verify and decode it, calling the kernels directly, and the time it takes to send
+# and receive the packet through the TransportLayer API using a mocked serial connection.
+#
+# The specialized kernels have the start byte, the CRC parameters, the payload size limits, and the postamble size
+# baked in as compile-time constants. The gain is largest for the kernel calls, as the API round trip also includes the
+# interpreter overhead of the buffer management and the mocked serial port, which is the same for both paths.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+from collections.abc import Callable
+
+import numpy as np
+from ataraxis_time import PrecisionTimer, TimerPrecisions
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import TransportLayer
+
+# The benchmarked CRC configurations: the polynomial, the initial value, and the final XOR value.
+CRC_CONFIGURATIONS = {
+    "CRC-8": (np.uint8(0x07), np.uint8(0x00), np.uint8(0x00)),
+    "CRC-16": (np.uint16(0x1021), np.uint16(0xFFFF), np.uint16(0x0000)),
+    "CRC-32": (np.uint32(0x04C11DB7), np.uint32(0xFFFFFFFF), np.uint32(0x00000000)),
+}
+# The size of each payload, in bytes.
+PAYLOAD_SIZE = 200
+# The number of packets used to measure the processing time of each path during a single repetition.
+CYCLE_COUNT = 5000
+# The number of repetitions of each measurement. The benchmark reports the fastest repetition to exclude the delays
+# caused by other processes.
+REPEAT_COUNT = 7
+
+
+def best_time(function: Callable[[], object]) -> float:
+    """Returns the fastest per-call time of the input function across all repetitions, in microseconds."""
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    times = []
+    for _ in range(REPEAT_COUNT):
+        timer.reset()
+        for _ in range(CYCLE_COUNT):
+            function()
+        times.append(timer.elapsed / CYCLE_COUNT)
+    return min(times)
+
+
+def measure(protocol: TransportLayer) -> tuple[float, float, float]:
+    """Returns the packet construction, packet processing, and API round trip times of the instance, in microseconds.
+
+    The kernels used by the instance are selected the same way as in the send_data() and receive_data() methods.
+    """
+    payload = np.random.default_rng(seed=42).integers(0, 256, size=PAYLOAD_SIZE, dtype=np.uint8)
+
+    # noinspection PyProtectedMember
+    pipeline = protocol._pipeline
+    # noinspection PyProtectedMember
+    framing_processor = protocol._framing_processor.processor
+    # noinspection PyProtectedMember
+    crc_processor = protocol._crc_processor.processor
+    # noinspection PyProtectedMember
+    start_byte = protocol._start_byte
+
+    def construct() -> np.ndarray:
+        if pipeline is not None:
+            return pipeline.construct_packet(payload, framing_processor, PAYLOAD_SIZE)
+        # noinspection PyProtectedMember
+        return protocol._construct_packet(payload, framing_processor, crc_processor, PAYLOAD_SIZE, start_byte)
+
+    # The processing kernels expect the packet without its preamble and decode the payload in place, so each call
+    # receives a fresh copy of the packet.
+    packet = construct()[2:]
+    buffer = np.empty(packet.size, dtype=np.uint8)
+
+    def process() -> int:
+        buffer[:] = packet
+        if pipeline is not None:
+            return pipeline.process_packet(buffer, packet.size, framing_processor)
+        # noinspection PyProtectedMember
+        return protocol._process_packet(buffer, packet.size, framing_processor, crc_processor)
+
+    # Compiles and verifies the kernels before measuring the performance.
+    if process() != PAYLOAD_SIZE or not np.array_equal(buffer[:PAYLOAD_SIZE], payload):
+        console.error(message="The processed payload does not match the constructed payload.", error=RuntimeError)
+
+    def round_trip() -> bool:
+        protocol.write_data(payload)
+        protocol.send_data()
+        # noinspection PyProtectedMember
+        protocol._port.rx_buffer = protocol._port.tx_buffer
+        # noinspection PyProtectedMember
+        protocol._port.tx_buffer = b""
+        return protocol.receive_data()
+
+    return best_time(construct), best_time(process), best_time(round_trip)
+
+
+def main() -> None:
+    """Runs the benchmark for each CRC configuration and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    console.echo(f"Generic and specialized packet pipelines ({PAYLOAD_SIZE}-byte payloads, times in microseconds):")
+    console.echo(f"{'CRC':<8}{'Path':<13}{'Construct':>11}{'Process':>9}{'Round trip':>12}")
+    for name, (polynomial, initial_crc_value, final_crc_xor_value) in CRC_CONFIGURATIONS.items():
+        results: list[tuple[float, float, float]] = []
+        for path, specialized in (("generic", False), ("specialized", True)):
+            protocol = TransportLayer(
+                port="MOCK",
+                microcontroller_serial_buffer_size=256,
+                baudrate=1000000,
+                polynomial=polynomial,
+                initial_crc_value=initial_crc_value,
+                final_crc_xor_value=final_crc_xor_value,
+                test_mode=True,
+                specialized_pipeline=specialized,
+            )
+            # Sends and receives a packet to compile all kernels used by the instance.
+            protocol.write_data(np.zeros(PAYLOAD_SIZE, dtype=np.uint8))
+            protocol.send_data()
+            # noinspection PyProtectedMember
+            protocol._port.rx_buffer = protocol._port.tx_buffer
+            # noinspection PyProtectedMember
+            protocol._port.tx_buffer = b""
+            protocol.receive_data()
+
+            results.append(measure(protocol))
+            construct_time, process_time, round_trip_time = results[-1]
+            console.echo(f"{name:<8}{path:<13}{construct_time:>11.2f}{process_time:>9.2f}{round_trip_time:>12.2f}")
+        gains = [generic_time / specialized_time for generic_time, specialized_time in zip(*results, strict=True)]
+        console.echo(f"{name:<8}{'gain':<13}{gains[0]:>10.2f}x{gains[1]:>8.2f}x{gains[2]:>11.2f}x")
+
+    console.echo("Specialization benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
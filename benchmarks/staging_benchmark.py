@@ -0,0 +1,126 @@
+# This benchmark compares the time it takes to stage the fields of a message in the transmission buffer and to read
+# them from the reception buffer one field at a time (using the write_data() and read_data() methods) and all at once
+# (using the write_many() and read_many() methods, with and without a MessageLayout). The messages alternate scalar and
+# small array fields of different datatypes, similar to the messages exchanged with microcontrollers.
+#
+# The per-field methods pay the interpreter dispatch and compiled function call overhead for each field. Without a
+# layout, the scatter-gather methods still resolve and validate each field and pass it to the compiled copy pass, so
+# their staging time grows with the number of fields. With a layout, write_many() only verifies the fields and copies
+# their data as a single block, so its staging time stays nearly constant. read_many() still creates or fills one
+# returned object per field, which is the only per-field cost left.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+from typing import Any
+from collections.abc import Callable
+
+import numpy as np
+from ataraxis_time import PrecisionTimer, TimerPrecisions
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import MessageLayout, TransportLayer
+
+# The benchmarked numbers of fields in each message.
+FIELD_COUNTS = (2, 6, 12)
+# The field prototypes used to build the messages, in the order of their use.
+FIELD_PROTOTYPES = (
+    np.uint8(1),
+    np.arange(4, dtype=np.float32),
+    np.int32(-2),
+    np.arange(3, dtype=np.uint16),
+    np.float64(0.5),
+    np.array([True, False]),
+)
+# The number of messages used to measure the staging time of each method during a single repetition.
+CYCLE_COUNT = 20000
+# The number of repetitions of each measurement. The benchmark reports the fastest repetition to exclude the delays
+# caused by other processes.
+REPEAT_COUNT = 5
+
+
+def best_time(function: Callable[[], object]) -> float:
+    """Returns the fastest per-call time of the input function across all repetitions, in microseconds."""
+    timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    times = []
+    for _ in range(REPEAT_COUNT):
+        timer.reset()
+        for _ in range(CYCLE_COUNT):
+            function()
+        times.append(timer.elapsed / CYCLE_COUNT)
+    return min(times)
+
+
+def measure(protocol: TransportLayer, fields: tuple[Any, ...]) -> tuple[float, ...]:
+    """Returns the per-field write, scatter-gather write, layout write, per-field read, scatter-gather read, and layout
+    read times of the message, in microseconds.
+    """
+    layout = MessageLayout(*fields)
+
+    def write_each() -> None:
+        protocol.reset_transmission_buffer()
+        for field in fields:
+            protocol.write_data(field)
+
+    def write_all() -> None:
+        protocol.reset_transmission_buffer()
+        protocol.write_many(*fields)
+
+    def write_layout() -> None:
+        protocol.reset_transmission_buffer()
+        protocol.write_many(*fields, layout=layout)
+
+    # Transmits the message once to fill the reception buffer. The read functions rewind the consumed bytes tracker
+    # to read the same payload during each call.
+    write_all()
+    protocol.send_data()
+    # noinspection PyProtectedMember
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    # noinspection PyProtectedMember
+    protocol._port.tx_buffer = b""
+    protocol.receive_data()
+
+    def read_each() -> None:
+        # noinspection PyProtectedMember
+        protocol._rx.consumed_bytes = 0
+        for field in fields:
+            protocol.read_data(field)
+
+    def read_all() -> None:
+        # noinspection PyProtectedMember
+        protocol._rx.consumed_bytes = 0
+        protocol.read_many(*fields)
+
+    def read_layout() -> None:
+        # noinspection PyProtectedMember
+        protocol._rx.consumed_bytes = 0
+        protocol.read_many(*fields, layout=layout)
+
+    # Compiles all methods for the message layout before measuring the performance.
+    functions = (write_each, write_all, write_layout, read_each, read_all, read_layout)
+    for function in functions:
+        function()
+
+    return tuple(best_time(function) for function in functions)
+
+
+def main() -> None:
+    """Runs the benchmark for each message size and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    protocol = TransportLayer(port="MOCK", microcontroller_serial_buffer_size=256, baudrate=1000000, test_mode=True)
+
+    console.echo("Per-field and scatter-gather message staging (times in microseconds):")
+    columns = ("write_data", "write_many", "with layout", "read_data", "read_many", "with layout")
+    console.echo(f"{'Fields':<8}" + "".join(f"{column:>13}" for column in columns))
+    for field_count in FIELD_COUNTS:
+        fields = tuple(FIELD_PROTOTYPES[index % len(FIELD_PROTOTYPES)] for index in range(field_count))
+        times = measure(protocol, fields)
+        console.echo(f"{field_count:<8}" + "".join(f"{time:>13.2f}" for time in times))
+
+    console.echo("Staging benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
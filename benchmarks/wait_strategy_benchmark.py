@@ -0,0 +1,110 @@
+# This benchmark compares the CPU usage and the added reception latency of the TransportLayer wait strategies. For
+# each strategy, the reader thread repeatedly calls receive_data() with a long timeout, while the emulated
+# microcontroller sends packets at random intervals. The benchmark reports the share of a CPU core used by the reader
+# thread and the latency between the packet being written to the serial port and receive_data() returning it.
+#
+# The spin strategy minimizes the latency but fully occupies a CPU core. The sleep strategy minimizes the CPU usage, and
+# the hybrid strategies trade between the two extremes. The printed table can be used to select the strategy that best
+# matches the latency and CPU budget of the application. This benchmark only works on Linux and macOS.
+# See https://github.com/Sun-Lab-NBB/ataraxis-transport-layer-pc for more details.
+# API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
+# Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
+
+import os
+import time
+from threading import Thread
+
+import numpy as np
+from numpy.typing import NDArray
+from ataraxis_base_utilities import LogLevel, console
+
+from ataraxis_transport_layer_pc import WaitStrategy, TransportLayer
+
+# The benchmarked strategies.
+STRATEGIES = {
+    "spin": WaitStrategy.spin(),
+    "hybrid (50 us spin, 200 us yield)": WaitStrategy.hybrid(spin_duration=50, yield_duration=200),
+    "hybrid (10 us spin, 50 us yield)": WaitStrategy.hybrid(spin_duration=10, yield_duration=50),
+    "sleep": WaitStrategy.sleep(),
+}
+# The number of packets received during each benchmark stage.
+PACKET_COUNT = 500
+# The minimum and maximum delay between two consecutive packets, in microseconds.
+DELAY_RANGE = (200, 2000)
+
+
+def build_packet() -> bytes:
+    """Returns the byte-stream of a single serialized packet."""
+    generator = TransportLayer(port="MOCK", microcontroller_serial_buffer_size=256, baudrate=115200, test_mode=True)
+    generator.write_data(np.arange(16, dtype=np.uint8))
+    generator.send_data()
+
+    # noinspection PyProtectedMember
+    return generator._port.tx_buffer
+
+
+def send(descriptor: int, packet: bytes, timestamps: list[int]) -> None:
+    """Writes the packet to the controller end of the pseudo-terminal at random intervals, recording the time of each
+    write.
+    """
+    generator = np.random.default_rng(seed=42)
+    for delay in generator.integers(*DELAY_RANGE, size=PACKET_COUNT):
+        time.sleep(delay / 1_000_000)
+        timestamps.append(time.perf_counter_ns())
+        os.write(descriptor, packet)
+
+
+def run_stage(transport_layer: TransportLayer, controller: int, packet: bytes) -> tuple[float, NDArray[np.float64]]:
+    """Runs a single benchmark stage and returns the reader's CPU usage, in percent, and the packet latencies, in
+    microseconds.
+    """
+    timestamps: list[int] = []
+    latencies = np.empty(PACKET_COUNT, dtype=np.float64)
+    sender = Thread(target=send, args=(controller, packet, timestamps))
+
+    start_wall = time.perf_counter()
+    start_cpu = time.thread_time()
+    sender.start()
+    for index in range(PACKET_COUNT):
+        while not transport_layer.receive_data(timeout=1_000_000):
+            pass
+        latencies[index] = (time.perf_counter_ns() - timestamps[index]) / 1000
+    cpu_usage = (time.thread_time() - start_cpu) / (time.perf_counter() - start_wall) * 100
+    sender.join()
+
+    return cpu_usage, latencies
+
+
+def main() -> None:
+    """Runs the benchmark stage for each strategy and prints the results to the terminal."""
+    if not console.enabled:
+        console.enable()
+
+    packet = build_packet()
+    console.echo(f"{'Strategy':<36}{'CPU, %':>8}{'Median, us':>12}{'p99, us':>10}{'Max, us':>10}")
+    for name, strategy in STRATEGIES.items():
+        # Opens the pseudo-terminal pair. The TransportLayer connects to the 'device' end, and the sender thread
+        # emulates the microcontroller using the 'controller' end.
+        controller, device = os.openpty()
+        transport_layer = TransportLayer(
+            port=os.ttyname(device), microcontroller_serial_buffer_size=256, baudrate=115200, wait_strategy=strategy
+        )
+
+        # Compiles all JIT methods before measuring the performance.
+        os.write(controller, packet)
+        transport_layer.receive_data(timeout=1_000_000)
+
+        cpu_usage, latencies = run_stage(transport_layer, controller, packet)
+        console.echo(
+            f"{name:<36}{cpu_usage:>8.1f}{np.median(latencies):>12.1f}{np.percentile(latencies, 99):>10.1f}"
+            f"{latencies.max():>10.1f}"
+        )
+
+        os.close(controller)
+        os.close(device)
+
+    console.echo("Wait strategy benchmark: Complete.", level=LogLevel.SUCCESS)
+
+
+if __name__ == "__main__":
+    main()
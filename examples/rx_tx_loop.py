@@ -26,8 +26,9 @@ tl_class = TransportLayer(port="/dev/ttyACM1", baudrate=115200, microcontroller_
 
 # Similarly, the baudrate used here is not optimal for all UART microcontrollers. For the communication to be stable,
 # the baudrate must be set to an optimal value for the specific microcontroller participating in the communication
-# cycle. Use the https://wormfood.net/avrbaudcalc.php tool to find the best baudrate for your AVR board or consult the
-# manufacturer's documentation.
+# cycle. If the companion firmware answers the echo probes, use the probe_baudrate() method to measure the candidate
+# baudrates and switch to the fastest error-free one. Otherwise, use the https://wormfood.net/avrbaudcalc.php tool to
+# find the best baudrate for your AVR board or consult the manufacturer's documentation.
 
 # Pre-creates the objects used for the demonstration below.
 test_scalar = np.uint32(123456789)
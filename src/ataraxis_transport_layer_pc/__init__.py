@@ -6,19 +6,58 @@ API documentation: https://ataraxis-transport-layer-pc-api-docs.netlify.app/.
 Authors: Ivan Kondratyev (Inkaros), Katlynn Ryu.
 """
 
-from .helper_modules import CRCProcessor, COBSProcessor
+from .helper_modules import (
+    CRCPreset,
+    LZProcessor,
+    CRCProcessor,
+    COBSProcessor,
+    COBSRProcessor,
+    ReedSolomonProcessor,
+    ByteStuffingProcessor,
+)
 from .transport_layer import (
+    BitField,
+    BaudrateMeasurement,
+    BaudrateProbeReport,
+    FramingCodec,
+    HeldPayload,
+    MessageLayout,
+    RealTimeReport,
+    MicrocontrollerFeature,
+    MicrocontrollerCapabilities,
+    WaitStrategy,
     TransportLayer,
+    TransmissionReport,
     TransportLayerStatus,
+    VarintArray,
+    find_port,
     list_available_ports,
     print_available_ports,
 )
 
 __all__ = [
+    "BaudrateMeasurement",
+    "BaudrateProbeReport",
+    "BitField",
+    "ByteStuffingProcessor",
     "COBSProcessor",
+    "COBSRProcessor",
     "CRCProcessor",
+    "CRCPreset",
+    "FramingCodec",
+    "HeldPayload",
+    "LZProcessor",
+    "MessageLayout",
+    "MicrocontrollerCapabilities",
+    "MicrocontrollerFeature",
+    "RealTimeReport",
+    "ReedSolomonProcessor",
+    "TransmissionReport",
     "TransportLayer",
     "TransportLayerStatus",
+    "VarintArray",
+    "WaitStrategy",
+    "find_port",
     "list_available_ports",
     "print_available_ports",
 ]
@@ -1,19 +1,55 @@
 from .helper_modules import (
+    CRCPreset as CRCPreset,
+    LZProcessor as LZProcessor,
     CRCProcessor as CRCProcessor,
     COBSProcessor as COBSProcessor,
+    COBSRProcessor as COBSRProcessor,
+    ReedSolomonProcessor as ReedSolomonProcessor,
+    ByteStuffingProcessor as ByteStuffingProcessor,
 )
 from .transport_layer import (
+    BitField as BitField,
+    BaudrateMeasurement as BaudrateMeasurement,
+    BaudrateProbeReport as BaudrateProbeReport,
+    FramingCodec as FramingCodec,
+    HeldPayload as HeldPayload,
+    MessageLayout as MessageLayout,
+    RealTimeReport as RealTimeReport,
+    MicrocontrollerFeature as MicrocontrollerFeature,
+    MicrocontrollerCapabilities as MicrocontrollerCapabilities,
+    WaitStrategy as WaitStrategy,
     TransportLayer as TransportLayer,
+    TransmissionReport as TransmissionReport,
     TransportLayerStatus as TransportLayerStatus,
+    VarintArray as VarintArray,
+    find_port as find_port,
     list_available_ports as list_available_ports,
     print_available_ports as print_available_ports,
 )
 
 __all__ = [
+    "BaudrateMeasurement",
+    "BaudrateProbeReport",
+    "BitField",
+    "ByteStuffingProcessor",
     "COBSProcessor",
+    "COBSRProcessor",
     "CRCProcessor",
+    "CRCPreset",
+    "FramingCodec",
+    "HeldPayload",
+    "LZProcessor",
+    "MessageLayout",
+    "MicrocontrollerCapabilities",
+    "MicrocontrollerFeature",
+    "RealTimeReport",
+    "ReedSolomonProcessor",
+    "TransmissionReport",
     "TransportLayer",
     "TransportLayerStatus",
+    "VarintArray",
+    "WaitStrategy",
+    "find_port",
     "list_available_ports",
     "print_available_ports",
 ]
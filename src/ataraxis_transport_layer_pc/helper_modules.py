@@ -1,8 +1,10 @@
 """This module contains the low-level helper classes that support the runtime of TransportLayer class methods."""
 
+from enum import StrEnum
 from typing import Any
+from threading import Lock, RLock
 
-from numba import uint8, uint16, uint32  # type: ignore[import-untyped]
+from numba import int64, uint8, uint16, uint32, boolean  # type: ignore[import-untyped]
 import numpy as np
 from numpy.typing import NDArray
 from numba.experimental import jitclass  # type: ignore[import-untyped]
@@ -13,11 +15,47 @@ _ZERO = np.uint8(0)
 _ONE_BYTE = 1
 _TWO_BYTE = 2
 _BYTE_SIZE = 8
+_MAXIMUM_PARITY_SIZE = 64
+
+# Defines the delimiter, escape, escaped delimiter, and escaped escape byte-values used by the supported byte-stuffing
+# framing schemes. SLIP follows RFC 1055, and HDLC follows the asynchronous HDLC framing described in RFC 1662.
+_BYTE_STUFFING_SCHEMES = {
+    "slip": (0xC0, 0xDB, 0xDC, 0xDD),
+    "hdlc": (0x7E, 0x7D, 0x5E, 0x5D),
+}
 
 # Defines the collection of NumPy types used by the CRCProcessor class to represent valid input arguments and output
 # values.
 type CRCType = np.uint8 | np.uint16 | np.uint32
 
+# Caches the compiled jitclass for each processor class and spec list. The lock serializes the cache access when the
+# processors are created from multiple threads.
+_JITCLASS_CACHE: dict[tuple[type, tuple[tuple[str, Any], ...]], Any] = {}
+_JITCLASS_LOCK = RLock()
+
+
+def _compile_jitclass(processor_class: type, spec: list[tuple[str, Any]]) -> Any:
+    """Returns the jitclass compiled for the input processor class and spec list, compiling it if it is not cached.
+
+    Each call to Numba's 'jitclass' function creates a new class type, which forces Numba to recompile the methods of
+    the class and all JIT-compiled functions that accept it as an argument. Reusing the compiled jitclass for all
+    processors with the same spec list limits this cost to the first processor of each kind.
+
+    Args:
+        processor_class: The Python class to compile.
+        spec: The list of (attribute name, Numba type) tuples that specifies the datatypes of the class attributes.
+
+    Returns:
+        The compiled jitclass.
+    """
+    key = (processor_class, tuple(spec))
+    with _JITCLASS_LOCK:
+        compiled_class = _JITCLASS_CACHE.get(key)
+        if compiled_class is None:
+            compiled_class = jitclass(cls_or_spec=processor_class, spec=spec)
+            _JITCLASS_CACHE[key] = compiled_class
+    return compiled_class
+
 
 class _COBSProcessor:  # pragma: no cover
     """Provides methods for encoding and decoding data using the Consistent Overhead Byte Stuffing (COBS) scheme.
@@ -35,6 +73,9 @@ class _COBSProcessor:  # pragma: no cover
         maximum_packet_size: The maximum size of the packet, in bytes. Due to COBS, it cannot exceed 256 bytes
             (254 payload bytes + 1 overhead + 1 delimiter byte).
         minimum_packet_size: The minimum size of the packet, in bytes. Due to COBS cannot be below 3 bytes.
+        delimiter: The byte-value that marks the end of each encoded packet.
+        fixed_size: Determines whether the size of the encoded packet depends only on the size of the payload. This is
+            always True for the COBS scheme, which always adds exactly 2 bytes to the payload.
     """
 
     def __init__(self) -> None:
@@ -44,6 +85,15 @@ class _COBSProcessor:  # pragma: no cover
         self.maximum_packet_size: int = 256
         self.minimum_packet_size: int = 3
         self.delimiter: int = 0
+        self.fixed_size: bool = True
+
+    def minimum_encoded_size(self, payload_size: int) -> int:
+        """Returns the minimum size of the packet that encodes a payload of the input size."""
+        return payload_size + 2
+
+    def maximum_encoded_size(self, payload_size: int) -> int:
+        """Returns the maximum size of the packet that encodes a payload of the input size."""
+        return payload_size + 2
 
     def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]:
         """Encodes the input payload into a transmittable packet using the COBS scheme.
@@ -150,6 +200,24 @@ class _COBSProcessor:  # pragma: no cover
         # packet is malformed and the data is corrupted, returns an empty array to indicate the error.
         return np.empty(0, dtype=packet.dtype)
 
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int:
+        """Returns the first byte of the payload encoded in the input packet without decoding the whole payload.
+
+        Args:
+            packet: The COBS-encoded packet that stores the payload.
+
+        Returns:
+            The value of the first payload byte or -1 if the packet is too short to store a payload.
+        """
+        if packet.size < self.minimum_packet_size or packet[0] == self.delimiter:
+            return -1
+
+        # The overhead byte stores the distance to the first encoded delimiter. If it is 1, the first payload byte is
+        # an encoded delimiter. Otherwise, the first payload byte is stored unchanged.
+        if packet[0] == 1:
+            return self.delimiter
+        return int(packet[1])
+
 
 class COBSProcessor:
     """Exposes the API for encoding and decoding data using the Consistent Overhead Byte Stuffing (COBS) scheme.
@@ -177,11 +245,12 @@ class COBSProcessor:
             ("maximum_packet_size", uint16),
             ("minimum_packet_size", uint8),
             ("delimiter", uint8),
+            ("fixed_size", boolean),
         ]
 
         # Instantiates the jit class and saves it to the wrapper class attribute. Developer hint: when used as a
         # function, jitclass returns an uninitialized compiled object, so initializing is crucial here.
-        self._processor: _COBSProcessor = jitclass(cls_or_spec=_COBSProcessor, spec=cobs_spec)()
+        self._processor: _COBSProcessor = _compile_jitclass(processor_class=_COBSProcessor, spec=cobs_spec)()
 
     def __repr__(self) -> str:
         """Returns a string representation of the COBSProcessor class instance."""
@@ -236,6 +305,17 @@ class COBSProcessor:
         # Returns the decoded payload to caller if verification was successful
         return payload
 
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int:
+        """Returns the first byte of the payload encoded in the input packet without decoding the whole payload.
+
+        Args:
+            packet: The encoded packet that stores the payload.
+
+        Returns:
+            The value of the first payload byte or -1 if the packet does not store a valid payload.
+        """
+        return int(self._processor.peek_byte(packet))
+
     @property
     def processor(self) -> _COBSProcessor:
         """Returns the jit-compiled COBS processor class instance.
@@ -246,6 +326,485 @@ class COBSProcessor:
         return self._processor
 
 
+class _COBSRProcessor:  # pragma: no cover
+    """Provides methods for encoding and decoding data using the reduced Consistent Overhead Byte Stuffing (COBS/R)
+    scheme.
+
+    Notes:
+        This class is intended to be initialized through Numba's 'jitclass' function.
+
+        COBS/R is a variant of COBS that often saves the trailing byte of the encoded packet. If the value of the last
+        payload byte is greater than the length code of the final COBS block, the encoder stores the last payload byte
+        in place of the length code and drops it from the end of the packet. The decoder recognizes this case by the
+        length code pointing past the end of the packet. As a result, the encoded packet is 1 or 2 bytes larger than
+        the payload, depending on the payload's contents.
+
+    Attributes:
+        maximum_payload_size: The maximum size of the payload, in bytes. Due to COBS, cannot exceed 254 bytes.
+        minimum_payload_size: The minimum size of the payload, in bytes.
+        delimiter: The byte-value that marks the end of each encoded packet.
+        fixed_size: Determines whether the size of the encoded packet depends only on the size of the payload. This is
+            always False for the COBS/R scheme.
+    """
+
+    def __init__(self) -> None:
+        self.maximum_payload_size: int = 254
+        self.minimum_payload_size: int = 1
+        self.delimiter: int = 0
+        self.fixed_size: bool = False
+
+    def minimum_encoded_size(self, payload_size: int) -> int:
+        """Returns the minimum size of the packet that encodes a payload of the input size."""
+        return payload_size + 1
+
+    def maximum_encoded_size(self, payload_size: int) -> int:
+        """Returns the maximum size of the packet that encodes a payload of the input size."""
+        return payload_size + 2
+
+    def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Encodes the input payload into a transmittable packet using the COBS/R scheme.
+
+        Args:
+            payload: The payload to be encoded using the COBS/R scheme.
+
+        Returns:
+            The packet encoded using the COBS/R scheme.
+        """
+        size = payload.size
+        packet = np.empty(size + 2, dtype=payload.dtype)
+        packet[-1] = self.delimiter
+        packet[1:-1] = payload
+
+        # Encodes the payload using the regular COBS scheme. See the _COBSProcessor class for details.
+        next_delimiter_position = packet.size - 1
+        for i in range(size - 1, -1, -1):
+            if payload[i] == self.delimiter:
+                packet[i + 1] = next_delimiter_position - (i + 1)
+                next_delimiter_position = i + 1
+        packet[0] = next_delimiter_position
+
+        # Finds the length code of the final block. If the last payload byte is greater than the code, moves the last
+        # payload byte into the code's position and shortens the packet by one byte.
+        final_code_position = 0
+        for i in range(size - 1, -1, -1):
+            if payload[i] == self.delimiter:
+                final_code_position = i + 1
+                break
+        final_code = packet.size - 1 - final_code_position
+        if size > 0 and payload[size - 1] > final_code:
+            packet[final_code_position] = payload[size - 1]
+            packet[size] = self.delimiter
+            return packet[: size + 1].copy()
+
+        return packet
+
+    def decode_payload(self, packet: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Decodes the COBS/R-encoded payload from the input packet.
+
+        Args:
+            packet: The COBS/R-encoded packet from which to decode the payload.
+
+        Returns:
+            The payload decoded from the packet or an empty uninitialized numpy array if the method fails to decode the
+            payload.
+        """
+        size = packet.size
+        end = size - 1  # The index of the delimiter that terminates the packet
+        if size < 2 or packet[end] != self.delimiter:
+            return np.empty(0, dtype=packet.dtype)
+
+        # Copies the packet, as the input packet may be a 'readonly' array.
+        packet = packet.copy()
+
+        # Jumps through the length codes, restoring each code after the overhead byte to the delimiter value. A code
+        # that points exactly at the terminating delimiter ends a regular packet, and a code that points past it
+        # stores the last payload byte of a reduced packet.
+        read_index = 0
+        while True:
+            code = int(packet[read_index])
+            if code == self.delimiter:
+                return np.empty(0, dtype=packet.dtype)
+            if read_index > 0:
+                packet[read_index] = self.delimiter
+            next_index = read_index + code
+            if next_index == end:
+                return packet[1:end]
+            if next_index > end:
+                payload = np.empty(end, dtype=packet.dtype)
+                payload[: end - 1] = packet[1:end]
+                payload[end - 1] = code
+                return payload
+            read_index = next_index
+
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int:
+        """Returns the first byte of the payload encoded in the input packet without decoding the whole payload.
+
+        Args:
+            packet: The COBS/R-encoded packet that stores the payload.
+
+        Returns:
+            The value of the first payload byte or -1 if the packet is too short to store a payload.
+        """
+        end = packet.size - 1
+        if end < 1:
+            return -1
+
+        # Single-byte payloads are always reduced, so the overhead byte stores the payload byte. In longer packets, a
+        # code of 1 marks an encoded delimiter, and any other code is followed by the unchanged first payload byte.
+        code = int(packet[0])
+        if code == self.delimiter:
+            return -1
+        if end == 1:
+            return code if code > 1 else -1
+        if code == 1:
+            return self.delimiter
+        return int(packet[1])
+
+
+class COBSRProcessor:
+    """Exposes the API for encoding and decoding data using the reduced Consistent Overhead Byte Stuffing (COBS/R)
+    scheme.
+
+    This class wraps a JIT-compiled COBS/R processor implementation, combining the convenience of a pure-python API
+    with the speed of the C-compiled processing code.
+
+    Notes:
+        This class is intended to be used by the TransportLayer class and should not be used directly by the
+        end-users. It makes specific assumptions about the layout and contents of the processed data buffers that are
+        not verified during runtime and must be enforced through the use of the TransportLayer class.
+
+    Attributes:
+        _processor: Stores the jit-compiled _COBSRProcessor instance, which carries out all computations.
+    """
+
+    def __init__(self) -> None:
+        # The template for the numba compiler to assign specific datatypes to variables used by the class.
+        cobsr_spec = [
+            ("maximum_payload_size", uint8),
+            ("minimum_payload_size", uint8),
+            ("delimiter", uint8),
+            ("fixed_size", boolean),
+        ]
+
+        self._processor: _COBSRProcessor = _compile_jitclass(processor_class=_COBSRProcessor, spec=cobsr_spec)()
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the COBSRProcessor class instance."""
+        return (
+            f"COBSRProcessor(maximum_payload_size={self._processor.maximum_payload_size}, "
+            f"minimum_payload_size={self._processor.minimum_payload_size}, delimiter={self._processor.delimiter})"
+        )
+
+    def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Encodes the input payload into a transmittable packet using the COBS/R scheme.
+
+        Args:
+            payload: The payload to be encoded using the COBS/R scheme.
+
+        Returns:
+            The serialized packet encoded using the COBS/R scheme.
+        """
+        return self._processor.encode_payload(payload)
+
+    def decode_payload(self, packet: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Decodes the COBS/R-encoded payload from the input packet.
+
+        Args:
+            packet: The COBS/R-encoded packet from which to decode the payload.
+
+        Returns:
+            The payload decoded from the packet.
+
+        Raises:
+            ValueError: If the decoding fails, indicating uncaught packet corruption.
+        """
+        payload = self._processor.decode_payload(packet)
+
+        if payload.size == 0:
+            message = (
+                "Failed to decode the payload using the COBS/R scheme. The packet is not terminated by the delimiter "
+                "or contains an unencoded delimiter. Packet is likely corrupted."
+            )
+            console.error(message=message, error=ValueError)
+
+        return payload
+
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int:
+        """Returns the first byte of the payload encoded in the input packet without decoding the whole payload.
+
+        Args:
+            packet: The encoded packet that stores the payload.
+
+        Returns:
+            The value of the first payload byte or -1 if the packet does not store a valid payload.
+        """
+        return int(self._processor.peek_byte(packet))
+
+    @property
+    def processor(self) -> _COBSRProcessor:
+        """Returns the jit-compiled COBS/R processor class instance.
+
+        This accessor allows external methods to directly interface with the JIT-compiled class, bypassing the Python
+        wrapper.
+        """
+        return self._processor
+
+
+class _ByteStuffingProcessor:  # pragma: no cover
+    """Provides methods for encoding and decoding data using a byte-stuffing framing scheme, such as SLIP or HDLC.
+
+    Notes:
+        This class is intended to be initialized through Numba's 'jitclass' function.
+
+        The encoder replaces each delimiter byte in the payload with the escape byte followed by the escaped delimiter
+        byte and each escape byte with the escape byte followed by the escaped escape byte. It then terminates the
+        packet with the delimiter byte. The encoded packet is 1 to 2 * payload_size + 1 bytes larger than the payload,
+        depending on how many payload bytes have to be escaped.
+
+    Attributes:
+        maximum_payload_size: The maximum size of the payload, in bytes.
+        minimum_payload_size: The minimum size of the payload, in bytes.
+        delimiter: The byte-value that marks the end of each encoded packet.
+        escape: The byte-value that marks the beginning of each escape sequence.
+        escaped_delimiter: The byte-value that follows the escape byte to encode the delimiter byte.
+        escaped_escape: The byte-value that follows the escape byte to encode the escape byte.
+        fixed_size: Determines whether the size of the encoded packet depends only on the size of the payload. This is
+            always False for byte-stuffing schemes.
+
+    Args:
+        delimiter: The byte-value that marks the end of each encoded packet.
+        escape: The byte-value that marks the beginning of each escape sequence.
+        escaped_delimiter: The byte-value that follows the escape byte to encode the delimiter byte.
+        escaped_escape: The byte-value that follows the escape byte to encode the escape byte.
+    """
+
+    def __init__(self, delimiter: int, escape: int, escaped_delimiter: int, escaped_escape: int) -> None:
+        self.maximum_payload_size: int = 254
+        self.minimum_payload_size: int = 1
+        self.delimiter: int = delimiter
+        self.escape: int = escape
+        self.escaped_delimiter: int = escaped_delimiter
+        self.escaped_escape: int = escaped_escape
+        self.fixed_size: bool = False
+
+    def minimum_encoded_size(self, payload_size: int) -> int:
+        """Returns the minimum size of the packet that encodes a payload of the input size."""
+        return payload_size + 1
+
+    def maximum_encoded_size(self, payload_size: int) -> int:
+        """Returns the maximum size of the packet that encodes a payload of the input size."""
+        return 2 * payload_size + 1
+
+    def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Encodes the input payload into a transmittable packet using the byte-stuffing scheme.
+
+        Args:
+            payload: The payload to be encoded.
+
+        Returns:
+            The encoded packet.
+        """
+        packet = np.empty(2 * payload.size + 1, dtype=payload.dtype)
+        write_index = 0
+        for value in payload:
+            if value == self.delimiter:
+                packet[write_index] = self.escape
+                packet[write_index + 1] = self.escaped_delimiter
+                write_index += 2
+            elif value == self.escape:
+                packet[write_index] = self.escape
+                packet[write_index + 1] = self.escaped_escape
+                write_index += 2
+            else:
+                packet[write_index] = value
+                write_index += 1
+        packet[write_index] = self.delimiter
+        return packet[: write_index + 1].copy()
+
+    def decode_payload(self, packet: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Decodes the byte-stuffed payload from the input packet.
+
+        Args:
+            packet: The encoded packet from which to decode the payload.
+
+        Returns:
+            The payload decoded from the packet or an empty uninitialized numpy array if the method fails to decode the
+            payload.
+        """
+        size = packet.size
+        if size < 2 or packet[size - 1] != self.delimiter:
+            return np.empty(0, dtype=packet.dtype)
+
+        payload = np.empty(size - 1, dtype=packet.dtype)
+        write_index = 0
+        read_index = 0
+        while read_index < size - 1:
+            value = packet[read_index]
+
+            # The delimiter can only be found at the end of the packet.
+            if value == self.delimiter:
+                return np.empty(0, dtype=packet.dtype)
+
+            # Each escape byte has to be followed by one of the two escaped byte-values.
+            if value == self.escape:
+                read_index += 1
+                if read_index == size - 1:
+                    return np.empty(0, dtype=packet.dtype)
+                escaped = packet[read_index]
+                if escaped == self.escaped_delimiter:
+                    value = self.delimiter
+                elif escaped == self.escaped_escape:
+                    value = self.escape
+                else:
+                    return np.empty(0, dtype=packet.dtype)
+
+            payload[write_index] = value
+            write_index += 1
+            read_index += 1
+
+        return payload[:write_index]
+
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int:
+        """Returns the first byte of the payload encoded in the input packet without decoding the whole payload.
+
+        Args:
+            packet: The encoded packet that stores the payload.
+
+        Returns:
+            The value of the first payload byte or -1 if the packet does not start with a valid payload byte or escape
+            sequence.
+        """
+        if packet.size < 2 or packet[0] == self.delimiter:
+            return -1
+        if packet[0] != self.escape:
+            return int(packet[0])
+        if packet[1] == self.escaped_delimiter:
+            return self.delimiter
+        if packet[1] == self.escaped_escape:
+            return self.escape
+        return -1
+
+
+class ByteStuffingProcessor:
+    """Exposes the API for encoding and decoding data using a byte-stuffing framing scheme.
+
+    This class wraps a JIT-compiled byte-stuffing processor implementation, combining the convenience of a pure-python
+    API with the speed of the C-compiled processing code. It supports the Serial Line Internet Protocol (SLIP, RFC 1055)
+    and the asynchronous High-Level Data Link Control (HDLC, RFC 1662) framing schemes, which are used by many legacy
+    devices.
+
+    Notes:
+        The processor only implements the byte-stuffing of the payload. The TransportLayer class wraps the encoded
+        payload into its own packet layout, so the resulting packets are not wire-compatible with standard SLIP or
+        HDLC devices.
+
+        This class is intended to be used by the TransportLayer class and should not be used directly by the
+        end-users. It makes specific assumptions about the layout and contents of the processed data buffers that are
+        not verified during runtime and must be enforced through the use of the TransportLayer class.
+
+    Attributes:
+        _scheme: Stores the name of the used byte-stuffing scheme.
+        _processor: Stores the jit-compiled _ByteStuffingProcessor instance, which carries out all computations.
+
+    Args:
+        scheme: The name of the byte-stuffing scheme to use. Supported schemes are 'slip' and 'hdlc'.
+
+    Raises:
+        ValueError: If the input scheme is not supported.
+    """
+
+    def __init__(self, scheme: str = "slip") -> None:
+        if scheme not in _BYTE_STUFFING_SCHEMES:
+            message = (
+                f"Unable to initialize ByteStuffingProcessor class. Expected one of the supported schemes "
+                f"({', '.join(_BYTE_STUFFING_SCHEMES)}) for 'scheme' argument, but encountered {scheme} of type "
+                f"{type(scheme).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        # The template for the numba compiler to assign specific datatypes to variables used by the class.
+        stuffing_spec = [
+            ("maximum_payload_size", uint8),
+            ("minimum_payload_size", uint8),
+            ("delimiter", uint8),
+            ("escape", uint8),
+            ("escaped_delimiter", uint8),
+            ("escaped_escape", uint8),
+            ("fixed_size", boolean),
+        ]
+
+        self._scheme: str = scheme
+        processor_class = _compile_jitclass(processor_class=_ByteStuffingProcessor, spec=stuffing_spec)
+        self._processor: _ByteStuffingProcessor = processor_class(*_BYTE_STUFFING_SCHEMES[scheme])
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the ByteStuffingProcessor class instance."""
+        return (
+            f"ByteStuffingProcessor(scheme={self._scheme}, delimiter={self._processor.delimiter}, "
+            f"escape={self._processor.escape})"
+        )
+
+    def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Encodes the input payload into a transmittable packet using the byte-stuffing scheme.
+
+        Args:
+            payload: The payload to be encoded.
+
+        Returns:
+            The encoded packet.
+        """
+        return self._processor.encode_payload(payload)
+
+    def decode_payload(self, packet: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Decodes the byte-stuffed payload from the input packet.
+
+        Args:
+            packet: The encoded packet from which to decode the payload.
+
+        Returns:
+            The payload decoded from the packet.
+
+        Raises:
+            ValueError: If the decoding fails, indicating uncaught packet corruption.
+        """
+        payload = self._processor.decode_payload(packet)
+
+        if payload.size == 0:
+            message = (
+                f"Failed to decode the payload using the {self._scheme.upper()} scheme. The packet is not terminated "
+                f"by the delimiter or contains an unencoded delimiter or an invalid escape sequence. Packet is likely "
+                f"corrupted."
+            )
+            console.error(message=message, error=ValueError)
+
+        return payload
+
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int:
+        """Returns the first byte of the payload encoded in the input packet without decoding the whole payload.
+
+        Args:
+            packet: The encoded packet that stores the payload.
+
+        Returns:
+            The value of the first payload byte or -1 if the packet does not store a valid payload.
+        """
+        return int(self._processor.peek_byte(packet))
+
+    @property
+    def scheme(self) -> str:
+        """Returns the name of the used byte-stuffing scheme."""
+        return self._scheme
+
+    @property
+    def processor(self) -> _ByteStuffingProcessor:
+        """Returns the jit-compiled byte-stuffing processor class instance.
+
+        This accessor allows external methods to directly interface with the JIT-compiled class, bypassing the Python
+        wrapper.
+        """
+        return self._processor
+
+
 class _CRCProcessor:  # pragma: no cover
     """Provides methods for working with Cyclic Redundancy Check (CRC) checksums used to verify the integrity of
     transferred data packets.
@@ -334,34 +893,27 @@ class _CRCProcessor:  # pragma: no cover
             table_index = (crc_checksum >> (8 * (self.crc_byte_length - 1))) ^ buffer[i]
             crc_checksum = self._make_polynomial_type((crc_checksum << 8) ^ self.crc_table[table_index])
 
-        # If the method is called to verify the incoming packet's integrity, includes the CRC checksum postamble in
-        # the calculation.
-        if check:
-            # noinspection PyTypeChecker
-            for i in range(packet_size, packet_size + self.crc_byte_length):
-                table_index = (crc_checksum >> (8 * (self.crc_byte_length - 1))) ^ buffer[i]
-                crc_checksum = self._make_polynomial_type((crc_checksum << 8) ^ self.crc_table[table_index])
-
         # Applies the final XOR
         crc_checksum ^= self.final_xor_value
 
-        # If the method is called to generate and write a new checksum, adds the calculated checksum to the end of the
-        # buffer.
-        if not check:
+        # If the method is called to verify the data integrity, compares the calculated checksum to the checksum
+        # postamble and returns 1 if they match and 0 otherwise. Unlike running the CRC calculation over the data and
+        # the postamble, which only produces 0 for intact packets if the final XOR value is 0, the comparison works for
+        # any final XOR value.
+        if check:
+            # noinspection PyTypeChecker
             for i in range(self.crc_byte_length):
-                buffer[packet_size + i] = (crc_checksum >> (8 * (self.crc_byte_length - i - 1))) & 0xFF
+                if buffer[packet_size + i] != (crc_checksum >> (8 * (self.crc_byte_length - i - 1))) & 0xFF:
+                    return np.uint16(0)  # The data is corrupted.
+            return np.uint16(1)
 
-            # Returns the total size of the buffer with the post-pended checksum to indicate that the method ran as
-            # expected.
-            return np.uint16(len(buffer))
+        # Otherwise, adds the calculated checksum to the end of the buffer.
+        for i in range(self.crc_byte_length):
+            buffer[packet_size + i] = (crc_checksum >> (8 * (self.crc_byte_length - i - 1))) & 0xFF
 
-        # If the method is called to verify the data integrity, returns 1 if it succeeds and 0 otherwise.
-        # Running the CRC calculation on the data with post-pended checksum should always return 0 for valid
-        # data packets
-        if crc_checksum == 0:
-            return np.uint16(1)
-        # Otherwise, the data is corrupted.
-        return np.uint16(0)
+        # Returns the total size of the buffer with the post-pended checksum to indicate that the method ran as
+        # expected.
+        return np.uint16(len(buffer))
 
     def _generate_crc_table(self, polynomial: CRCType) -> None:
         """Uses the input polynomial to compute the CRC checksums for each possible uint8 (byte) value.
@@ -441,6 +993,69 @@ class _CRCProcessor:  # pragma: no cover
         return np.uint32(value)
 
 
+class CRCPreset(StrEnum):
+    """Stores the standard CRC algorithms that can be used by the CRCProcessor and TransportLayer classes.
+
+    The presets are named after the entries of the CRC RevEng catalogue. Since the CRCProcessor class only implements
+    the non-reflected (most significant bit first) CRC algorithm, the catalog only includes the standard algorithms that
+    do not reflect their input and output.
+    """
+
+    CRC_8_SMBUS = "crc-8/smbus"
+    """Polynomial 0x07, initial value 0x00, final XOR value 0x00. This is the default CRC used by the
+    ataraxis-transport-layer-mc library."""
+    CRC_8_AUTOSAR = "crc-8/autosar"
+    """Polynomial 0x2F, initial value 0xFF, final XOR value 0xFF."""
+    CRC_8_I_432_1 = "crc-8/i-432-1"
+    """Polynomial 0x07, initial value 0x00, final XOR value 0x55. Also known as CRC-8/ITU."""
+    CRC_8_NRSC_5 = "crc-8/nrsc-5"
+    """Polynomial 0x31, initial value 0xFF, final XOR value 0x00."""
+    CRC_16_IBM_3740 = "crc-16/ibm-3740"
+    """Polynomial 0x1021, initial value 0xFFFF, final XOR value 0x0000. Also known as CRC-16/CCITT-FALSE."""
+    CRC_16_XMODEM = "crc-16/xmodem"
+    """Polynomial 0x1021, initial value 0x0000, final XOR value 0x0000."""
+    CRC_16_GENIBUS = "crc-16/genibus"
+    """Polynomial 0x1021, initial value 0xFFFF, final XOR value 0xFFFF."""
+    CRC_16_UMTS = "crc-16/umts"
+    """Polynomial 0x8005, initial value 0x0000, final XOR value 0x0000. Also known as CRC-16/BUYPASS."""
+    CRC_16_CDMA2000 = "crc-16/cdma2000"
+    """Polynomial 0xC867, initial value 0xFFFF, final XOR value 0x0000."""
+    CRC_32_BZIP2 = "crc-32/bzip2"
+    """Polynomial 0x04C11DB7, initial value 0xFFFFFFFF, final XOR value 0xFFFFFFFF. Uses the CRC-32/ISO-HDLC
+    polynomial without reflection."""
+    CRC_32_MPEG_2 = "crc-32/mpeg-2"
+    """Polynomial 0x04C11DB7, initial value 0xFFFFFFFF, final XOR value 0x00000000."""
+    CRC_32_CKSUM = "crc-32/cksum"
+    """Polynomial 0x04C11DB7, initial value 0x00000000, final XOR value 0xFFFFFFFF. Used by the POSIX cksum utility."""
+    CRC_32_XFER = "crc-32/xfer"
+    """Polynomial 0x000000AF, initial value 0x00000000, final XOR value 0x00000000."""
+    CRC_32_AIXM = "crc-32/aixm"
+    """Polynomial 0x814141AB, initial value 0x00000000, final XOR value 0x00000000. Also known as CRC-32Q."""
+
+
+# Maps each CRC preset to its polynomial, initial value, and final XOR value.
+_CRC_PRESETS: dict[CRCPreset, tuple[CRCType, CRCType, CRCType]] = {
+    CRCPreset.CRC_8_SMBUS: (np.uint8(0x07), np.uint8(0x00), np.uint8(0x00)),
+    CRCPreset.CRC_8_AUTOSAR: (np.uint8(0x2F), np.uint8(0xFF), np.uint8(0xFF)),
+    CRCPreset.CRC_8_I_432_1: (np.uint8(0x07), np.uint8(0x00), np.uint8(0x55)),
+    CRCPreset.CRC_8_NRSC_5: (np.uint8(0x31), np.uint8(0xFF), np.uint8(0x00)),
+    CRCPreset.CRC_16_IBM_3740: (np.uint16(0x1021), np.uint16(0xFFFF), np.uint16(0x0000)),
+    CRCPreset.CRC_16_XMODEM: (np.uint16(0x1021), np.uint16(0x0000), np.uint16(0x0000)),
+    CRCPreset.CRC_16_GENIBUS: (np.uint16(0x1021), np.uint16(0xFFFF), np.uint16(0xFFFF)),
+    CRCPreset.CRC_16_UMTS: (np.uint16(0x8005), np.uint16(0x0000), np.uint16(0x0000)),
+    CRCPreset.CRC_16_CDMA2000: (np.uint16(0xC867), np.uint16(0xFFFF), np.uint16(0x0000)),
+    CRCPreset.CRC_32_BZIP2: (np.uint32(0x04C11DB7), np.uint32(0xFFFFFFFF), np.uint32(0xFFFFFFFF)),
+    CRCPreset.CRC_32_MPEG_2: (np.uint32(0x04C11DB7), np.uint32(0xFFFFFFFF), np.uint32(0x00000000)),
+    CRCPreset.CRC_32_CKSUM: (np.uint32(0x04C11DB7), np.uint32(0x00000000), np.uint32(0xFFFFFFFF)),
+    CRCPreset.CRC_32_XFER: (np.uint32(0x000000AF), np.uint32(0x00000000), np.uint32(0x00000000)),
+    CRCPreset.CRC_32_AIXM: (np.uint32(0x814141AB), np.uint32(0x00000000), np.uint32(0x00000000)),
+}
+
+# Caches the CRCProcessor instances shared by all callers that use the same CRC parameters.
+_SHARED_CRC_PROCESSORS: dict[tuple[int, int, int, int], "CRCProcessor"] = {}
+_CRC_CACHE_LOCK = RLock()
+
+
 class CRCProcessor:
     """Exposes the API for working with Cyclic Redundancy Check (CRC) checksums used to verify the integrity
     of transferred data packets.
@@ -453,6 +1068,9 @@ class CRCProcessor:
         end-users. It makes specific assumptions about the layout and contents of the processed data buffers that are
         not verified during runtime and must be enforced through the use of the TransportLayer class.
 
+        All instances that use the same CRC width share the same compiled jitclass. Use the shared() or from_preset()
+        methods to also share the instance (and its lookup table) between all callers that use the same CRC parameters.
+
     Attributes:
         _processor: Stores the jit-compiled _CRCProcessor instance, which carries out all computations.
 
@@ -491,7 +1109,7 @@ class CRCProcessor:
 
         # Initializes and compiles the internal _CRCProcessor class. This automatically generates the static CRC lookup
         # table
-        self._processor: _CRCProcessor = jitclass(cls_or_spec=_CRCProcessor, spec=crc_spec)(
+        self._processor: _CRCProcessor = _compile_jitclass(processor_class=_CRCProcessor, spec=crc_spec)(
             polynomial=polynomial,
             initial_crc_value=initial_crc_value,
             final_xor_value=final_xor_value,
@@ -506,6 +1124,52 @@ class CRCProcessor:
             f"crc_byte_length={self._processor.crc_byte_length})"
         )
 
+    @classmethod
+    def shared(cls, polynomial: CRCType, initial_crc_value: CRCType, final_xor_value: CRCType) -> "CRCProcessor":
+        """Returns the CRCProcessor instance shared by all callers that use the input CRC parameters.
+
+        The instance is created the first time the parameters are requested and reused by all later calls, so the
+        lookup table is only generated once per process.
+
+        Args:
+            polynomial: The polynomial to use for the generation of the CRC lookup table. The polynomial must be
+                standard (non-reflected / non-reversed).
+            initial_crc_value: The value to which the CRC checksum is initialized before calculation.
+            final_xor_value: The value with which the CRC checksum is XORed after calculation.
+
+        Returns:
+            The shared CRCProcessor instance.
+        """
+        key = (polynomial.dtype.itemsize, int(polynomial), int(initial_crc_value), int(final_xor_value))
+        with _CRC_CACHE_LOCK:
+            processor = _SHARED_CRC_PROCESSORS.get(key)
+            if processor is None:
+                processor = cls(polynomial, initial_crc_value, final_xor_value)
+                _SHARED_CRC_PROCESSORS[key] = processor
+        return processor
+
+    @classmethod
+    def from_preset(cls, preset: CRCPreset | str) -> "CRCProcessor":
+        """Returns the shared CRCProcessor instance that implements the input standard CRC algorithm.
+
+        Args:
+            preset: The CRCPreset member (or its string value) that specifies the CRC algorithm.
+
+        Returns:
+            The shared CRCProcessor instance.
+
+        Raises:
+            ValueError: If the input preset is not a valid CRCPreset member or value.
+        """
+        if preset not in tuple(CRCPreset):
+            message = (
+                f"Unable to resolve the CRC preset. Expected a CRCPreset member or one of its values "
+                f"({', '.join(CRCPreset)}) for 'preset' argument, but encountered {preset} of type "
+                f"{type(preset).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+        return cls.shared(*_CRC_PRESETS[CRCPreset(preset)])
+
     def calculate_checksum(self, buffer: NDArray[np.uint8], check: bool) -> np.uint16:
         """Calculates the checksum for the data stored in the input buffer.
 
@@ -576,6 +1240,517 @@ class CRCProcessor:
         return self._processor.final_xor_value
 
 
+class _ReedSolomonProcessor:  # pragma: no cover
+    """Provides methods for protecting data with Reed-Solomon forward error correction (FEC) codes over the GF(256)
+    Galois field.
+
+    Notes:
+        This class is intended to be initialized through Numba's 'jitclass' function.
+
+        For more information on Reed-Solomon codes, see the original paper:
+        I. S. Reed and G. Solomon, "Polynomial Codes Over Certain Finite Fields," in Journal of the Society for
+        Industrial and Applied Mathematics, vol. 8, no. 2, pp. 300-304, June 1960, doi: 10.1137/0108018.
+
+        The class uses the 0x11D primitive polynomial, the generator element 2, and the first consecutive root 0. To
+        increase runtime speed, all Galois field arithmetic uses static exponent and logarithm lookup tables. Each
+        codeword (data + parity bytes) can be at most 255 bytes long. With N parity bytes, the decoder corrects up to
+        N // 2 corrupted bytes anywhere in the codeword.
+
+    Attributes:
+        parity_size: Stores the number of parity bytes added to each codeword.
+        exp_table: The array that stores the exponent (anti-logarithm) lookup table. The table is doubled in size to
+            avoid modulo operations during multiplication.
+        log_table: The array that stores the logarithm lookup table.
+        generator: The array that stores the coefficients of the generator polynomial, highest degree first.
+
+    Args:
+        parity_size: The number of parity bytes to add to each codeword.
+    """
+
+    def __init__(self, parity_size: int) -> None:
+        self.parity_size: int = parity_size
+        self.exp_table = np.empty(512, dtype=np.uint8)
+        self.log_table = np.zeros(256, dtype=np.uint8)
+
+        # Generates the lookup tables by iteratively multiplying the generator element (2) by itself.
+        value = 1
+        for exponent in range(255):
+            self.exp_table[exponent] = value
+            self.log_table[value] = exponent
+            value <<= 1
+            if value & 0x100:
+                value ^= 0x11D
+        self.exp_table[255:510] = self.exp_table[:255]
+        self.exp_table[510:] = self.exp_table[:2]
+
+        # Generates the generator polynomial as the product of (x - 2^i) for each parity byte.
+        generator = np.ones(1, dtype=np.uint8)
+        factor = np.ones(2, dtype=np.uint8)
+        for exponent in range(parity_size):
+            factor[1] = self.exp_table[exponent]
+            generator = self._multiply_polynomials(generator, factor)
+        self.generator = generator
+
+    def encode(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Computes the parity bytes that protect the input data.
+
+        Args:
+            data: The data to be protected. The size of the data and the parity bytes cannot exceed 255 bytes.
+
+        Returns:
+            The array that stores the parity bytes to be appended to the end of the data.
+        """
+        # Divides the data polynomial by the generator polynomial. The remainder of the division is the parity.
+        remainder = np.zeros(data.size + self.parity_size, dtype=np.uint8)
+        remainder[: data.size] = data
+        for i in range(data.size):
+            coefficient = remainder[i]
+            if coefficient != 0:
+                for j in range(1, self.generator.size):
+                    remainder[i + j] ^= self._multiply(self.generator[j], coefficient)
+        return remainder[data.size :]
+
+    def decode(self, codeword: NDArray[np.uint8]) -> int:
+        """Detects and corrects the corrupted bytes of the input codeword in place.
+
+        Args:
+            codeword: The codeword (data followed by the parity bytes) to be corrected.
+
+        Returns:
+            The number of corrected bytes or -1 if the codeword contains more corrupted bytes than the parity bytes can
+            correct. The codeword is not modified if it cannot be corrected.
+        """
+        size = codeword.size
+
+        # Computes the syndromes. The codeword is intact if all syndromes are 0. The syndromes array is padded with a
+        # leading zero to simplify the error evaluator computation below.
+        syndromes = np.zeros(self.parity_size + 1, dtype=np.uint8)
+        intact = True
+        for i in range(self.parity_size):
+            syndromes[i + 1] = self._evaluate_polynomial(codeword, self.exp_table[i])
+            if syndromes[i + 1] != 0:
+                intact = False
+        if intact:
+            return 0
+
+        # Uses the Berlekamp-Massey algorithm to compute the error locator polynomial.
+        locator = np.ones(1, dtype=np.uint8)
+        previous_locator = np.ones(1, dtype=np.uint8)
+        for i in range(self.parity_size):
+            delta = syndromes[i + 1]
+            for j in range(1, locator.size):
+                delta ^= self._multiply(locator[locator.size - 1 - j], syndromes[i + 1 - j])
+            previous_locator = np.append(previous_locator, np.uint8(0))
+            if delta != 0:
+                if previous_locator.size > locator.size:
+                    new_locator = self._scale_polynomial(previous_locator, delta)
+                    previous_locator = self._scale_polynomial(locator, self._inverse(delta))
+                    locator = new_locator
+                locator = self._add_polynomials(locator, self._scale_polynomial(previous_locator, delta))
+
+        # Discards the leading zero coefficients. The degree of the locator is the number of corrupted bytes.
+        start = 0
+        while start < locator.size - 1 and locator[start] == 0:
+            start += 1
+        locator = locator[start:]
+        error_count = locator.size - 1
+        if error_count * 2 > self.parity_size:
+            return -1
+
+        # Uses the Chien search to find the roots of the locator polynomial, which determine the positions of the
+        # corrupted bytes.
+        reversed_locator = locator[::-1].copy()
+        positions = np.empty(error_count, dtype=np.int64)
+        found = 0
+        for i in range(size):
+            if self._evaluate_polynomial(reversed_locator, self.exp_table[i % 255]) == 0:
+                if found == error_count:
+                    return -1
+                positions[found] = size - 1 - i
+                found += 1
+        if found != error_count:
+            return -1
+
+        # Uses the Forney algorithm to compute the error magnitudes. First, computes the error evaluator polynomial
+        # from the syndromes and the locator polynomial resolved from the error positions.
+        roots = np.empty(error_count, dtype=np.uint8)
+        errata_locator = np.ones(1, dtype=np.uint8)
+        factor = np.ones(2, dtype=np.uint8)
+        for k in range(error_count):
+            roots[k] = self.exp_table[(size - 1 - positions[k]) % 255]
+            factor[0] = roots[k]
+            errata_locator = self._multiply_polynomials(errata_locator, factor)
+        product = self._multiply_polynomials(syndromes[::-1].copy(), errata_locator)
+        evaluator = product[product.size - (error_count + 1) :]
+
+        corrected = codeword.copy()
+        for i in range(error_count):
+            root_inverse = self._inverse(roots[i])
+            derivative = 1
+            for j in range(error_count):
+                if j != i:
+                    derivative = self._multiply(derivative, 1 ^ self._multiply(root_inverse, roots[j]))
+            if derivative == 0:
+                return -1
+            magnitude = self._multiply(roots[i], self._evaluate_polynomial(evaluator, root_inverse))
+            corrected[positions[i]] ^= self._divide(magnitude, derivative)
+
+        # Verifies that the corrected codeword is intact before overwriting the input codeword.
+        for i in range(self.parity_size):
+            if self._evaluate_polynomial(corrected, self.exp_table[i]) != 0:
+                return -1
+        codeword[:] = corrected
+        return error_count
+
+    def _multiply(self, x: int, y: int) -> int:
+        """Multiplies two GF(256) elements."""
+        if x == 0 or y == 0:
+            return 0
+        return int(self.exp_table[int(self.log_table[x]) + int(self.log_table[y])])
+
+    def _divide(self, x: int, y: int) -> int:
+        """Divides the first GF(256) element by the second (non-zero) element."""
+        if x == 0:
+            return 0
+        return int(self.exp_table[int(self.log_table[x]) + 255 - int(self.log_table[y])])
+
+    def _inverse(self, x: int) -> int:
+        """Returns the multiplicative inverse of the (non-zero) GF(256) element."""
+        return int(self.exp_table[255 - int(self.log_table[x])])
+
+    def _scale_polynomial(self, polynomial: NDArray[np.uint8], x: int) -> NDArray[np.uint8]:
+        """Multiplies each coefficient of the polynomial by the GF(256) element."""
+        result = np.empty(polynomial.size, dtype=np.uint8)
+        for i in range(polynomial.size):
+            result[i] = self._multiply(polynomial[i], x)
+        return result
+
+    def _add_polynomials(self, first: NDArray[np.uint8], second: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Adds two polynomials stored with the highest degree coefficients first."""
+        size = max(first.size, second.size)
+        result = np.zeros(size, dtype=np.uint8)
+        result[size - first.size :] = first
+        for i in range(second.size):
+            result[i + size - second.size] ^= second[i]
+        return result
+
+    def _multiply_polynomials(self, first: NDArray[np.uint8], second: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Multiplies two polynomials stored with the highest degree coefficients first."""
+        result = np.zeros(first.size + second.size - 1, dtype=np.uint8)
+        for j in range(second.size):
+            for i in range(first.size):
+                result[i + j] ^= self._multiply(first[i], second[j])
+        return result
+
+    def _evaluate_polynomial(self, polynomial: NDArray[np.uint8], x: int) -> int:
+        """Evaluates the polynomial stored with the highest degree coefficients first at the GF(256) element."""
+        result = int(polynomial[0])
+        for i in range(1, polynomial.size):
+            result = self._multiply(result, x) ^ int(polynomial[i])
+        return result
+
+
+class ReedSolomonProcessor:
+    """Exposes the API for protecting data with Reed-Solomon forward error correction (FEC) codes.
+
+    This class wraps a JIT-compiled Reed-Solomon processor implementation, combining the convenience of a pure-python
+    API with the speed of the C-compiled processing code.
+
+    Notes:
+        This class is intended to be used by the TransportLayer class and should not be used directly by the
+        end-users. It makes specific assumptions about the layout and contents of the processed data buffers that are
+        not verified during runtime and must be enforced through the use of the TransportLayer class.
+
+    Attributes:
+        _processor: Stores the jit-compiled _ReedSolomonProcessor instance, which carries out all computations.
+
+    Args:
+        parity_size: The number of parity bytes to add to each codeword. Each codeword can recover from up to
+            parity_size // 2 corrupted bytes.
+
+    Raises:
+        ValueError: If the parity_size is not an integer between 1 and 64.
+    """
+
+    def __init__(self, parity_size: int) -> None:
+        if not isinstance(parity_size, int) or not 1 <= parity_size <= _MAXIMUM_PARITY_SIZE:
+            message = (
+                f"Unable to initialize ReedSolomonProcessor class. Expected an integer value between 1 and "
+                f"{_MAXIMUM_PARITY_SIZE} for 'parity_size' argument, but encountered {parity_size} of type "
+                f"{type(parity_size).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        # The template for the numba compiler to assign specific datatypes to variables used by the class.
+        reed_solomon_spec = [
+            ("parity_size", int64),
+            ("exp_table", uint8[:]),
+            ("log_table", uint8[:]),
+            ("generator", uint8[:]),
+        ]
+
+        # Initializes and compiles the internal _ReedSolomonProcessor class. This automatically generates the static
+        # lookup tables and the generator polynomial.
+        processor_class = _compile_jitclass(processor_class=_ReedSolomonProcessor, spec=reed_solomon_spec)
+        self._processor: _ReedSolomonProcessor = processor_class(parity_size=parity_size)
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the ReedSolomonProcessor object."""
+        return f"ReedSolomonProcessor(parity_size={self._processor.parity_size})"
+
+    def encode(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Computes the parity bytes that protect the input data.
+
+        Args:
+            data: The data to be protected. The size of the data and the parity bytes cannot exceed 255 bytes.
+
+        Returns:
+            The parity bytes to be appended to the end of the data.
+        """
+        return self._processor.encode(data)
+
+    def decode(self, codeword: NDArray[np.uint8]) -> int:
+        """Detects and corrects the corrupted bytes of the input codeword in place.
+
+        Args:
+            codeword: The codeword (data followed by the parity bytes) to be corrected.
+
+        Returns:
+            The number of corrected bytes.
+
+        Raises:
+            ValueError: If the codeword contains more corrupted bytes than the parity bytes can correct.
+        """
+        result = self._processor.decode(codeword)
+
+        if result < 0:
+            message = (
+                f"Reed-Solomon decoding: Failed. The codeword contains more corrupted bytes than "
+                f"{self._processor.parity_size} parity bytes can correct."
+            )
+            console.error(message=message, error=ValueError)
+
+        return result
+
+    @property
+    def parity_size(self) -> int:
+        """Returns the number of parity bytes added to each codeword."""
+        return self._processor.parity_size
+
+    @property
+    def processor(self) -> _ReedSolomonProcessor:
+        """Returns the jit-compiled Reed-Solomon processor class instance.
+
+        This accessor allows external methods to directly interface with the JIT-compiled class, bypassing the Python
+        wrapper.
+        """
+        return self._processor
+
+
+class _LZProcessor:  # pragma: no cover
+    """Provides methods for compressing and decompressing data using a byte-aligned Lempel-Ziv (LZ77) scheme.
+
+    Notes:
+        This class is intended to be initialized through Numba's 'jitclass' function.
+
+        The compressed data is a sequence of blocks, each starting with a control byte. Control bytes 0 through 127 are
+        followed by 1 through 128 literal bytes. Control bytes 128 through 255 are followed by a single offset byte and
+        instruct the decompressor to copy 3 through 130 bytes (control byte - 125), starting 'offset' bytes before the
+        end of the already decompressed data. The copied region may overlap the copied bytes, so a match with offset 1
+        encodes a run of identical bytes, and a match with offset 4 encodes a repeated 4-byte value.
+
+        The decompressor only copies bytes, so it is cheap enough to mirror on any microcontroller. The compressor
+        searches the whole payload for the longest match, which is affordable for the payload sizes supported by
+        the TransportLayer class (up to 254 bytes). For incompressible data, the scheme adds one byte per 128 data
+        bytes.
+
+    Attributes:
+        maximum_size: The maximum size of the decompressed data, in bytes.
+
+    Args:
+        maximum_size: The maximum size of the decompressed data, in bytes.
+    """
+
+    def __init__(self, maximum_size: int) -> None:
+        self.maximum_size: int = maximum_size
+
+    def compress(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Compresses the input data using the LZ77 scheme.
+
+        Args:
+            data: The data to be compressed.
+
+        Returns:
+            The compressed data.
+        """
+        size = data.size
+        output = np.empty(size + size // 128 + 1, dtype=np.uint8)  # Accounts for the worst-case size
+        read_index = 0
+        write_index = 0
+        literal_start = 0
+        while read_index < size:
+            # Finds the longest match among the previous 255 bytes. Prefers the closest match if multiple matches have
+            # the same length.
+            best_length = 0
+            best_offset = 0
+            for offset in range(1, min(read_index, 255) + 1):
+                length = 0
+                while (
+                    read_index + length < size
+                    and length < 130
+                    and data[read_index - offset + length] == data[read_index + length]
+                ):
+                    length += 1
+                if length > best_length:
+                    best_length = length
+                    best_offset = offset
+
+            # Matches shorter than 3 bytes are cheaper to store as literals.
+            if best_length < 3:
+                read_index += 1
+                continue
+
+            # Flushes the pending literal bytes, splitting them into blocks of at most 128 bytes.
+            while literal_start < read_index:
+                count = min(read_index - literal_start, 128)
+                output[write_index] = count - 1
+                output[write_index + 1 : write_index + 1 + count] = data[literal_start : literal_start + count]
+                write_index += 1 + count
+                literal_start += count
+
+            output[write_index] = 125 + best_length
+            output[write_index + 1] = best_offset
+            write_index += 2
+            read_index += best_length
+            literal_start = read_index
+
+        # Flushes the remaining literal bytes.
+        while literal_start < size:
+            count = min(size - literal_start, 128)
+            output[write_index] = count - 1
+            output[write_index + 1 : write_index + 1 + count] = data[literal_start : literal_start + count]
+            write_index += 1 + count
+            literal_start += count
+
+        return output[:write_index].copy()
+
+    def decompress(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Decompresses the input LZ77-compressed data.
+
+        Args:
+            data: The data to be decompressed.
+
+        Returns:
+            The decompressed data or an empty array if the input data is malformed or decompresses into more than
+            maximum_size bytes.
+        """
+        size = data.size
+        output = np.empty(self.maximum_size, dtype=np.uint8)
+        read_index = 0
+        write_index = 0
+        while read_index < size:
+            control = int(data[read_index])
+            read_index += 1
+
+            # Literal block.
+            if control < 128:
+                count = control + 1
+                if read_index + count > size or write_index + count > self.maximum_size:
+                    return np.empty(0, dtype=np.uint8)
+                output[write_index : write_index + count] = data[read_index : read_index + count]
+                read_index += count
+                write_index += count
+                continue
+
+            # Match block. Copies the bytes one at a time, as the source region may overlap the copied bytes.
+            count = control - 125
+            if read_index >= size:
+                return np.empty(0, dtype=np.uint8)
+            offset = int(data[read_index])
+            read_index += 1
+            if offset == 0 or offset > write_index or write_index + count > self.maximum_size:
+                return np.empty(0, dtype=np.uint8)
+            for i in range(count):
+                output[write_index + i] = output[write_index - offset + i]
+            write_index += count
+
+        return output[:write_index].copy()
+
+
+class LZProcessor:
+    """Exposes the API for compressing and decompressing data using a byte-aligned Lempel-Ziv (LZ77) scheme.
+
+    This class wraps a JIT-compiled LZ processor implementation, combining the convenience of a pure-python API with
+    the speed of the C-compiled processing code.
+
+    Notes:
+        This class is intended to be used by the TransportLayer class and should not be used directly by the
+        end-users. It makes specific assumptions about the layout and contents of the processed data buffers that are
+        not verified during runtime and must be enforced through the use of the TransportLayer class.
+
+    Attributes:
+        _processor: Stores the jit-compiled _LZProcessor instance, which carries out all computations.
+
+    Args:
+        maximum_size: The maximum size of the decompressed data, in bytes.
+    """
+
+    def __init__(self, maximum_size: int = 254) -> None:
+        # The template for the numba compiler to assign specific datatypes to variables used by the class.
+        lz_spec = [("maximum_size", int64)]
+
+        self._processor: _LZProcessor = _compile_jitclass(processor_class=_LZProcessor, spec=lz_spec)(
+            maximum_size=maximum_size
+        )
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the LZProcessor object."""
+        return f"LZProcessor(maximum_size={self._processor.maximum_size})"
+
+    def compress(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Compresses the input data using the LZ77 scheme.
+
+        Args:
+            data: The data to be compressed.
+
+        Returns:
+            The compressed data.
+        """
+        return self._processor.compress(data)
+
+    def decompress(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Decompresses the input LZ77-compressed data.
+
+        Args:
+            data: The data to be decompressed.
+
+        Returns:
+            The decompressed data.
+
+        Raises:
+            ValueError: If the input data is malformed or decompresses into more than maximum_size bytes.
+        """
+        result = self._processor.decompress(data)
+
+        if result.size == 0:
+            message = (
+                f"Failed to decompress the data using the LZ scheme. The data is malformed or decompresses into more "
+                f"than {self._processor.maximum_size} bytes."
+            )
+            console.error(message=message, error=ValueError)
+
+        return result
+
+    @property
+    def processor(self) -> _LZProcessor:
+        """Returns the jit-compiled LZ processor class instance.
+
+        This accessor allows external methods to directly interface with the JIT-compiled class, bypassing the Python
+        wrapper.
+        """
+        return self._processor
+
+
 class SerialMock:
     """Mocks the behavior of the PySerial's `Serial` class for testing purposes.
 
@@ -587,12 +1762,20 @@ class SerialMock:
         is_open: A flag indicating if the mock serial port is open.
         tx_buffer: A byte buffer that stores transmitted data.
         rx_buffer: A byte buffer that stores received data.
+        tx_capacity: The maximum number of bytes the `tx_buffer` can store or None if the buffer is unbounded. When
+            the buffer is bounded, write() only accepts the bytes that fit into the buffer, emulating a non-blocking
+            serial port whose output queue is full.
+        _rx_lock: The lock that serializes the accesses to the `rx_buffer` made by the feed() method and the reading
+            methods. This allows tests to deliver the received data from a separate thread while the TransportLayer
+            reads it.
     """
 
     def __init__(self) -> None:
         self.is_open: bool = False
         self.tx_buffer: bytes = b""
         self.rx_buffer: bytes = b""
+        self.tx_capacity: int | None = None
+        self._rx_lock: Lock = Lock()
 
     def __repr__(self) -> str:
         """Returns a string representation of the SerialMock object."""
@@ -608,25 +1791,30 @@ class SerialMock:
         if self.is_open:
             self.is_open = False
 
-    def write(self, data: bytes) -> None:
+    def write(self, data: bytes) -> int:
         """Writes data to the `tx_buffer`.
 
         Args:
             data: The serialized data to be written to the output buffer.
 
+        Returns:
+            The number of bytes written to the `tx_buffer`, which is less than the size of `data` if the `tx_buffer`
+            does not have enough free space to store all bytes.
+
         Raises:
             TypeError: If `data` is not a bytes' object.
             RuntimeError: If the mock serial port is not open.
         """
         if self.is_open:
-            if isinstance(data, bytes):
-                self.tx_buffer += data
-            else:
+            if not isinstance(data, bytes):
                 message = "Data must be a 'bytes' object"
                 raise TypeError(message)
-        else:
-            message = "Mock serial port is not open"
-            raise RuntimeError(message)
+            if self.tx_capacity is not None:
+                data = data[: max(self.tx_capacity - len(self.tx_buffer), 0)]
+            self.tx_buffer += data
+            return len(data)
+        message = "Mock serial port is not open"
+        raise RuntimeError(message)
 
     def read(self, size: int = 1) -> bytes:
         """Reads a specified number of bytes from the `rx_buffer`.
@@ -641,12 +1829,25 @@ class SerialMock:
             RuntimeError: If the mock serial port is not open.
         """
         if self.is_open:
-            data = self.rx_buffer[:size]
-            self.rx_buffer = self.rx_buffer[size:]
+            with self._rx_lock:
+                data = self.rx_buffer[:size]
+                self.rx_buffer = self.rx_buffer[size:]
             return data
         message = "Mock serial port is not open"
         raise RuntimeError(message)
 
+    def feed(self, data: bytes) -> None:
+        """Appends data to the `rx_buffer`, emulating the serial port receiving it from the Microcontroller.
+
+        Unlike modifying the `rx_buffer` directly, this method is safe to call from a thread other than the one that
+        reads the data.
+
+        Args:
+            data: The serialized data to be added to the input buffer.
+        """
+        with self._rx_lock:
+            self.rx_buffer += data
+
     def reset_input_buffer(self) -> None:
         """Clears the `rx_buffer` attribute.
 
@@ -654,7 +1855,8 @@ class SerialMock:
             RuntimeError: If the mock serial port is not open.
         """
         if self.is_open:
-            self.rx_buffer = b""
+            with self._rx_lock:
+                self.rx_buffer = b""
         else:
             message = "Mock serial port is not open"
             raise RuntimeError(message)
@@ -674,7 +1876,8 @@ class SerialMock:
     @property
     def in_waiting(self) -> int:
         """Returns the number of bytes stored in the `rx_buffer`."""
-        return len(self.rx_buffer)
+        with self._rx_lock:
+            return len(self.rx_buffer)
 
     @property
     def out_waiting(self) -> int:
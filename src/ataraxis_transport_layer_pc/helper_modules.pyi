@@ -1,4 +1,6 @@
+from enum import StrEnum
 from typing import Any
+from threading import Lock, RLock
 
 import numpy as np
 from _typeshed import Incomplete
@@ -8,17 +10,28 @@ _ZERO: Incomplete
 _ONE_BYTE: int
 _TWO_BYTE: int
 _BYTE_SIZE: int
+_MAXIMUM_PARITY_SIZE: int
+_BYTE_STUFFING_SCHEMES: dict[str, tuple[int, int, int, int]]
 type CRCType = np.uint8 | np.uint16 | np.uint32
 
+_JITCLASS_CACHE: dict[tuple[type, tuple[tuple[str, Any], ...]], Any]
+_JITCLASS_LOCK: RLock
+
+def _compile_jitclass(processor_class: type, spec: list[tuple[str, Any]]) -> Any: ...
+
 class _COBSProcessor:
     maximum_payload_size: int
     minimum_payload_size: int
     maximum_packet_size: int
     minimum_packet_size: int
     delimiter: int
+    fixed_size: bool
     def __init__(self) -> None: ...
+    def minimum_encoded_size(self, payload_size: int) -> int: ...
+    def maximum_encoded_size(self, payload_size: int) -> int: ...
     def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
     def decode_payload(self, packet: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int: ...
 
 class COBSProcessor:
     _processor: _COBSProcessor
@@ -26,9 +39,60 @@ class COBSProcessor:
     def __repr__(self) -> str: ...
     def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
     def decode_payload(self, packet: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int: ...
     @property
     def processor(self) -> _COBSProcessor: ...
 
+class _COBSRProcessor:
+    maximum_payload_size: int
+    minimum_payload_size: int
+    delimiter: int
+    fixed_size: bool
+    def __init__(self) -> None: ...
+    def minimum_encoded_size(self, payload_size: int) -> int: ...
+    def maximum_encoded_size(self, payload_size: int) -> int: ...
+    def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def decode_payload(self, packet: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int: ...
+
+class COBSRProcessor:
+    _processor: _COBSRProcessor
+    def __init__(self) -> None: ...
+    def __repr__(self) -> str: ...
+    def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def decode_payload(self, packet: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int: ...
+    @property
+    def processor(self) -> _COBSRProcessor: ...
+
+class _ByteStuffingProcessor:
+    maximum_payload_size: int
+    minimum_payload_size: int
+    delimiter: int
+    escape: int
+    escaped_delimiter: int
+    escaped_escape: int
+    fixed_size: bool
+    def __init__(self, delimiter: int, escape: int, escaped_delimiter: int, escaped_escape: int) -> None: ...
+    def minimum_encoded_size(self, payload_size: int) -> int: ...
+    def maximum_encoded_size(self, payload_size: int) -> int: ...
+    def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def decode_payload(self, packet: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int: ...
+
+class ByteStuffingProcessor:
+    _scheme: str
+    _processor: _ByteStuffingProcessor
+    def __init__(self, scheme: str = "slip") -> None: ...
+    def __repr__(self) -> str: ...
+    def encode_payload(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def decode_payload(self, packet: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def peek_byte(self, packet: NDArray[np.uint8]) -> int: ...
+    @property
+    def scheme(self) -> str: ...
+    @property
+    def processor(self) -> _ByteStuffingProcessor: ...
+
 class _CRCProcessor:
     polynomial: CRCType
     initial_crc_value: CRCType
@@ -40,9 +104,33 @@ class _CRCProcessor:
     def _generate_crc_table(self, polynomial: CRCType) -> None: ...
     def _make_polynomial_type(self, value: Any) -> CRCType: ...
 
+class CRCPreset(StrEnum):
+    CRC_8_SMBUS = "crc-8/smbus"
+    CRC_8_AUTOSAR = "crc-8/autosar"
+    CRC_8_I_432_1 = "crc-8/i-432-1"
+    CRC_8_NRSC_5 = "crc-8/nrsc-5"
+    CRC_16_IBM_3740 = "crc-16/ibm-3740"
+    CRC_16_XMODEM = "crc-16/xmodem"
+    CRC_16_GENIBUS = "crc-16/genibus"
+    CRC_16_UMTS = "crc-16/umts"
+    CRC_16_CDMA2000 = "crc-16/cdma2000"
+    CRC_32_BZIP2 = "crc-32/bzip2"
+    CRC_32_MPEG_2 = "crc-32/mpeg-2"
+    CRC_32_CKSUM = "crc-32/cksum"
+    CRC_32_XFER = "crc-32/xfer"
+    CRC_32_AIXM = "crc-32/aixm"
+
+_CRC_PRESETS: dict[CRCPreset, tuple[CRCType, CRCType, CRCType]]
+_SHARED_CRC_PROCESSORS: dict[tuple[int, int, int, int], CRCProcessor]
+_CRC_CACHE_LOCK: RLock
+
 class CRCProcessor:
     _processor: _CRCProcessor
     def __init__(self, polynomial: CRCType, initial_crc_value: CRCType, final_xor_value: CRCType) -> None: ...
+    @classmethod
+    def shared(cls, polynomial: CRCType, initial_crc_value: CRCType, final_xor_value: CRCType) -> CRCProcessor: ...
+    @classmethod
+    def from_preset(cls, preset: CRCPreset | str) -> CRCProcessor: ...
     def __repr__(self) -> str: ...
     def calculate_checksum(self, buffer: NDArray[np.uint8], check: bool) -> np.uint16: ...
     @property
@@ -58,16 +146,61 @@ class CRCProcessor:
     @property
     def final_xor_value(self) -> CRCType: ...
 
+class _ReedSolomonProcessor:
+    parity_size: int
+    exp_table: NDArray[np.uint8]
+    log_table: NDArray[np.uint8]
+    generator: NDArray[np.uint8]
+    def __init__(self, parity_size: int) -> None: ...
+    def encode(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def decode(self, codeword: NDArray[np.uint8]) -> int: ...
+    def _multiply(self, x: int, y: int) -> int: ...
+    def _divide(self, x: int, y: int) -> int: ...
+    def _inverse(self, x: int) -> int: ...
+    def _scale_polynomial(self, polynomial: NDArray[np.uint8], x: int) -> NDArray[np.uint8]: ...
+    def _add_polynomials(self, first: NDArray[np.uint8], second: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def _multiply_polynomials(self, first: NDArray[np.uint8], second: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def _evaluate_polynomial(self, polynomial: NDArray[np.uint8], x: int) -> int: ...
+
+class ReedSolomonProcessor:
+    _processor: _ReedSolomonProcessor
+    def __init__(self, parity_size: int) -> None: ...
+    def __repr__(self) -> str: ...
+    def encode(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def decode(self, codeword: NDArray[np.uint8]) -> int: ...
+    @property
+    def parity_size(self) -> int: ...
+    @property
+    def processor(self) -> _ReedSolomonProcessor: ...
+
+class _LZProcessor:
+    maximum_size: int
+    def __init__(self, maximum_size: int) -> None: ...
+    def compress(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def decompress(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+
+class LZProcessor:
+    _processor: _LZProcessor
+    def __init__(self, maximum_size: int = 254) -> None: ...
+    def __repr__(self) -> str: ...
+    def compress(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    def decompress(self, data: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    @property
+    def processor(self) -> _LZProcessor: ...
+
 class SerialMock:
     is_open: bool
     tx_buffer: bytes
     rx_buffer: bytes
+    tx_capacity: int | None
+    _rx_lock: Lock
     def __init__(self) -> None: ...
     def __repr__(self) -> str: ...
     def open(self) -> None: ...
     def close(self) -> None: ...
-    def write(self, data: bytes) -> None: ...
+    def write(self, data: bytes) -> int: ...
     def read(self, size: int = 1) -> bytes: ...
+    def feed(self, data: bytes) -> None: ...
     def reset_input_buffer(self) -> None: ...
     def reset_output_buffer(self) -> None: ...
     @property
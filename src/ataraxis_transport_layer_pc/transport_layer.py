@@ -2,36 +2,125 @@
 with Arduino and Teensy microcontrollers running the ataraxis-transport-layer-mc library over USB / UART interface.
 """
 
-from enum import IntEnum
+import gc
+import os
+import sys
+from enum import IntEnum, IntFlag, StrEnum
+import time
+import ctypes
+import select
+import contextlib
 from typing import Any
-from dataclasses import fields, is_dataclass
+from operator import attrgetter, itemgetter
+from collections import deque
+from collections.abc import Callable, Iterable, Iterator
+from threading import Lock, Event, RLock, Thread
+from dataclasses import fields, dataclass, is_dataclass
 
-from numba import njit  # type: ignore[import-untyped]
+from numba import njit, literal_unroll  # type: ignore[import-untyped]
 import numpy as np
-from serial import Serial
+from serial import Serial, SerialException
 from numpy.typing import NDArray
 from serial.tools import list_ports
 from ataraxis_time import PrecisionTimer, TimerPrecisions
 from ataraxis_base_utilities import console
+from numpy.lib.recfunctions import repack_fields
 from serial.tools.list_ports_common import ListPortInfo
 
 from .helper_modules import (
+    CRCPreset,
     SerialMock,
+    LZProcessor,
     CRCProcessor,
     COBSProcessor,
+    COBSRProcessor,
     _CRCProcessor,
     _COBSProcessor,
+    _COBSRProcessor,
+    ReedSolomonProcessor,
+    ByteStuffingProcessor,
+    _ByteStuffingProcessor,
 )
 
 # Defines constants that are frequently reused in this module
 _ZERO = np.uint8(0)
 _POLYNOMIAL = np.uint8(0x07)
+# The default array is empty, so it cannot carry any state between calls. It is left writeable, as numba compiles
+# read-only arrays as a separate type that does not unify with the writeable arrays returned by the jitted parser.
 _EMPTY_ARRAY = np.empty(0, dtype=np.uint8)
+_STREAM_BUFFER_SIZE = 65536
+_MAXIMUM_READ_SIZE = 16384  # The upper limit of the adaptive serial port read size, in bytes.
+_POLLIN = 1  # The 'data to read' event flag of the POSIX poll() syscall.
+_POLL_FAILURE = 8 | 16 | 32  # The POLLERR, POLLHUP, and POLLNVAL event flags, which are the same on Linux and macOS.
+_POLLFD_SIZE = 8  # The size of the POSIX 'pollfd' structure, in bytes.
+_MCL_CURRENT = 1  # The mlockall() flag that locks all pages currently mapped into the process's address space.
+_LATENCY_BUFFER_SIZE = 100000  # The number of the most recent packet latencies kept by real-time sessions and trackers.
+_LATENCY_HISTOGRAM_BINS = 32  # The number of power-of-two bins in the transmission latency histogram.
+_MAXIMUM_BIT_WIDTH = 64  # The maximum bit width of a single BitField field.
+_MAXIMUM_VARINT_SIZE = 10  # The maximum number of bytes used by a LEB128-encoded 64-bit integer.
+_RAW_PAYLOAD = 0  # The compression header value that marks uncompressed payloads.
+_COMPRESSED_PAYLOAD = 1  # The compression header value that marks LZ-compressed payloads.
+_KEY_FRAME = 0  # The delta header value that marks payloads transmitted in full.
+_DELTA_FRAME = 1  # The delta header value that marks payloads transmitted as patches to the previous payload.
+_HANDSHAKE_CODE = 255  # The first payload byte that marks the connection handshake messages.
+_HANDSHAKE_VERSION = 1  # The version of the connection handshake protocol implemented by this library.
+_HANDSHAKE_BUFFER_SIZE = 64  # The microcontroller buffer size assumed by the baseline (handshake) configuration.
+_HANDSHAKE_REQUEST = 0  # The handshake message type of the PC's capabilities request.
+_HANDSHAKE_CAPABILITIES = 1  # The handshake message type of the microcontroller's capabilities.
+_HANDSHAKE_SELECTION = 2  # The handshake message type of the PC's configuration selection.
+_HANDSHAKE_ACKNOWLEDGMENT = 3  # The handshake message type of the microcontroller's selection acknowledgment.
+_HANDSHAKE_ECHO_REQUEST = 4  # The handshake message type of the PC's echo probe.
+_HANDSHAKE_ECHO_RESPONSE = 5  # The handshake message type of the microcontroller's echo of the probe.
+_CAPABILITIES_SIZE = 20  # The size of the microcontroller's capabilities message, in bytes.
+_HANDSHAKE_RESEND_INTERVAL = 100000  # The interval at which unanswered handshake messages are resent, in microseconds.
+_ECHO_HEADER_SIZE = 5  # The size of the echo probe header: the code, type, version, and sequence number (uint16).
+_BAUDRATE_PROBE_COUNT = 16  # The default number of echo probes sent at each probed baudrate.
+_BAUDRATE_PROBE_TIMEOUT = 100000  # The default time to wait for each echo probe's response, in microseconds.
+_RECONNECTION_BACKOFF = 10000  # The default delay before the second reconnection attempt, in microseconds.
+_MAXIMUM_RECONNECTION_BACKOFF = 1000000  # The default upper limit of the delay between reconnection attempts.
+_SYSFS_TTY_ROOT = "/sys/class/tty"  # The sysfs directory that lists all TTY devices on Linux.
+_SYSFS_KERNEL_ROOT = "/sys/kernel"  # The sysfs directory that stores the 'uevent_seqnum' kernel attribute.
+
+# Caches the serial ports discovered by scanning each sysfs TTY directory, together with the number of the last device
+# event (uevent) emitted by the kernel before the scan. Since udev processes the same events, the cached ports are valid
+# until the kernel emits a new event, such as the connection or disconnection of a USB device.
+_PORT_CACHE: dict[str, tuple[str, tuple[ListPortInfo, ...]]] = {}
+_PORT_CACHE_LOCK = Lock()
+
+# Counts the active real-time sessions that hold each process-wide real-time feature. Since disabling the garbage
+# collector and locking the memory affect the whole process, the features are only restored when the last session that
+# holds them ends. The lock serializes the sessions of the instances used from multiple threads.
+_SESSION_FEATURE_COUNTS: dict[str, int] = {"gc_disabled": 0, "memory_locked": 0}
+_SESSION_FEATURE_LOCK = Lock()
+
+# On POSIX systems, binds the read() and poll() syscalls of the C standard library. The GIL-free reception engine uses
+# these functions to access the serial port's file descriptor from nopython code without returning to the interpreter.
+if sys.platform != "win32":  # pragma: no branch
+    _LIBC = ctypes.CDLL(None, use_errno=True)
+    _read = _LIBC.read
+    _read.argtypes = (ctypes.c_int, ctypes.c_void_p, ctypes.c_size_t)
+    _read.restype = ctypes.c_ssize_t
+    _poll = _LIBC.poll
+    _poll.argtypes = (ctypes.c_void_p, ctypes.c_ulong, ctypes.c_int)
+    _poll.restype = ctypes.c_int
+    _mlockall = getattr(_LIBC, "mlockall", None)
+    _munlockall = getattr(_LIBC, "munlockall", None)
+    # The ctypes calls release the GIL, so the transmission tracker can wait in tcdrain() without blocking the
+    # threads that send and receive the data.
+    _tcdrain = _LIBC.tcdrain
+    _tcdrain.argtypes = (ctypes.c_int,)
+    _tcdrain.restype = ctypes.c_int
 
 # Defines the collection of NumPy types used by the CRCProcessor class to represent valid input arguments and output
 # values.
 type CRCType = np.uint8 | np.uint16 | np.uint32
 
+# Defines the collections of the framing processor classes supported by the TransportLayer class. All jitclass
+# processors expose the same interface, and the JIT-compiled packet processing methods are compiled separately for each
+# processor type.
+type FramingProcessor = COBSProcessor | COBSRProcessor | ByteStuffingProcessor
+type _FramingProcessor = _COBSProcessor | _COBSRProcessor | _ByteStuffingProcessor
+
 
 class TransportLayerStatus(IntEnum):
     """Stores the status codes used by the TransportLayer class to communicate the state of various processing steps
@@ -40,10 +129,13 @@ class TransportLayerStatus(IntEnum):
 
     INSUFFICIENT_BUFFER_SPACE_ERROR = -1
     """The reception or transmission buffer does not have enough space for the requested operation."""
-    MULTIDIMENSIONAL_ARRAY_ERROR = -2
-    """The data to be written or the prototype to be read are not a one-dimensional NumPy array."""
     EMPTY_ARRAY_ERROR = -3
     """The data to be written or the prototype to be read is an empty NumPy array."""
+    BIT_FIELD_OVERFLOW_ERROR = -4
+    """The value written to a bit field does not fit into the field's bit width."""
+    MALFORMED_VARINT_ERROR = -5
+    """The variable-length integer read from the reception buffer uses more bytes than necessary to store a 64-bit 
+    value."""
     PACKET_SIZE_UNKNOWN = 0
     """Not enough bytes read to fully parse the packet. The start byte was found, but packet size has not been resolved 
     and, therefore, not known."""
@@ -68,21 +160,319 @@ class TransportLayerStatus(IntEnum):
     DELIMITER_NOT_FOUND = 7
     """Delimiter byte value not encountered at the end of the encoded payload data block. See code 104 description for 
     more details, but this code also indicates packet corruption."""
+    PORT_DISCONNECTED = 8
+    """The serial port was hung up or returned the end of the stream, which indicates that the Microcontroller was 
+    disconnected."""
+
+
+class FramingCodec(StrEnum):
+    """Stores the framing codecs that can be used by the TransportLayer class to delimit the transmitted packets.
+
+    Notes:
+        The codec only determines how the payload is encoded. All codecs use the same packet layout: the start byte and
+        the payload size preamble, the encoded payload terminated by the codec's delimiter, and the unescaped CRC
+        postamble. Therefore, the SLIP and HDLC packets are not wire-compatible with the devices that implement the
+        standard SLIP or HDLC framing, and are only understood by the peers that use the same packet layout.
+    """
+
+    COBS = "cobs"
+    """Consistent Overhead Byte Stuffing. Adds exactly 2 bytes to each payload. This is the default codec used by the
+    ataraxis-transport-layer-mc library."""
+    COBSR = "cobs_r"
+    """Reduced Consistent Overhead Byte Stuffing. Adds 1 or 2 bytes to each payload, often saving the trailing byte of
+    the COBS-encoded packet."""
+    SLIP = "slip"
+    """Serial Line Internet Protocol (RFC 1055) byte stuffing. Adds 1 byte plus 1 byte per escaped payload byte."""
+    HDLC = "hdlc"
+    """Asynchronous High-Level Data Link Control (RFC 1662) byte stuffing. Adds 1 byte plus 1 byte per escaped payload
+    byte."""
+
+
+class MicrocontrollerFeature(IntFlag):
+    """Stores the bit flags of the optional features that the microcontroller can report during the connection
+    handshake.
+
+    The extended frames and the packet acknowledgments are reported for information only, as this library does not
+    implement them, and are never selected by the handshake. The remaining two bits of the feature byte are reserved for
+    future features and are preserved as unnamed flags.
+    """
+
+    COMPRESSION = 1
+    """The microcontroller supports the LZ77 payload compression."""
+    DELTA_TRANSMISSION = 2
+    """The microcontroller supports the delta transmission of payloads."""
+    FORWARD_ERROR_CORRECTION = 4
+    """The microcontroller supports the Reed-Solomon forward error correction."""
+    EXTENDED_FRAMES = 8
+    """The microcontroller supports the payloads larger than 254 bytes."""
+    BATCHING = 16
+    """The microcontroller processes every whole record stored in a payload, which allows the send_records() method to
+    pack multiple records into each payload."""
+    ACKNOWLEDGMENTS = 32
+    """The microcontroller acknowledges each received packet."""
+
+
+# The order in which the connection handshake selects the framing codecs supported by the microcontroller. COBS is the
+# fastest codec to process, as its overhead does not depend on the payload's contents, and the only codec compatible
+# with forward error correction.
+_CODEC_PREFERENCE = (FramingCodec.COBS, FramingCodec.COBSR, FramingCodec.SLIP, FramingCodec.HDLC)
+
+# The TransportLayer initialization arguments that are determined by the connection handshake.
+_NEGOTIATED_ARGUMENTS = frozenset(
+    {
+        "microcontroller_serial_buffer_size",
+        "polynomial",
+        "initial_crc_value",
+        "final_crc_xor_value",
+        "crc_preset",
+        "framing_codec",
+        "test_mode",
+    }
+)
 
 
-def list_available_ports() -> tuple[ListPortInfo, ...]:  # pragma: no cover
+def list_available_ports(
+    vid: int | None = None,
+    pid: int | None = None,
+    serial_number: str | None = None,
+    manufacturer: str | None = None,
+    *,
+    use_cache: bool = False,
+) -> tuple[ListPortInfo, ...]:
     """Provides the information about each serial port addressable through the pySerial library.
 
     This function is intended to be used for discovering and selecting the serial port 'names' to use with
     TransportLayer instances.
 
+    Notes:
+        On Linux, the function scans the /sys/class/tty directory directly and only reads the attributes of the devices
+        that pass the filters, which is much faster than the pySerial's enumeration on hosts with many TTY devices.
+        Otherwise, it filters the ports enumerated by the pySerial library.
+
+        If the cache is used, the ports discovered by the previous scan are reused until the kernel emits a new device
+        event (uevent), such as the connection or disconnection of a USB device. Caching is only supported on Linux.
+
+    Args:
+        vid: The USB vendor ID of the device to look for. If None, the ports are not filtered by the vendor ID.
+        pid: The USB product ID of the device to look for. If None, the ports are not filtered by the product ID.
+        serial_number: The USB serial number of the device to look for. If None, the ports are not filtered by the
+            serial number.
+        manufacturer: The case-insensitive part of the USB manufacturer string of the device to look for, e.g.:
+            'arduino'. If None, the ports are not filtered by the manufacturer.
+        use_cache: Determines whether to reuse the ports discovered by the previous scan if no devices were
+            connected or disconnected since then.
+
     Returns:
         A tuple of ListPortInfo instances, each storing ID and descriptive information about each discovered serial
-        port.
+        port that matches all filters. If any filter is provided, only the ports of USB devices are returned.
+    """
+    filters = (vid, pid, serial_number, manufacturer)
+    if sys.platform != "linux" or not os.path.isdir(_SYSFS_TTY_ROOT):  # pragma: no cover
+        return tuple(info for info in list_ports.comports() if _port_matches(info, *filters))
+
+    if not use_cache:
+        return _scan_sysfs_ports(_SYSFS_TTY_ROOT, *filters)
+
+    # Caches all ports, so that the cached scan can be reused for any combination of filters.
+    # Reads the event number before the scan, so that the events emitted during the scan invalidate the cache.
+    with _PORT_CACHE_LOCK:
+        sequence_number = _read_sysfs_attribute(_SYSFS_KERNEL_ROOT, "uevent_seqnum")
+        cached = _PORT_CACHE.get(_SYSFS_TTY_ROOT)
+        if sequence_number is None or cached is None or cached[0] != sequence_number:
+            ports = _scan_sysfs_ports(_SYSFS_TTY_ROOT)
+            if sequence_number is not None:
+                _PORT_CACHE[_SYSFS_TTY_ROOT] = (sequence_number, ports)
+        else:
+            ports = cached[1]
+    return tuple(info for info in ports if _port_matches(info, *filters))
+
+
+def find_port(
+    vid: int | None = None,
+    pid: int | None = None,
+    serial_number: str | None = None,
+    manufacturer: str | None = None,
+    *,
+    use_cache: bool = False,
+) -> str | None:
+    """Returns the name of the serial port connected to the USB device that matches all input filters.
+
+    Use this function to locate the port of a specific microcontroller, for example, by its serial number, instead of
+    hard-coding the port name, which may change when the device is reconnected.
+
+    Args:
+        vid: The USB vendor ID of the device. If None, the ports are not filtered by the vendor ID.
+        pid: The USB product ID of the device. If None, the ports are not filtered by the product ID.
+        serial_number: The USB serial number of the device. If None, the ports are not filtered by the serial number.
+        manufacturer: The case-insensitive part of the USB manufacturer string of the device. If None, the ports are
+            not filtered by the manufacturer.
+        use_cache: Determines whether to reuse the ports discovered by the previous scan if no devices were
+            connected or disconnected since then. See list_available_ports() for details.
+
+    Returns:
+        The name of the matching serial port, e.g.: '/dev/ttyACM0', or None if no port matches the filters.
+
+    Raises:
+        ValueError: If none of the filters are provided.
+        RuntimeError: If more than one port matches the filters.
+    """
+    if vid is None and pid is None and serial_number is None and manufacturer is None:
+        message = (
+            "Unable to find the serial port. Provide at least one of the 'vid', 'pid', 'serial_number', or "
+            "'manufacturer' arguments to identify the device."
+        )
+        console.error(message=message, error=ValueError)
+
+    ports = list_available_ports(vid, pid, serial_number, manufacturer, use_cache=use_cache)
+    if len(ports) > 1:
+        message = (
+            f"Unable to find the serial port. Expected a single port to match the provided filters, but found "
+            f"{len(ports)} matching ports: {', '.join(info.device for info in ports)}. Use additional filters, such "
+            f"as the serial number, to identify the device."
+        )
+        console.error(message=message, error=RuntimeError)
+    return ports[0].device if ports else None
+
 
+def _port_matches(
+    info: ListPortInfo,
+    vid: int | None = None,
+    pid: int | None = None,
+    serial_number: str | None = None,
+    manufacturer: str | None = None,
+) -> bool:
+    """Determines whether the input port matches all input port discovery filters.
+
+    See list_available_ports() for the description of the filters.
+    """
+    return (
+        (vid is None or info.vid == vid)
+        and (pid is None or info.pid == pid)
+        and (serial_number is None or info.serial_number == serial_number)
+        and (manufacturer is None or manufacturer.lower() in (info.manufacturer or "").lower())
+    )
+
+
+def _read_sysfs_attribute(directory: str, name: str) -> str | None:
+    """Returns the first line of the input sysfs attribute file or None if the file cannot be read."""
+    try:
+        with open(os.path.join(directory, name)) as file:
+            return file.readline().strip()
+    except OSError:
+        return None
+
+
+def _scan_sysfs_ports(
+    root: str,
+    vid: int | None = None,
+    pid: int | None = None,
+    serial_number: str | None = None,
+    manufacturer: str | None = None,
+) -> tuple[ListPortInfo, ...]:
+    """Discovers the serial ports listed in the input sysfs TTY directory that match all input filters.
+
+    This function produces the same port information as the pySerial's enumeration on Linux, but only visits the TTY
+    devices backed by hardware and reads the attributes of each USB device in the order of the filters, skipping the
+    rest of the attributes as soon as one of them does not match.
+
+    Args:
+        root: The path to the sysfs TTY directory, e.g.: '/sys/class/tty'.
+        vid: The USB vendor ID of the device to look for.
+        pid: The USB product ID of the device to look for.
+        serial_number: The USB serial number of the device to look for.
+        manufacturer: The case-insensitive part of the USB manufacturer string of the device to look for.
+
+    Returns:
+        The ListPortInfo instances of the matching ports, sorted by the port name.
+    """
+    usb_only = vid is not None or pid is not None or serial_number is not None or manufacturer is not None
+    ports = []
+    for entry in os.scandir(root):
+        try:
+            device_path, subsystem, interface_path = _resolve_sysfs_device(
+                root=root, entry_path=entry.path, is_symlink=entry.is_symlink()
+            )
+        except OSError:
+            continue
+        name = entry.name
+
+        if interface_path is None:
+            # The ports of the 'platform' subsystem are the placeholders of the built-in serial ports that are not
+            # present on the host.
+            if usb_only or subsystem == "platform":
+                continue
+            info = ListPortInfo(f"/dev/{name}", skip_link_detection=True)
+            if subsystem == "pnp":
+                info.description = name
+                info.hwid = _read_sysfs_attribute(device_path, "id") or info.hwid
+            elif subsystem == "amba":
+                info.description = name
+                info.hwid = os.path.basename(device_path)
+            ports.append(info)
+            continue
+
+        usb_path = os.path.dirname(interface_path)
+        device_vid = _read_sysfs_attribute(usb_path, "idVendor")
+        device_vid_value = int(device_vid, 16) if device_vid else None
+        if vid is not None and device_vid_value != vid:
+            continue
+        device_pid = _read_sysfs_attribute(usb_path, "idProduct")
+        device_pid_value = int(device_pid, 16) if device_pid else None
+        if pid is not None and device_pid_value != pid:
+            continue
+        device_serial_number = _read_sysfs_attribute(usb_path, "serial")
+        if serial_number is not None and device_serial_number != serial_number:
+            continue
+        device_manufacturer = _read_sysfs_attribute(usb_path, "manufacturer")
+        if manufacturer is not None and manufacturer.lower() not in (device_manufacturer or "").lower():
+            continue
+
+        info = ListPortInfo(f"/dev/{name}", skip_link_detection=True)
+        info.vid = device_vid_value
+        info.pid = device_pid_value
+        info.serial_number = device_serial_number
+        info.manufacturer = device_manufacturer
+        info.product = _read_sysfs_attribute(usb_path, "product")
+        info.interface = _read_sysfs_attribute(interface_path, "interface")
+
+        # Multi-interface devices, such as the FT4232 converters, expose a separate port for each interface.
+        interface_count = _read_sysfs_attribute(usb_path, "bNumInterfaces")
+        multiple_interfaces = interface_count is not None and interface_count.isdigit() and int(interface_count) > 1
+        info.location = os.path.basename(interface_path if multiple_interfaces else usb_path)
+        info.apply_usb_info()
+        ports.append(info)
+
+    return tuple(sorted(ports))
+
+
+def _resolve_sysfs_device(root: str, entry_path: str, is_symlink: bool) -> tuple[str, str, str | None]:
+    """Resolves the device that backs the input entry of the sysfs TTY directory.
+
+    Virtual terminals and pseudo-terminals do not have the 'device' link, so most entries are rejected after a single
+    syscall. The links are resolved with readlink() instead of realpath(), which checks every component of the deep
+    sysfs paths. The /sys/devices tree does not contain links, so the resolved paths are normalized lexically.
+
+    Args:
+        root: The sysfs TTY directory that stores the entry.
+        entry_path: The path to the TTY entry.
+        is_symlink: Determines whether the entry is a symbolic link to the TTY device's directory.
+
+    Returns:
+        A tuple that stores the path to the device's directory, the name of the device's subsystem, and the path to
+        the USB interface's directory or None if the device is not a USB device.
+
+    Raises:
+        OSError: If the entry is not backed by a device.
     """
-    # Returns the list of port objects visible to the pySerial library.
-    return tuple(list_ports.comports())
+    device_link = os.readlink(os.path.join(entry_path, "device"))
+    tty_path = os.path.join(root, os.readlink(entry_path)) if is_symlink else entry_path
+    device_path = os.path.normpath(os.path.join(tty_path, device_link))
+    subsystem = os.path.basename(os.readlink(os.path.join(device_path, "subsystem")))
+    if subsystem == "usb-serial":
+        return device_path, subsystem, os.path.dirname(device_path)
+    if subsystem == "usb":
+        return device_path, subsystem, device_path
+    return device_path, subsystem, None
 
 
 def print_available_ports() -> None:  # pragma: no cover
@@ -114,734 +504,4883 @@ def print_available_ports() -> None:  # pragma: no cover
         console.disable()
 
 
-class TransportLayer:
-    """Provides methods for sending and receiving serialized data over the USB and UART communication interfaces.
+def _find_serial_number(port: str) -> str | None:
+    """Returns the USB serial number of the device connected to the input serial port.
 
-    This class instantiates and manages all library assets used to transcode, validate, and bidirectionally transfer
-    serial data over the target communication interface. Critically, this includes the transmission and reception
-    buffers that are used to temporarily store the outgoing and incoming data payloads. All user-facing class methods
-    interact with the data stored in one of these buffers.
+    On Linux, the function only reads the sysfs entry of the input port instead of enumerating all ports. Otherwise,
+    it looks the port up among the ports enumerated by the pySerial library.
 
     Args:
-        port: The name of the serial port to connect to, e.g.: 'COM3' or '/dev/ttyUSB0'. Use the 'axtl-ports' CLI
-            command to discover available port names.
-        microcontroller_serial_buffer_size: The size, in bytes, of the buffer used by the connected microcontroller's
-            serial communication interface. Usually, this information is available from the microcontroller's
-            manufacturer (UART / USB controller specification).
-        baudrate: The baudrate to use for communication if the microcontroller uses the UART interface. Should match
-            the value used by the microcontroller. This parameter is ignored when using the USB interface.
-        polynomial: The polynomial to use for the generation of the CRC lookup table. The polynomial must
-            be standard (non-reflected / non-reversed).
-        initial_crc_value: The value to which the CRC checksum is initialized before calculation.
-        final_crc_xor_value: The value with which the CRC checksum is XORed after calculation.
-        test_mode: Determines whether the instance uses a pySerial (real) or a StreamMock (mocked) communication
-            interface. This flag is used during testing and should be disabled for all production runtimes.
+        port: The name of the serial port, e.g.: 'COM3' or '/dev/ttyUSB0'. Symbolic links, such as the
+            /dev/serial/by-id/ links on Linux, are resolved to the port they point to.
+
+    Returns:
+        The serial number of the USB device or None if the port is not connected to a USB device or the device does
+        not report a serial number.
+    """
+    device = os.path.realpath(port) if sys.platform != "win32" else port
+    if sys.platform != "linux" or not os.path.isdir(_SYSFS_TTY_ROOT):  # pragma: no cover
+        for info in list_available_ports():
+            if info.device == device:
+                return info.serial_number
+        return None
+
+    entry_path = os.path.join(_SYSFS_TTY_ROOT, os.path.basename(device))
+    try:
+        _, _, interface_path = _resolve_sysfs_device(
+            root=_SYSFS_TTY_ROOT, entry_path=entry_path, is_symlink=os.path.islink(entry_path)
+        )
+    except OSError:
+        return None
+    return None if interface_path is None else _read_sysfs_attribute(os.path.dirname(interface_path), "serial")
+
+
+class _TransmissionPath:
+    """Stores the state used by the TransportLayer class to stage and transmit outgoing payloads.
+
+    The TransportLayer class keeps all transmission (TX) state in an instance of this class, which is never accessed by
+    the reception methods. This allows sending data from one thread while another thread receives data without
+    synchronizing the two directions.
 
     Attributes:
-        _opened: Tracks whether the serial communication has been opened (the port has been connected).
-        _port: Depending on the test_mode flag, stores either a SerialMock or Serial object that provides the serial
-            communication interface.
-        _crc_processor: Stores the CRCProcessor instance that provides methods for working CRC checksums.
-        _cobs_processor: Stores the COBSProcessor instance that provides methods for encoding and decoding transmitted
-            payloads.
-        _timer: Stores the PrecisionTimer instance that provides a microsecond-precise GIL-releasing timer.
-        _start_byte: Stores the byte-value that marks the beginning of transmitted and received packets.
-        _delimiter_byte: Stores the byte-value that marks the end of transmitted and received packets.
-        _timeout: Stores the number of microseconds to wait between receiving any two consecutive bytes of a packet.
-        _max_tx_payload_size: Stores the maximum number of bytes that can be transmitted as a single payload.
-        _max_rx_payload_size: Stores the maximum number of bytes that can be received from the microcontroller as a
-            single payload.
-        _min_rx_payload_size: Stores the minimum number of bytes that can be received from the Microcontroller as a
-            single payload.
-        _postamble_size: Stores the byte-size of the CRC checksum.
-        _transmission_buffer: The buffer used to stage the data to be sent to the Microcontroller.
-        _reception_buffer: The buffer used to store the decoded data received from the Microcontroller.
-        _bytes_in_transmission_buffer: Tracks how many bytes (relative to index 0) of the transmission buffer are
-            currently used to store the payload to be transmitted.
-        _bytes_in_reception_buffer: Same as _bytes_in_transmission_buffer, but for the reception buffer.
-        _consumed_bytes: Tracks the number of the last received payload bytes that have been consumed by the
+        buffer: The buffer used to stage the data to be sent to the Microcontroller.
+        bytes_in_buffer: Tracks how many bytes (relative to index 0) of the buffer are currently used to store the
+            payload to be transmitted.
+        packet_count: Tracks the number of packets transmitted since the path was initialized.
+        delta_reference: The buffer that stores the last transmitted payload, which is used as the reference for
+            encoding the next payload in the delta transmission mode.
+        delta_reference_size: Tracks how many bytes of the reference buffer store the last transmitted payload or -1
+            if no payload has been transmitted yet.
+        delta_sequence: Tracks the sequence number of the last transmitted delta-mode payload.
+        delta_frame_count: Tracks the number of delta-mode payloads transmitted since the last keyframe, including the
+            keyframe.
+        timer: The PrecisionTimer instance used to time transmission-related operations.
+        lock: The re-entrant lock that serializes all accesses to the transmission state. The lock is re-entrant to
+            support the recursive serialization of dataclasses.
+        ring: The circular buffer that stores the packet bytes not yet accepted by the serial port. This buffer is
+            empty if the non-blocking transmission mode is disabled.
+        ring_start: The index of the first pending byte stored in the ring.
+        ring_count: Tracks the number of pending bytes stored in the ring.
+        high_watermark: The transmission backlog, in bytes, at which the path signals backpressure or 0 if the
+            watermarks are disabled.
+        low_watermark: The transmission backlog, in bytes, at which the path stops signaling backpressure.
+        on_high: The callback invoked when the backlog reaches the high watermark or None.
+        on_low: The callback invoked when the backlog falls to the low watermark or None.
+        throttled: Tracks whether the path currently signals backpressure.
+        tracker: The _TransmissionTracker instance that records the outbound latency of the sent packets or None if
+            the transmission tracking is not active.
+        connection: The number of serial port reconnections reflected by the delta transmission state.
+        disconnection: The serial port error that indicated the Microcontroller's disconnection and the number of
+            reconnections that preceded the opening of the failed port, or None. The error is recorded while the
+            transmission lock is held and handled once the lock is released.
+
+    Args:
+        buffer_size: The size of the transmission buffer, in bytes.
+        ring_size: The size of the ring that stores the pending packet bytes, in bytes.
+    """
+
+    def __init__(self, buffer_size: int, ring_size: int = 0) -> None:
+        self.buffer: NDArray[np.uint8] = np.zeros(shape=buffer_size, dtype=np.uint8)
+        self.bytes_in_buffer: int = 0
+        self.packet_count: int = 0
+        self.delta_reference: NDArray[np.uint8] = np.zeros(shape=buffer_size, dtype=np.uint8)
+        self.delta_reference_size: int = -1
+        self.delta_sequence: int = 0
+        self.delta_frame_count: int = 0
+        self.timer: PrecisionTimer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+        self.lock: RLock = RLock()
+        self.ring: NDArray[np.uint8] = np.zeros(shape=ring_size, dtype=np.uint8)
+        self.ring_start: int = 0
+        self.ring_count: int = 0
+        self.high_watermark: int = 0
+        self.low_watermark: int = 0
+        self.on_high: Callable[[], None] | None = None
+        self.on_low: Callable[[], None] | None = None
+        self.throttled: bool = False
+        self.tracker: _TransmissionTracker | None = None
+        self.connection: int = 0
+        self.disconnection: tuple[OSError, int] | None = None
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the _TransmissionPath instance."""
+        return (
+            f"_TransmissionPath(buffer_size={self.buffer.size}, bytes_in_buffer={self.bytes_in_buffer}, "
+            f"packet_count={self.packet_count}, ring_size={self.ring.size}, ring_count={self.ring_count})"
+        )
+
+    def push_ring(self, data: NDArray[np.uint8]) -> None:
+        """Appends the input bytes to the pending bytes stored in the ring, wrapping around its end if necessary.
+
+        The caller has to ensure that the ring has enough free space to store the input bytes.
+        """
+        end = (self.ring_start + self.ring_count) % self.ring.size
+        head = min(data.size, self.ring.size - end)
+        self.ring[end : end + head] = data[:head]
+        self.ring[: data.size - head] = data[head:]
+        self.ring_count += data.size
+
+    def pending_segment(self) -> NDArray[np.uint8]:
+        """Returns the view of the pending ring bytes that are stored contiguously from the first pending byte."""
+        return self.ring[self.ring_start : self.ring_start + min(self.ring_count, self.ring.size - self.ring_start)]
+
+    def consume_ring(self, count: int) -> None:
+        """Discards the requested number of pending bytes from the beginning of the ring."""
+        self.ring_count -= count
+        # Rewinds the empty ring, so that the next pending bytes are stored (and written) as a single segment.
+        self.ring_start = (self.ring_start + count) % self.ring.size if self.ring_count else 0
+
+
+class _ReceptionPath:
+    """Stores the state used by the TransportLayer class to receive and decode incoming payloads.
+
+    The TransportLayer class keeps all reception (RX) state in an instance of this class, which is never accessed by
+    the transmission methods. This allows receiving data from one thread while another thread sends data without
+    synchronizing the two directions.
+
+    Attributes:
+        slots: The pool of reception slots (buffers) used to store the decoded data received from the Microcontroller.
+        slot_index: The index of the slot used to receive and store the current payload.
+        buffer: The slot used to receive and store the current payload.
+        held_slots: The indices of the slots whose payloads are held by HeldPayload instances.
+        free_slots: The indices of the slots that can be used to receive the next payload, excluding the current slot.
+        slot_lock: The lock that serializes all accesses to the slot pool state. The slots are released by the
+            consumers of the held payloads, so the pool uses a separate lock that is never held while waiting for
+            packets.
+        bytes_in_buffer: Tracks how many bytes (relative to index 0) of the buffer are currently used to store the
+            received payload.
+        encoded_size: Tracks the size of the verified, but not yet decoded, packet stored in the buffer or 0 if the
+            buffer does not store an undecoded packet. This is only used when lazy decoding is enabled.
+        first_byte: Stores the value of the first payload byte extracted from the undecoded packet during its
+            verification or -1 if the packet does not store a correctly encoded payload.
+        consumed_bytes: Tracks the number of the last received payload bytes that have been consumed by the
             read_data() method calls.
-        _leftover_bytes: A buffer used to preserve any 'unconsumed' bytes that were read from the serial port
-            but not used to reconstruct the payload sent from the Microcontroller. This is used to minimize the number
-            of calls to pySerial methods, as they are costly to run.
-        _accepted_numpy_scalars: Stores numpy types (classes) that can be used as scalar inputs or as 'dtype'
-            fields of the numpy arrays that are provided to class methods.
-        _minimum_packet_size: Stores the minimum number of bytes that can represent a valid packet. This value is used
-            to optimize packet reception logic.
+        stream_buffer: The buffer used to preserve any 'unconsumed' bytes that were read from the serial port but
+            not used to reconstruct the payload sent from the Microcontroller. The unconsumed bytes are always stored
+            at the beginning of the buffer.
+        stream_size: Tracks how many bytes (relative to index 0) of the stream buffer are currently used to store the
+            unconsumed serial stream bytes.
+        read_size: The number of bytes requested by the next read from the serial port. The size adapts to the
+            number of bytes returned by the previous read and is never smaller than the size of a reception slot.
+        read_saturated: Tracks whether the previous read from the serial port returned all requested bytes, which
+            indicates that the port likely stores more bytes.
+        port_calls: Tracks the number of serial port queries and reads made by the reception methods since the path
+            was initialized.
+        packet_count: Tracks the number of packets received since the path was initialized.
+        delta_reference: The buffer that stores the last reconstructed payload, which is used as the reference for
+            applying the patches received in the delta transmission mode.
+        delta_reference_size: Tracks how many bytes of the reference buffer store the last reconstructed payload or
+            -1 if the reference is not available (no keyframe has been received since the last lost payload).
+        delta_sequence: Tracks the sequence number of the last reconstructed delta-mode payload.
+        connection: The number of serial port reconnections reflected by the stream buffer and the delta reference.
+        timer: The PrecisionTimer instance used to enforce the packet reception timeout.
+        wait_timer: The PrecisionTimer instance used to enforce the timeout of the receive_data() method.
+        lock: The re-entrant lock that serializes all accesses to the reception state. The lock is re-entrant to
+            support the recursive deserialization of dataclasses.
+
+    Args:
+        buffer_size: The size of each reception slot, in bytes.
+        stream_buffer_size: The size of the stream buffer, in bytes. Must be large enough to store at least one
+            complete packet.
+        slot_count: The number of reception slots in the pool.
+    """
+
+    def __init__(self, buffer_size: int, stream_buffer_size: int = _STREAM_BUFFER_SIZE, slot_count: int = 1) -> None:
+        self.slots: tuple[NDArray[np.uint8], ...] = tuple(
+            np.empty(shape=buffer_size, dtype=np.uint8) for _ in range(slot_count)
+        )
+        self.slot_index: int = 0
+        self.buffer: NDArray[np.uint8] = self.slots[0]
+        self.held_slots: set[int] = set()
+        self.free_slots: list[int] = list(range(1, slot_count))
+        self.slot_lock: Lock = Lock()
+        self.bytes_in_buffer: int = 0
+        self.encoded_size: int = 0
+        self.first_byte: int = -1
+        self.consumed_bytes: int = 0
+        self.stream_buffer: NDArray[np.uint8] = np.empty(shape=stream_buffer_size, dtype=np.uint8)
+        self.stream_size: int = 0
+        self.read_size: int = buffer_size
+        self.read_saturated: bool = False
+        self.port_calls: int = 0
+        self.packet_count: int = 0
+        self.delta_reference: NDArray[np.uint8] = np.zeros(shape=buffer_size, dtype=np.uint8)
+        self.delta_reference_size: int = -1
+        self.delta_sequence: int = 0
+        self.connection: int = 0
+        self.timer: PrecisionTimer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+        self.wait_timer: PrecisionTimer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+        self.lock: RLock = RLock()
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the _ReceptionPath instance."""
+        return (
+            f"_ReceptionPath(buffer_size={self.buffer.size}, slot_count={len(self.slots)}, "
+            f"held_slots={len(self.held_slots)}, bytes_in_buffer={self.bytes_in_buffer}, "
+            f"encoded_size={self.encoded_size}, consumed_bytes={self.consumed_bytes}, stream_size={self.stream_size}, "
+            f"packet_count={self.packet_count})"
+        )
+
+    def hold_slot(self) -> bool:
+        """Marks the current slot as held, so that the next payload is received into a different slot.
+
+        Returns:
+            True if the slot was marked as held and False if the current slot is already held.
+        """
+        with self.slot_lock:
+            if self.slot_index in self.held_slots:
+                return False
+            self.held_slots.add(self.slot_index)
+            return True
+
+    def release_slot(self, index: int) -> None:
+        """Returns the slot with the input index to the pool of slots available for receiving payloads.
+
+        Releasing a slot that is not held has no effect.
+
+        Args:
+            index: The index of the slot to release.
+        """
+        with self.slot_lock:
+            if index not in self.held_slots:
+                return
+            self.held_slots.discard(index)
+
+            # The current slot is reused for the next payload without rotating, so it is not added to the free slots.
+            if index != self.slot_index:
+                self.free_slots.append(index)
+
+    def rotate_slot(self) -> bool:
+        """If the current slot is held, switches to a free slot to receive the next payload.
+
+        Returns:
+            True if the current slot can be used to receive the next payload and False if all slots are held.
+        """
+        with self.slot_lock:
+            if self.slot_index not in self.held_slots:
+                return True
+            if not self.free_slots:
+                return False
+            self.slot_index = self.free_slots.pop()
+            self.buffer = self.slots[self.slot_index]
+            return True
+
+    def append_stream_bytes(self, data: bytes) -> int:
+        """Appends the input serial stream bytes to the end of the unconsumed bytes stored in the stream buffer.
+
+        Args:
+            data: The bytes read from the serial port.
+
+        Returns:
+            The number of bytes copied into the stream buffer. This is less than the size of the input data if the
+            stream buffer does not have enough free space to store all input bytes.
+        """
+        count = min(len(data), self.stream_buffer.size - self.stream_size)
+        self.stream_buffer[self.stream_size : self.stream_size + count] = np.frombuffer(
+            data, dtype=np.uint8, count=count
+        )
+        self.stream_size += count
+        return count
+
+
+class HeldPayload:
+    """Stores a zero-copy, read-only view of a received payload held in one of the TransportLayer's reception slots.
+
+    HeldPayload instances are returned by the TransportLayer's hold_payload() method. While the payload is held, the
+    TransportLayer receives the next payloads into other reception slots, so the payload's data stays valid and can be
+    handed to other threads or deserialized later without copying it. Release each held payload as soon as it is no
+    longer needed, either by calling release() or by using the instance as a context manager, to return its slot to the
+    pool.
+
+    Notes:
+        The view references the slot's memory, which is reused after the payload is released. Do not access the data
+        (or any views created from it) after releasing the payload.
+
+    Args:
+        data: The read-only view of the payload's data.
+        reception_path: The _ReceptionPath instance that owns the slot.
+        slot_index: The index of the slot that stores the payload.
+
+    Attributes:
+        _data: Stores the read-only view of the payload's data.
+        _reception_path: Stores the _ReceptionPath instance that owns the slot.
+        _slot_index: Stores the index of the slot that stores the payload.
+        _released: Tracks whether the payload has been released.
+    """
+
+    def __init__(self, data: NDArray[np.uint8], reception_path: _ReceptionPath, slot_index: int) -> None:
+        self._data: NDArray[np.uint8] = data
+        self._reception_path: _ReceptionPath = reception_path
+        self._slot_index: int = slot_index
+        self._released: bool = False
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the HeldPayload instance."""
+        return f"HeldPayload(size={self._data.size}, slot={self._slot_index}, released={self._released})"
+
+    def __enter__(self) -> "HeldPayload":
+        """Returns the instance to be used inside the context manager block."""
+        return self
+
+    def __exit__(self, *args: object) -> None:
+        """Releases the payload when exiting the context manager block."""
+        self.release()
+
+    @property
+    def data(self) -> NDArray[np.uint8]:
+        """Returns the read-only view of the payload's data."""
+        return self._data
+
+    @property
+    def released(self) -> bool:
+        """Returns True if the payload has been released."""
+        return self._released
+
+    def release(self) -> None:
+        """Returns the payload's reception slot to the pool of slots available for receiving payloads.
+
+        Releasing an already released payload has no effect.
+        """
+        if not self._released:
+            self._released = True
+            self._reception_path.release_slot(self._slot_index)
+
+
+@dataclass(frozen=True)
+class WaitStrategy:
+    """Determines how the TransportLayer class waits for the serial port to receive new bytes.
+
+    Each wait is split into three consecutive phases. During the spin phase, the instance checks the serial port in a
+    tight loop, which reacts to new bytes the fastest but fully occupies a CPU core. During the yield phase, the
+    instance yields the CPU to other threads between the checks. During the sleep phase, the instance sleeps until the
+    serial port receives new bytes or the poll interval runs out. On Linux and macOS, the sleep uses the poll() syscall
+    on the serial port's file descriptor, which wakes up as soon as new bytes arrive. Since poll() has the millisecond
+    resolution, sleeps shorter than a millisecond are rounded up. On Windows and in the test mode, the instance sleeps
+    for the whole poll interval.
+
+    Notes:
+        All durations are measured from the beginning of the wait or from the most recent reception of new bytes,
+        whichever is later. Use the spin(), hybrid(), and sleep() constructors to create the common strategies.
+    """
+
+    spin_duration: int = sys.maxsize
+    """The number of microseconds to spend in the spin phase."""
+    yield_duration: int = 0
+    """The number of microseconds to spend in the yield phase, following the spin phase."""
+    poll_interval: int = 1000
+    """The maximum number of microseconds to sleep between two checks during the sleep phase."""
+
+    @classmethod
+    def spin(cls) -> "WaitStrategy":
+        """Creates the strategy that only uses the spin phase. This is the default strategy, which minimizes the
+        latency at the cost of fully occupying a CPU core while waiting.
+        """
+        return cls()
+
+    @classmethod
+    def hybrid(cls, spin_duration: int = 50, yield_duration: int = 200, poll_interval: int = 1000) -> "WaitStrategy":
+        """Creates the strategy that spins for spin_duration microseconds, then yields for yield_duration
+        microseconds, and then sleeps in poll() for at most poll_interval microseconds between checks.
+        """
+        return cls(spin_duration=spin_duration, yield_duration=yield_duration, poll_interval=poll_interval)
+
+    @classmethod
+    def sleep(cls, poll_interval: int = 1000) -> "WaitStrategy":
+        """Creates the strategy that only uses the sleep phase, which minimizes the CPU usage while waiting."""
+        return cls(spin_duration=0, yield_duration=0, poll_interval=poll_interval)
+
+
+class BitField:
+    """Stores the values of one or more unsigned integer or boolean fields that are serialized as a single bit-packed
+    data block.
+
+    Unlike numpy arrays, which use at least one byte per element, bit fields use exactly the requested number of bits
+    per element. For example, an array of 128 boolean values is serialized as 16 bytes instead of 128 bytes. BitField
+    instances can be written and read by the TransportLayer class directly or as dataclass fields.
+
+    Notes:
+        The fields are packed in order, starting from the least significant bit of the first byte, and each field's
+        value is stored least significant bit first. This matches the layout of the C++ bit-field structure members
+        produced by the GCC and Clang compilers on little-endian microcontrollers. The data block is padded with zero
+        bits to a whole number of bytes.
+
+    Args:
+        values: The one-dimensional numpy array that stores the values of all fields. Has to use the bool or one of the
+            unsigned integer datatypes.
+        widths: The bit width of each field. If an integer, all fields use the same width. If a tuple or an array, it
+            has to provide the width of each field. Each width has to be between 1 and the bit size of the values'
+            datatype.
+
+    Attributes:
+        values: Stores the values of all fields.
+        widths: Stores the bit width of each field as a uint8 numpy array.
 
     Raises:
-        TypeError: If any of the input arguments are not of the expected type.
-        ValueError: If any of the input arguments have invalid values.
+        TypeError: If the values are not a numpy array with a supported datatype.
+        ValueError: If the values are not a one-dimensional non-empty array or the widths are not valid for the values.
     """
 
-    _accepted_numpy_scalars: tuple[
-        type[np.uint8],
-        type[np.uint16],
-        type[np.uint32],
-        type[np.uint64],
-        type[np.int8],
-        type[np.int16],
-        type[np.int32],
-        type[np.int64],
-        type[np.float32],
-        type[np.float64],
-        type[np.bool],
-    ] = (
+    __slots__ = ("values", "widths")
+
+    _accepted_numpy_types: tuple[type[np.bool], type[np.uint8], type[np.uint16], type[np.uint32], type[np.uint64]] = (
+        np.bool,
         np.uint8,
         np.uint16,
         np.uint32,
         np.uint64,
-        np.int8,
-        np.int16,
-        np.int32,
-        np.int64,
-        np.float32,
-        np.float64,
-        np.bool,
-    )  # Sets up a tuple of types used to verify the transmitted data
-
-    def __init__(
-        self,
-        port: str,
-        microcontroller_serial_buffer_size: int,
-        baudrate: int,
-        polynomial: CRCType = _POLYNOMIAL,
-        initial_crc_value: CRCType = _ZERO,
-        final_crc_xor_value: CRCType = _ZERO,
-        *,
-        test_mode: bool = False,
-    ) -> None:
-        # Tracks whether the serial port is open. This is used solely to avoid a __del__ error during testing.
-        self._opened: bool = False
+    )
 
-        # Verifies that input arguments are valid. Does not check polynomial parameters that are offloaded to the
-        # CRCProcessor class.
-        if not isinstance(port, str):
+    def __init__(self, values: NDArray[Any], widths: int | tuple[int, ...] | NDArray[np.uint8] = 1) -> None:
+        if not isinstance(values, np.ndarray) or values.dtype not in self._accepted_numpy_types:
             message = (
-                f"Unable to initialize TransportLayer class. Expected a string value for 'port' argument, but "
-                f"encountered {port} of type {type(port).__name__}."
+                f"Unable to initialize BitField class. Expected a numpy array with one of the supported datatypes "
+                f"{self._accepted_numpy_types} for 'values' argument, but encountered {values} of type "
+                f"{type(values).__name__}."
             )
             console.error(message=message, error=TypeError)
 
-        if not isinstance(baudrate, int) or baudrate <= 0:
+        if values.ndim != 1 or values.size == 0:
             message = (
-                f"Unable to initialize TransportLayer class. Expected a positive integer value for 'baudrate' "
-                f"argument, but encountered {baudrate} of type {type(baudrate).__name__}."
+                f"Unable to initialize BitField class. Expected a one-dimensional non-empty numpy array for 'values' "
+                f"argument, but encountered an array with {values.ndim} dimensions and {values.size} elements."
             )
             console.error(message=message, error=ValueError)
 
-        if not isinstance(microcontroller_serial_buffer_size, int) or microcontroller_serial_buffer_size < 1:
+        field_widths = np.broadcast_to(np.asarray(widths), values.shape) if np.ndim(widths) == 0 else np.asarray(widths)
+        maximum_width = values.itemsize * 8 if values.dtype != np.bool else 1
+        if (
+            field_widths.shape != values.shape
+            or not np.issubdtype(field_widths.dtype, np.integer)
+            or field_widths.min() < 1
+            or field_widths.max() > maximum_width
+        ):
             message = (
-                f"Unable to initialize TransportLayer class. Expected a positive integer value for "
-                f"'microcontroller_serial_buffer_size' argument, but encountered {microcontroller_serial_buffer_size} "
-                f"of type {type(microcontroller_serial_buffer_size).__name__}."
+                f"Unable to initialize BitField class. Expected an integer between 1 and {maximum_width} or a sequence "
+                f"of {values.size} such integers for 'widths' argument, but encountered {widths}."
             )
             console.error(message=message, error=ValueError)
 
-        # Based on the class runtime selector, initializes a real or mock serial port manager class
-        self._port: SerialMock | Serial
-        if not test_mode:
-            # Statically disables built-in timeout. Our jit- and c-extension classes are more optimized for this job
-            # than Serial's built-in timeout.
-            self._port = Serial(port, baudrate, timeout=0)  # pragma: no cover
-        else:
-            self._port = SerialMock()
+        self.values: NDArray[Any] = values
+        self.widths: NDArray[np.uint8] = field_widths.astype(np.uint8)
 
-        # This verifies input polynomial parameters at class initialization time
-        self._crc_processor = CRCProcessor(polynomial, initial_crc_value, final_crc_xor_value)
-        self._cobs_processor = COBSProcessor()
+    def __repr__(self) -> str:
+        """Returns a string representation of the BitField instance."""
+        return f"BitField(values={self.values.tolist()}, widths={self.widths.tolist()})"
 
-        # On very fast CPUs, the timer can be sub-microsecond precise. On older systems, this may not necessarily hold.
-        # Either way, microsecond precision is safe for most target systems.
-        self._timer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+    @property
+    def nbytes(self) -> int:
+        """Returns the number of bytes used to serialize the bit field."""
+        return (int(self.widths.sum()) + 7) // 8
 
-        # Initializes serial packet attributes and casts all to numpy types.
-        self._start_byte: np.uint8 = np.uint8(129)
-        self._delimiter_byte: np.uint8 = np.uint8(0)
-        self._timeout: int = 10000
-        self._postamble_size: np.uint8 = self._crc_processor.crc_byte_length
 
-        # Initializes reception and transmission buffers.
-        self._max_tx_payload_size: np.uint8 = np.uint8(min((microcontroller_serial_buffer_size - 8), 254))
-        self._max_rx_payload_size: np.uint8 = np.uint8(min((microcontroller_serial_buffer_size - 8), 254))
-        self._min_rx_payload_size: np.uint8 = np.uint8(1)
+@njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+def _zigzag_encode(value: np.uint64) -> np.uint64:
+    """Maps the signed 64-bit two's complement value to an unsigned value, so that small negative and positive values
+    map to small unsigned values (0 → 0, -1 → 1, 1 → 2, -2 → 3, ...).
+    """
+    sign_mask = np.uint64(0xFFFFFFFFFFFFFFFF) if value >> np.uint64(63) else np.uint64(0)
+    return (value << np.uint64(1)) ^ sign_mask
 
-        # Buffer sizes are up-case to uint16, as they may need to exceed the 256-size limit. They include the respective
-        # payload size, the postamble size (1 to 4 bytes) and 4 static bytes for the preamble and packet metadata.
-        # These 4 bytes are: start_byte, delimiter_byte, overhead_byte, and packet_size byte.
-        tx_buffer_size: np.uint16 = np.uint16(self._max_tx_payload_size) + 4 + np.uint16(self._postamble_size)
-        rx_buffer_size: np.uint16 = np.uint16(self._max_rx_payload_size) + 4 + np.uint16(self._postamble_size)
-        self._transmission_buffer: NDArray[np.uint8] = np.zeros(shape=tx_buffer_size, dtype=np.uint8)
-        self._reception_buffer: NDArray[np.uint8] = np.empty(shape=rx_buffer_size, dtype=np.uint8)
 
-        # Based on the minimum expected payload size, calculates the minimum number of bytes that can fully represent
-        # a packet. This is used to avoid costly pySerial calls unless there is a high chance that the call will return
-        # a parsable packet.
-        self._minimum_packet_size: int = int(self._min_rx_payload_size) + 4 + int(self._postamble_size)
+@njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+def _zigzag_decode(value: np.uint64) -> np.uint64:
+    """Reverses the _zigzag_encode() mapping, returning the signed value as a 64-bit two's complement bit pattern."""
+    sign_mask = np.uint64(0xFFFFFFFFFFFFFFFF) if value & np.uint64(1) else np.uint64(0)
+    return (value >> np.uint64(1)) ^ sign_mask
 
-        # Sets up various tracker and temporary storage variables that supplement class runtime.
-        self._bytes_in_transmission_buffer: int = 0
-        self._bytes_in_reception_buffer: int = 0
-        self._consumed_bytes: int = 0
-        self._leftover_bytes: bytes = b""  # Placeholder, this is re-initialized as needed during data reception.
 
-        # Opens (connects to) the serial port. Cycles closing and opening to ensure the port is opened,
-        # non-graciously replacing whatever is using the port at the time of instantiating TransportLayer class.
-        # This non-safe procedure was implemented to avoid a frequent issue with Windows taking a long time to release
-        # COM ports, preventing quick connection cycling.
-        self._port.close()
-        self._port.open()
-        self._opened = True
+@njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+def _varint_sizes(bits: NDArray[np.uint64], signed: bool, delta: bool) -> NDArray[np.uint8]:
+    """Computes the number of bytes used to store each LEB128-encoded value.
 
-    def __del__(self) -> None:
-        """Ensures that the instance releases all resources prior to being garbage-collected."""
-        # Closes the port before deleting the class instance. Not strictly required, but helpful to ensure resources
-        # are released
+    Args:
+        bits: The values to encode as 64-bit two's complement bit patterns.
+        signed: Determines whether the values (or their deltas) are zigzag-encoded.
+        delta: Determines whether each value is encoded as the difference from the previous value.
+
+    Returns:
+        The array that stores the encoded size of each value, in bytes.
+    """
+    sizes = np.empty(bits.size, dtype=np.uint8)
+    previous = np.uint64(0)
+    for i in range(bits.size):
+        if delta:
+            value = _zigzag_encode(bits[i] - previous)
+        elif signed:
+            value = _zigzag_encode(bits[i])
+        else:
+            value = bits[i]
+        previous = bits[i]
+
+        size = 1
+        while value >= np.uint64(0x80):
+            value >>= np.uint64(7)
+            size += 1
+        sizes[i] = size
+    return sizes
+
+
+class VarintArray:
+    """Stores the integer array that is serialized using the variable-length (LEB128) integer encoding.
+
+    Each value is stored using 7 bits per byte, with the most significant bit of each byte marking whether the value
+    continues in the next byte. Small values use fewer bytes than their fixed-width representation, for example, any
+    value below 128 uses a single byte. Signed values are zigzag-encoded before serialization, so that small negative
+    values also use few bytes. If delta encoding is enabled, each value is stored as the (zigzag-encoded) difference
+    from the previous value, which compresses slowly changing time-series data, such as encoder counts or timestamps.
+    VarintArray instances can be written and read by the TransportLayer class directly or as dataclass fields.
+
+    Notes:
+        The number of bytes used by the serialized array depends on its values. When reading the data, the prototype
+        determines the number of values to read, its datatype, and whether to use the delta encoding.
+
+        The delta of the first value is computed relative to 0. All arithmetic uses 64-bit wrap-around, so any array
+        can be encoded, but arrays with large jumps between consecutive values may use more bytes than their
+        fixed-width representation.
+
+    Args:
+        values: The one-dimensional numpy array that stores the values to serialize. Has to use one of the signed or
+            unsigned integer datatypes.
+        delta: Determines whether to store each value as the difference from the previous value.
+
+    Attributes:
+        values: Stores the serialized values.
+        delta: Determines whether the values are serialized using the delta encoding.
+
+    Raises:
+        TypeError: If the values are not a numpy array with a supported datatype.
+        ValueError: If the values are not a one-dimensional non-empty array.
+    """
+
+    __slots__ = ("delta", "values")
+
+    _accepted_numpy_types: tuple[
+        type[np.uint8],
+        type[np.uint16],
+        type[np.uint32],
+        type[np.uint64],
+        type[np.int8],
+        type[np.int16],
+        type[np.int32],
+        type[np.int64],
+    ] = (np.uint8, np.uint16, np.uint32, np.uint64, np.int8, np.int16, np.int32, np.int64)
+
+    def __init__(self, values: NDArray[Any], *, delta: bool = False) -> None:
+        if not isinstance(values, np.ndarray) or values.dtype not in self._accepted_numpy_types:
+            message = (
+                f"Unable to initialize VarintArray class. Expected a numpy array with one of the supported datatypes "
+                f"{self._accepted_numpy_types} for 'values' argument, but encountered {values} of type "
+                f"{type(values).__name__}."
+            )
+            console.error(message=message, error=TypeError)
+
+        if values.ndim != 1 or values.size == 0:
+            message = (
+                f"Unable to initialize VarintArray class. Expected a one-dimensional non-empty numpy array for "
+                f"'values' argument, but encountered an array with {values.ndim} dimensions and {values.size} elements."
+            )
+            console.error(message=message, error=ValueError)
+
+        self.values: NDArray[Any] = values
+        self.delta: bool = delta
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the VarintArray instance."""
+        return f"VarintArray(values={self.values.tolist()}, delta={self.delta})"
+
+    @property
+    def signed(self) -> bool:
+        """Returns True if the values are zigzag-encoded before serialization."""
+        return self.delta or np.issubdtype(self.values.dtype, np.signedinteger)
+
+    @property
+    def bits(self) -> NDArray[np.uint64]:
+        """Returns the values as 64-bit two's complement bit patterns used by the encoding kernels."""
+        if np.issubdtype(self.values.dtype, np.signedinteger):
+            return self.values.astype(np.int64).view(np.uint64)
+        return self.values.astype(np.uint64)
+
+    @property
+    def nbytes(self) -> int:
+        """Returns the number of bytes used to serialize the current values."""
+        return int(_varint_sizes(self.bits, self.signed, self.delta).sum())
+
+    def from_bits(self, bits: NDArray[np.uint64]) -> "VarintArray":
+        """Creates a new VarintArray instance that uses the datatype and the encoding of this instance to store the
+        values decoded from the input 64-bit bit patterns.
+        """
+        if np.issubdtype(self.values.dtype, np.signedinteger):
+            return VarintArray(bits.view(np.int64).astype(self.values.dtype), delta=self.delta)
+        return VarintArray(bits.astype(self.values.dtype), delta=self.delta)
+
+
+# Resolve the datatypes and shapes of the arrays verified by the MessageLayout class with a single C-level call.
+_ARRAY_DTYPE = attrgetter("dtype")
+_ARRAY_SHAPE = attrgetter("shape")
+
+
+class MessageLayout:
+    """Stores the precomputed structure of a message made out of numpy scalars, numpy arrays, and dataclasses.
+
+    The TransportLayer's write_many() and read_many() methods use the layout to skip resolving, validating, and
+    flattening the message's objects during each call. Instead, they only verify that the objects match the layout:
+    write_many() gathers the data of all objects via the buffer protocol and copies it as a single block, and
+    read_many() distributes the message's data to the returned objects directly from the reception buffer. The layout
+    does not store any data and can be shared by any number of TransportLayer instances and threads.
+
+    Notes:
+        The message's objects have to use the same types as the prototypes, and the message's arrays have to use the
+        same datatypes and shapes as the prototype arrays. Dataclasses are flattened into the values of their fields,
+        which have to follow the same rules.
+
+        Only C-contiguous arrays support the buffer protocol. If the written message includes an array with a
+        different memory layout, write_many() falls back to the compiled copy pass used without the layout.
+
+    Args:
+        *prototypes: The numpy scalars, numpy arrays, or python dataclasses that make up the message, in the order in
+            which their data is stored in the payload. Supported numpy types are: uint8, uint16, uint32, uint64, int8,
+            int16, int32, int64, float32, float64, and bool. Arrays have to be non-empty.
+
+    Attributes:
+        nbytes: The size of the message's data, in bytes.
+        object_types: The type of each top-level object of the message.
+        field_types: The type of each numpy scalar and array that makes up the message after flattening the
+            dataclasses.
+        array_getter: The callable that returns the tuple of arrays that make up the message after flattening the
+            dataclasses, or None if the message does not include arrays.
+        array_dtypes: The datatype of each array that makes up the message after flattening the dataclasses.
+        array_shapes: The shape of each array that makes up the message after flattening the dataclasses.
+        specifications: The datatype, the shape, the offset inside the message's data block, and the scalar flag of
+            each numpy scalar and array that makes up the message after flattening the dataclasses.
+        getters: For each top-level object, the callable that returns the values of the dataclass's (nested) fields
+            and the number of these fields, or None if the object is not a dataclass.
+        setters: For each top-level object, the (owner getter, field name) pairs used to assign the values of the
+            dataclass's (nested) fields, or None if the object is not a dataclass. The owner getter is None for the
+            fields of the top-level dataclass.
+        has_dataclasses: Determines whether any top-level object of the message is a dataclass.
+
+    Raises:
+        TypeError: If any prototype is not a supported numpy scalar, numpy array, or python dataclass.
+        ValueError: If no prototypes are provided or any prototype is an empty numpy array.
+    """
+
+    __slots__ = (
+        "array_dtypes",
+        "array_getter",
+        "array_shapes",
+        "field_types",
+        "getters",
+        "has_dataclasses",
+        "nbytes",
+        "object_types",
+        "setters",
+        "specifications",
+    )
+
+    def __init__(self, *prototypes: Any) -> None:
+        if not prototypes:
+            message = "Unable to initialize MessageLayout class. Expected at least one prototype, but encountered none."
+            console.error(message=message, error=ValueError)
+
+        getters: list[tuple[Callable[[Any], Any], int] | None] = []
+        setters: list[tuple[tuple[Callable[[Any], Any] | None, str], ...] | None] = []
+        flattened: list[Any] = []
+        for prototype in prototypes:
+            if is_dataclass(prototype) and not isinstance(prototype, type):
+                paths = self._resolve_paths(data_object=prototype, prefix="")
+                getters.append((attrgetter(*paths), len(paths)))
+                setters.append(
+                    tuple(
+                        (attrgetter(path.rpartition(".")[0]) if "." in path else None, path.rpartition(".")[2])
+                        for path in paths
+                    )
+                )
+                flattened.extend(attrgetter(path)(prototype) for path in paths)
+            else:
+                getters.append(None)
+                setters.append(None)
+                flattened.append(prototype)
+
+        specifications: list[tuple[np.dtype[Any], tuple[int, ...], int, bool]] = []
+        offset = 0
+        for field in flattened:
+            if isinstance(field, np.ndarray) and field.dtype in TransportLayer._accepted_dtypes:
+                if field.size == 0:
+                    message = (
+                        "Unable to initialize MessageLayout class. Encountered an empty (size 0) numpy array as one of "
+                        "the prototypes. Empty arrays are not supported."
+                    )
+                    console.error(message=message, error=ValueError)
+                specifications.append((field.dtype, field.shape, offset, False))
+            elif type(field) in TransportLayer._accepted_scalar_types:
+                specifications.append((field.dtype, (), offset, True))
+            else:
+                message = (
+                    f"Unable to initialize MessageLayout class. Encountered an unsupported prototype type "
+                    f"({type(field).__name__}). The layout only supports the following numpy scalar or array types: "
+                    f"{TransportLayer._accepted_numpy_scalars}, and dataclasses with all attributes set to supported "
+                    f"numpy scalar or array types."
+                )
+                console.error(message=message, error=TypeError)
+            offset += field.nbytes
+
+        self.nbytes: int = offset
+        self.object_types: tuple[type[Any], ...] = tuple(map(type, prototypes))
+        self.field_types: tuple[type[Any], ...] = tuple(map(type, flattened))
+        # Resolves the arrays with a single C-level call. Single-index getters use a slice to also return a tuple.
+        array_indices = [index for index, (_, _, _, scalar) in enumerate(specifications) if not scalar]
+        self.array_getter: Callable[[tuple[Any, ...]], tuple[Any, ...]] | None = None
+        if len(array_indices) == 1:
+            self.array_getter = itemgetter(slice(array_indices[0], array_indices[0] + 1))
+        elif array_indices:
+            self.array_getter = itemgetter(*array_indices)
+        self.array_dtypes: tuple[np.dtype[Any], ...] = tuple(specifications[index][0] for index in array_indices)
+        self.array_shapes: tuple[tuple[int, ...], ...] = tuple(specifications[index][1] for index in array_indices)
+        self.specifications: tuple[tuple[np.dtype[Any], tuple[int, ...], int, bool], ...] = tuple(specifications)
+        self.getters: tuple[tuple[Callable[[Any], Any], int] | None, ...] = tuple(getters)
+        self.setters: tuple[tuple[tuple[Callable[[Any], Any] | None, str], ...] | None, ...] = tuple(setters)
+        self.has_dataclasses: bool = any(getter is not None for getter in getters)
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the MessageLayout instance."""
+        return f"MessageLayout(field_count={len(self.field_types)}, nbytes={self.nbytes})"
+
+    @staticmethod
+    def _resolve_paths(data_object: Any, prefix: str) -> list[str]:
+        """Returns the dotted attribute paths of all non-dataclass fields of the input dataclass, including the fields
+        of the nested dataclasses, in the order of their data.
+        """
+        paths: list[str] = []
+        # noinspection PyDataclass
+        for field in fields(data_object):
+            value = getattr(data_object, field.name)
+            if is_dataclass(value) and not isinstance(value, type):
+                paths.extend(MessageLayout._resolve_paths(data_object=value, prefix=f"{prefix}{field.name}."))
+            else:
+                paths.append(f"{prefix}{field.name}")
+        return paths
+
+    def flatten(self, data_objects: tuple[Any, ...], operation: str) -> tuple[Any, ...]:
+        """Flattens the input message objects into the sequence of numpy scalars and arrays described by the layout.
+
+        Args:
+            data_objects: The objects that make up the message.
+            operation: The performed operation, either 'write' or 'read'.
+
+        Returns:
+            A tuple that stores the numpy scalars and arrays that make up the input objects, in the order of their data.
+
+        Raises:
+            TypeError: If the input objects do not match the layout.
+        """
+        objects: Any = data_objects
+        matches = tuple(map(type, data_objects)) == self.object_types
+        if matches and self.has_dataclasses:
+            objects = []
+            for data_object, getter in zip(data_objects, self.getters, strict=True):
+                if getter is None:
+                    objects.append(data_object)
+                elif getter[1] == 1:
+                    objects.append(getter[0](data_object))
+                else:
+                    objects.extend(getter[0](data_object))
+            objects = tuple(objects)
+            matches = tuple(map(type, objects)) == self.field_types
+        if matches and self.array_getter is not None:
+            arrays = self.array_getter(objects)
+            matches = (
+                tuple(map(_ARRAY_DTYPE, arrays)) == self.array_dtypes
+                and tuple(map(_ARRAY_SHAPE, arrays)) == self.array_shapes
+            )
+
+        if not matches:
+            message = (
+                f"Failed to {operation} the data using the MessageLayout. The input objects do not match the layout: "
+                f"the message's objects have to use the same types as the layout's prototypes, and the message's "
+                f"arrays have to use the same datatypes and shapes as the prototype arrays. Layout: {self}."
+            )
+            console.error(message=message, error=TypeError)
+        return tuple(objects)
+
+    def unpack(
+        self, buffer: NDArray[np.uint8], start_index: int, data_objects: tuple[Any, ...], objects: tuple[Any, ...]
+    ) -> tuple[Any, ...]:
+        """Distributes the message's data stored in the input buffer to the objects that make up the message.
+
+        Numpy scalars are replaced with the new scalars read from the buffer. Writeable arrays are filled in place, and
+        read-only arrays are replaced with the new arrays that store a copy of their data. The fields of dataclasses are
+        set to the read values. The returned objects do not reference the buffer.
+
+        Args:
+            buffer: The buffer that stores the message's data.
+            start_index: The index of the buffer at which the message's data starts.
+            data_objects: The prototype objects passed to read_many().
+            objects: The flattened prototype objects returned by the flatten() method.
+
+        Returns:
+            A tuple that stores the deserialized objects in the same order as the input prototypes.
+        """
+        values: list[Any] = []
+        for (dtype, shape, offset, scalar), prototype in zip(self.specifications, objects, strict=True):
+            field = np.ndarray(shape, dtype, buffer, start_index + offset)
+            if scalar:
+                values.append(field[()])
+            elif prototype.flags.writeable:
+                prototype[...] = field
+                values.append(prototype)
+            else:
+                values.append(field.copy())
+        if not self.has_dataclasses:
+            return tuple(values)
+
+        restored: list[Any] = []
+        field_values = iter(values)
+        for data_object, setters in zip(data_objects, self.setters, strict=True):
+            if setters is None:
+                restored.append(next(field_values))
+                continue
+            for owner, name in setters:
+                setattr(data_object if owner is None else owner(data_object), name, next(field_values))
+            restored.append(data_object)
+        return tuple(restored)
+
+
+@dataclass(frozen=True)
+class RealTimeReport:
+    """Summarizes the operating system settings applied by a TransportLayer real-time session and the packet reception
+    latency achieved during the session.
+
+    All latency values are given in microseconds and describe the duration of the successful receive_data() calls made
+    during the session. If the session did not receive any packets, all latency values are set to 0.
+    """
+
+    cpu_core: int | None
+    """The index of the CPU core to which the session's thread was pinned or None if pinning was not requested or
+    failed."""
+    fifo_priority: int | None
+    """The SCHED_FIFO priority assigned to the session's thread or None if it was not requested or failed."""
+    memory_locked: bool
+    """Determines whether the process's memory was locked into RAM via mlockall()."""
+    gc_disabled: bool
+    """Determines whether the cyclic garbage collector was disabled for the duration of the session, either by the
+    session itself or by another active session."""
+    packet_count: int
+    """The number of packets received during the session."""
+    median_latency: float
+    """The median packet reception latency."""
+    p99_latency: float
+    """The 99th percentile of the packet reception latency."""
+    p999_latency: float
+    """The 99.9th percentile of the packet reception latency."""
+    maximum_latency: float
+    """The maximum packet reception latency."""
+
+
+@dataclass(frozen=True)
+class TransmissionReport:
+    """Summarizes the outbound latency of the packets sent while the TransportLayer transmission tracking was active.
+
+    The outbound latency of each packet is the time between the moment it was handed off to the transmission path
+    (enqueued) and the moment the serial port's driver finished transmitting (drained) its last byte. All latency values
+    are given in microseconds. If no tracked packets were drained, all latency values are set to 0.
+    """
+
+    packet_count: int
+    """The number of tracked packets that were drained before the tracking stopped."""
+    pending_count: int
+    """The number of tracked packets that were not drained before the tracking stopped."""
+    failed_count: int
+    """The number of tracked packets that were lost because the serial port was reopened before the packets were
+    drained."""
+    median_latency: float
+    """The median outbound packet latency."""
+    p99_latency: float
+    """The 99th percentile of the outbound packet latency."""
+    p999_latency: float
+    """The 99.9th percentile of the outbound packet latency."""
+    maximum_latency: float
+    """The maximum outbound packet latency."""
+    histogram: tuple[int, ...]
+    """The number of packets in each outbound latency bin. The first bin counts the latencies below 2 microseconds, and
+    each following bin i counts the latencies from 2 ** i up to 2 ** (i + 1) microseconds. The last bin also counts all
+    longer latencies."""
+    timestamps: NDArray[np.uint64]
+    """The two-dimensional array that stores the enqueue and drain timestamps of the most recent drained packets as
+    rows, in the order the packets were sent. The timestamps are given in nanoseconds of the time.perf_counter_ns()
+    clock."""
+
+
+@dataclass(frozen=True)
+class MicrocontrollerCapabilities:
+    """Stores the configuration and the capabilities reported by the microcontroller during the connection handshake."""
+
+    protocol_version: int
+    """The version of the connection handshake protocol used by the microcontroller."""
+    buffer_size: int
+    """The size, in bytes, of the microcontroller's serial communication buffer."""
+    crc_byte_length: int
+    """The width of the CRC checksum used by the microcontroller, in bytes."""
+    polynomial: int
+    """The polynomial of the CRC checksum used by the microcontroller."""
+    initial_crc_value: int
+    """The initial value of the CRC checksum used by the microcontroller."""
+    final_crc_xor_value: int
+    """The final XOR value of the CRC checksum used by the microcontroller."""
+    framing_codecs: tuple[FramingCodec, ...]
+    """The framing codecs supported by the microcontroller."""
+    features: MicrocontrollerFeature
+    """The optional features supported by the microcontroller, including the features that this library does not
+    implement and the reserved bits."""
+
+
+@dataclass(frozen=True)
+class BaudrateMeasurement:
+    """Stores the results of the echo probes sent at a single baudrate by the probe_baudrate() method."""
+
+    baudrate: int
+    """The probed baudrate."""
+    probe_count: int
+    """The number of echo probes sent at the baudrate."""
+    error_count: int
+    """The number of probes that were lost, corrupted, or echoed with different data."""
+    error_rate: float
+    """The fraction of the sent probes that failed."""
+    throughput: float
+    """The number of probe payload bytes successfully transferred in both directions per second."""
+
+
+@dataclass(frozen=True)
+class BaudrateProbeReport:
+    """Summarizes the baudrate probing performed by the TransportLayer's probe_baudrate() method."""
+
+    baudrate: int | None
+    """The fastest probed baudrate at which all echo probes succeeded or None if all probed baudrates had errors."""
+    measurements: tuple[BaudrateMeasurement, ...]
+    """The measurements of each probed baudrate, in the order the baudrates were probed."""
+
+
+class _RealTimeSession:
+    """Stores the state of an active TransportLayer real-time session.
+
+    The session tracks which real-time features were successfully applied and the settings they replaced, so that the
+    TransportLayer class can restore the original settings when the session ends. It also stores the latencies of the
+    packets received during the session in a preallocated ring buffer.
+
+    Attributes:
+        cpu_core: The index of the CPU core to which the session's thread is pinned, if pinning succeeded.
+        fifo_priority: The SCHED_FIFO priority of the session's thread, if the priority change succeeded.
+        memory_locked: Tracks whether the session holds the process-wide memory lock.
+        gc_disabled: Tracks whether the session holds the process-wide garbage collector suppression.
+        previous_affinity: The CPU affinity of the session's thread before pinning.
+        previous_policy: The scheduling policy and priority of the session's thread before the priority change.
+        latencies: The ring buffer that stores the reception latencies of the most recent packets, in microseconds.
+        packet_count: Tracks the number of packets received during the session.
+        timer: The PrecisionTimer instance used to time packet reception.
+
+    Args:
+        latency_buffer_size: The number of the most recent reception latencies to keep.
+    """
+
+    def __init__(self, latency_buffer_size: int = _LATENCY_BUFFER_SIZE) -> None:
+        self.cpu_core: int | None = None
+        self.fifo_priority: int | None = None
+        self.memory_locked: bool = False
+        self.gc_disabled: bool = False
+        self.previous_affinity: set[int] | None = None
+        self.previous_policy: tuple[int, int] | None = None
+        # Initializes with a non-zero value to write (and, therefore, fault in) every page of the buffer.
+        self.latencies: NDArray[np.uint64] = np.ones(shape=latency_buffer_size, dtype=np.uint64)
+        self.packet_count: int = 0
+        self.timer: PrecisionTimer = PrecisionTimer(TimerPrecisions.MICROSECOND)
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the _RealTimeSession instance."""
+        return (
+            f"_RealTimeSession(cpu_core={self.cpu_core}, fifo_priority={self.fifo_priority}, "
+            f"memory_locked={self.memory_locked}, gc_disabled={self.gc_disabled}, packet_count={self.packet_count})"
+        )
+
+    def record(self, latency: int) -> None:
+        """Records the reception latency of a packet, overwriting the oldest latency if the buffer is full."""
+        self.latencies[self.packet_count % self.latencies.size] = latency
+        self.packet_count += 1
+
+    def report(self) -> RealTimeReport:
+        """Summarizes the session's settings and the recorded latencies as a RealTimeReport instance."""
+        latencies = self.latencies[: min(self.packet_count, self.latencies.size)]
+        median, p99, p999, maximum = (
+            np.percentile(latencies, (50, 99, 99.9, 100)) if latencies.size else (0.0, 0.0, 0.0, 0.0)
+        )
+        return RealTimeReport(
+            cpu_core=self.cpu_core,
+            fifo_priority=self.fifo_priority,
+            memory_locked=self.memory_locked,
+            gc_disabled=self.gc_disabled,
+            packet_count=self.packet_count,
+            median_latency=float(median),
+            p99_latency=float(p99),
+            p999_latency=float(p999),
+            maximum_latency=float(maximum),
+        )
+
+
+class _TransmissionTracker:
+    """Stores the state of the active TransportLayer transmission tracking.
+
+    The tracker stores the enqueue timestamp and the stream offset of each sent packet until the serial port's driver
+    drains the packet, after which it moves the packet's timestamps into a preallocated ring buffer. The pending packets
+    are drained in the order they were sent. If the serial port is reopened, the pending packets whose bytes were
+    handed off to the closed port's driver are counted as failed instead. All attributes, except for the events, are
+    accessed under the transmission lock.
+
+    Attributes:
+        timestamps: The ring buffer that stores the enqueue and drain timestamps of the most recent drained packets, in
+            nanoseconds.
+        packet_count: Tracks the number of drained packets.
+        failed_count: Tracks the number of packets lost when the serial port was reopened.
+        pending: The queue that stores the enqueue timestamp, the start offset, and the end offset of each packet that
+            has not been drained yet.
+        queued_bytes: Tracks the number of bytes handed off to the transmission path since the tracking started. The
+            end offset of each packet is the value of this tracker after the packet was enqueued.
+        wake: The event that wakes up the watcher thread when a new packet is enqueued.
+        stop: The event that stops the watcher thread.
+        thread: The watcher thread that waits for the serial port's driver to drain the pending packets.
+
+    Args:
+        latency_buffer_size: The number of the most recent drained packets whose timestamps to keep.
+    """
+
+    def __init__(self, latency_buffer_size: int = _LATENCY_BUFFER_SIZE) -> None:
+        self.timestamps: NDArray[np.uint64] = np.zeros(shape=(latency_buffer_size, 2), dtype=np.uint64)
+        self.packet_count: int = 0
+        self.failed_count: int = 0
+        self.pending: deque[tuple[int, int, int]] = deque()
+        self.queued_bytes: int = 0
+        self.wake: Event = Event()
+        self.stop: Event = Event()
+        self.thread: Thread | None = None
+
+    def __repr__(self) -> str:
+        """Returns a string representation of the _TransmissionTracker instance."""
+        return (
+            f"_TransmissionTracker(packet_count={self.packet_count}, pending_count={len(self.pending)}, "
+            f"failed_count={self.failed_count})"
+        )
+
+    def enqueue(self, packet_size: int) -> None:
+        """Records the enqueue timestamp and the offsets of a sent packet and wakes up the watcher thread."""
+        self.pending.append((time.perf_counter_ns(), self.queued_bytes, self.queued_bytes + packet_size))
+        self.queued_bytes += packet_size
+        self.wake.set()
+
+    def complete(self, drained_bytes: int) -> None:
+        """Records the drain timestamp of all pending packets that end at or before the input stream offset."""
+        timestamp = time.perf_counter_ns()
+        while self.pending and self.pending[0][2] <= drained_bytes:
+            index = self.packet_count % self.timestamps.shape[0]
+            self.timestamps[index, 0] = self.pending.popleft()[0]
+            self.timestamps[index, 1] = timestamp
+            self.packet_count += 1
+
+    def fail(self, handed_off_bytes: int) -> None:
+        """Counts all pending packets that start before the input stream offset as failed."""
+        while self.pending and self.pending[0][1] < handed_off_bytes:
+            self.pending.popleft()
+            self.failed_count += 1
+
+    def report(self) -> TransmissionReport:
+        """Summarizes the recorded timestamps as a TransmissionReport instance."""
+        # Rotates the ring buffer, so that the timestamps are ordered from the oldest to the newest packet.
+        size = self.timestamps.shape[0]
+        timestamps = (
+            np.roll(self.timestamps, -(self.packet_count % size), axis=0)
+            if self.packet_count > size
+            else self.timestamps[: self.packet_count].copy()
+        )
+        latencies = (timestamps[:, 1] - timestamps[:, 0]) / 1000
+        median, p99, p999, maximum = (
+            np.percentile(latencies, (50, 99, 99.9, 100)) if latencies.size else (0.0, 0.0, 0.0, 0.0)
+        )
+        bins = np.minimum(np.log2(np.maximum(latencies, 1)).astype(np.int64), _LATENCY_HISTOGRAM_BINS - 1)
+        return TransmissionReport(
+            packet_count=self.packet_count,
+            pending_count=len(self.pending),
+            failed_count=self.failed_count,
+            median_latency=float(median),
+            p99_latency=float(p99),
+            p999_latency=float(p999),
+            maximum_latency=float(maximum),
+            histogram=tuple(int(count) for count in np.bincount(bins, minlength=_LATENCY_HISTOGRAM_BINS)),
+            timestamps=timestamps,
+        )
+
+
+@dataclass(frozen=True)
+class _PacketPipeline:
+    """Stores the packet construction, parsing, and processing kernels specialized for a single TransportLayer
+    configuration.
+
+    The kernels implement the same logic as the generic _construct_packet(), _parse_packet(), and _process_packet()
+    methods, but have the start byte, the CRC parameters, the payload size limits, and the postamble size baked in as
+    compile-time constants. Since the framing processor is still passed as an argument, the same kernels are compiled
+    separately for each framing codec type.
+    """
+
+    construct_packet: Any
+    """Constructs the serial packet from the payload stored in the input buffer. Accepts the payload buffer, the
+    framing processor jitclass, and the payload size."""
+    parse_packet: Any
+    """Parses the packet from the unparsed serial stream bytes. Accepts the unparsed bytes, the framing processor
+    jitclass, and the iterative start_found, parsed_byte_count, and parsed_bytes arguments of _parse_packet()."""
+    process_packet: Any
+    """Verifies and decodes the parsed packet. Accepts the reception buffer, the packet size, and the framing processor
+    jitclass."""
+    verify_packet: Any
+    """Verifies the parsed packet and extracts its first payload byte without decoding the payload. Accepts the
+    reception buffer, the packet size, and the framing processor jitclass."""
+
+
+# Caches the specialized packet pipelines, so that all instances that share the same configuration reuse the compiled
+# kernels. The lock serializes the cache access when the instances are created from multiple threads.
+_PIPELINE_CACHE: dict[tuple[int, ...], _PacketPipeline] = {}
+_PIPELINE_LOCK = Lock()
+
+
+def _build_packet_pipeline(
+    start_byte: int,
+    crc_processor: CRCProcessor,
+    max_payload_size: int,
+    min_payload_size: int,
+    postamble_size: int,
+    *,
+    check_delimiter: bool,
+) -> _PacketPipeline:
+    """Returns the packet pipeline specialized for the input configuration, building it if it is not cached.
+
+    Notes:
+        Numba treats the variables captured by the kernel closures as compile-time constants. This allows the compiler
+        to fold the CRC width-specific shifts and masks, unroll the checksum postamble loops, and resolve the payload
+        size checks of the parser at compile time. The parser reuses the generic _parse_packet() logic by inlining it
+        into the specialized kernel, which propagates the constant arguments into its body.
+
+        Closures cannot be cached to disk, so the kernels are compiled the first time each configuration is used by
+        the process.
+
+    Args:
+        start_byte: The byte-value used to mark the beginning of each packet.
+        crc_processor: The CRCProcessor instance that provides the CRC parameters and the lookup table.
+        max_payload_size: The maximum size of the payload, in bytes, that can be received.
+        min_payload_size: The minimum size of the payload, in bytes, that can be received.
+        postamble_size: The number of bytes needed to store the CRC checksum and the forward error correction parity
+            bytes.
+        check_delimiter: Determines whether the parser verifies the delimiter byte of the encoded payload.
+
+    Returns:
+        The _PacketPipeline instance that stores the specialized kernels.
+    """
+    crc_byte_length = int(crc_processor.crc_byte_length)
+    initial_crc_value = int(crc_processor.initial_crc_value)
+    final_xor_value = int(crc_processor.final_xor_value)
+    key = (
+        start_byte,
+        int(crc_processor.polynomial),
+        crc_byte_length,
+        initial_crc_value,
+        final_xor_value,
+        max_payload_size,
+        min_payload_size,
+        postamble_size,
+        int(check_delimiter),
+    )
+    # Holds the lock while building the pipeline, so that the instances created concurrently with the same
+    # configuration share the kernels instead of each compiling their own copy.
+    with _PIPELINE_LOCK:
+        pipeline = _PIPELINE_CACHE.get(key)
+        if pipeline is not None:
+            return pipeline
+
+        # The checksum is accumulated in a 64-bit integer, so the width-specific truncation is a constant mask instead
+        # of a cast to the CRC's NumPy type.
+        crc_table = crc_processor.crc_table.copy()
+        crc_shift = 8 * (crc_byte_length - 1)
+        crc_mask = (1 << (8 * crc_byte_length)) - 1
+        parse_packet = njit(nogil=True, inline="always")(TransportLayer._parse_packet.py_func)
+
+        @njit(nogil=True, inline="always")  # type: ignore[untyped-decorator]
+        def calculate_checksum(buffer: NDArray[np.uint8], size: int) -> int:  # pragma: no cover
+            """Calculates the CRC checksum of the first 'size' bytes of the input buffer."""
+            checksum = initial_crc_value
+            for i in range(size):
+                checksum = ((checksum << 8) & crc_mask) ^ crc_table[((checksum >> crc_shift) ^ buffer[i]) & 0xFF]
+            return checksum ^ final_xor_value
+
+        @njit(nogil=True)  # type: ignore[untyped-decorator]
+        def construct_packet(
+            payload_buffer: NDArray[np.uint8], framing_processor: _FramingProcessor, payload_size: int
+        ) -> NDArray[np.uint8]:  # pragma: no cover
+            """Constructs the serial packet using the payload stored inside the input buffer."""
+            encoded = framing_processor.encode_payload(payload_buffer[:payload_size])
+            encoded_size = encoded.size
+
+            # Writes the preamble, the encoded payload, and the checksum postamble directly into the packet's buffer.
+            packet = np.empty(encoded_size + 2 + crc_byte_length, dtype=np.uint8)
+            packet[0] = start_byte
+            packet[1] = payload_size
+            packet[2 : encoded_size + 2] = encoded
+            checksum = calculate_checksum(encoded, encoded_size)
+            for i in range(crc_byte_length):
+                packet[encoded_size + 2 + i] = (checksum >> (8 * (crc_byte_length - i - 1))) & 0xFF
+            return packet
+
+        @njit(nogil=True)  # type: ignore[untyped-decorator]
+        def parse(
+            unparsed_bytes: NDArray[np.uint8],
+            framing_processor: _FramingProcessor,
+            start_found: bool,
+            parsed_byte_count: int,
+            parsed_bytes: NDArray[np.uint8],
+        ) -> tuple[int, int, NDArray[np.uint8], NDArray[np.uint8]]:  # pragma: no cover
+            """Parses as much of the incoming serialized packet's data as possible."""
+            return parse_packet(
+                unparsed_bytes,
+                start_byte,
+                framing_processor,
+                max_payload_size,
+                min_payload_size,
+                postamble_size,
+                start_found,
+                parsed_byte_count,
+                parsed_bytes,
+                check_delimiter,
+            )
+
+        @njit(nogil=True)  # type: ignore[untyped-decorator]
+        def process_packet(
+            reception_buffer: NDArray[np.uint8], packet_size: int, framing_processor: _FramingProcessor
+        ) -> int:  # pragma: no cover
+            """Validates the parsed packet, decodes its payload, and saves it back to the input reception_buffer."""
+            # Compares the checksum of the encoded payload to the packet's checksum postamble.
+            encoded_size = packet_size - crc_byte_length
+            checksum = calculate_checksum(reception_buffer, encoded_size)
+            for i in range(crc_byte_length):
+                if reception_buffer[encoded_size + i] != (checksum >> (8 * (crc_byte_length - i - 1))) & 0xFF:
+                    return 0
+
+            payload = framing_processor.decode_payload(reception_buffer[:encoded_size])
+            if payload.size == 0:
+                return 0
+
+            reception_buffer[: payload.size] = payload
+            return payload.size
+
+        @njit(nogil=True)  # type: ignore[untyped-decorator]
+        def verify_packet(
+            reception_buffer: NDArray[np.uint8], packet_size: int, framing_processor: _FramingProcessor
+        ) -> tuple[int, int]:  # pragma: no cover
+            """Validates the parsed packet and returns the size of its encoded payload and the first payload byte."""
+            encoded_size = packet_size - crc_byte_length
+            checksum = calculate_checksum(reception_buffer, encoded_size)
+            for i in range(crc_byte_length):
+                if reception_buffer[encoded_size + i] != (checksum >> (8 * (crc_byte_length - i - 1))) & 0xFF:
+                    return 0, -1
+            return encoded_size, framing_processor.peek_byte(reception_buffer[:encoded_size])
+
+        pipeline = _PacketPipeline(
+            construct_packet=construct_packet,
+            parse_packet=parse,
+            process_packet=process_packet,
+            verify_packet=verify_packet,
+        )
+        _PIPELINE_CACHE[key] = pipeline
+        return pipeline
+
+
+class TransportLayer:
+    """Provides methods for sending and receiving serialized data over the USB and UART communication interfaces.
+
+    This class instantiates and manages all library assets used to transcode, validate, and bidirectionally transfer
+    serial data over the target communication interface. Critically, this includes the transmission and reception
+    buffers that are used to temporarily store the outgoing and incoming data payloads. All user-facing class methods
+    interact with the data stored in one of these buffers.
+
+    Args:
+        port: The name of the serial port to connect to, e.g.: 'COM3' or '/dev/ttyUSB0'. Use the 'axtl-ports' CLI
+            command to discover available port names.
+        microcontroller_serial_buffer_size: The size, in bytes, of the buffer used by the connected microcontroller's
+            serial communication interface. Usually, this information is available from the microcontroller's
+            manufacturer (UART / USB controller specification).
+        baudrate: The baudrate to use for communication if the microcontroller uses the UART interface. Should match
+            the value used by the microcontroller. This parameter is ignored when using the USB interface.
+        polynomial: The polynomial to use for the generation of the CRC lookup table. The polynomial must
+            be standard (non-reflected / non-reversed).
+        initial_crc_value: The value to which the CRC checksum is initialized before calculation.
+        final_crc_xor_value: The value with which the CRC checksum is XORed after calculation.
+        test_mode: Determines whether the instance uses a pySerial (real) or a StreamMock (mocked) communication
+            interface. This flag is used during testing and should be disabled for all production runtimes.
+        gil_free_reception: Determines whether the instance receives packets using the GIL-free reception engine. The
+            engine reads the serial port's file descriptor and parses, verifies, and decodes the packet inside a
+            single nopython function, allowing the reception to run in parallel with other Python threads. This
+            engine is only available on Linux and macOS and cannot be used together with the test_mode.
+        wait_strategy: The WaitStrategy instance that determines how the instance waits for the serial port to
+            receive new bytes. If None, the instance uses the spin strategy, which minimizes the reception latency at
+            the cost of fully occupying a CPU core while waiting.
+        fec_parity_size: The number of Reed-Solomon parity bytes appended to each packet to enable forward error
+            correction (FEC). Each packet can recover from up to fec_parity_size // 2 corrupted bytes. If 0, forward
+            error correction is disabled. Must match the value used by the microcontroller.
+        compression: Determines whether to compress the transmitted payloads using the byte-aligned Lempel-Ziv (LZ77)
+            scheme and to decompress the received payloads. Must match the configuration of the microcontroller.
+        delta_keyframe_interval: Determines how often the payloads are transmitted in full (as keyframes) when delta
+            transmission is enabled. Every delta_keyframe_interval-th payload is a keyframe, and the payloads between
+            the keyframes are transmitted as patches to the previous payload. If 0, delta transmission is disabled.
+            Must match the configuration of the microcontroller.
+        framing_codec: The FramingCodec member (or its string value) that determines the scheme used to delimit the
+            transmitted and received packets. Must match the configuration of the microcontroller.
+        specialized_pipeline: Determines whether the instance constructs, parses, and processes the packets using the
+            kernels specialized for its configuration instead of the generic JIT-compiled methods. The specialized
+            kernels are compiled the first time each configuration is used by the process and are shared by all
+            instances with the same configuration.
+        crc_preset: The CRCPreset member (or its string value) that specifies the standard CRC algorithm to use for
+            verifying the packets. If provided, it overrides the polynomial, initial_crc_value, and final_crc_xor_value
+            arguments. Must match the configuration of the microcontroller.
+        reception_slots: The number of reception slots (buffers) used to store the received payloads. With more than
+            one slot, the payloads held via the hold_payload() method stay valid while the instance receives the next
+            payloads into the other slots. The memory used by the slots is allocated at initialization and stays fixed.
+        lazy_decoding: Determines whether the instance defers decoding each received payload until it is first
+            accessed. When enabled, receive_data() only verifies the packet's CRC checksum, and the payload is decoded
+            by the first call that reads or accesses the reception buffer. Use the peek_payload() method to inspect the
+            first payload byte without decoding the payload. Cannot be used together with compression, delta
+            transmission, or the GIL-free reception engine.
+        transmission_ring_size: The size, in bytes, of the ring buffer that stores the packet bytes not yet accepted by
+            the serial port. If 0, the transmission methods block until the serial port accepts each whole packet.
+            Otherwise, the transmission methods only write the bytes that the serial port accepts without blocking and
+            store the rest in the ring, which is flushed by the next transmission method call or by the
+            flush_transmission() method. Must be able to store at least one packet of the maximum size.
+
+    Notes:
+        The transmission and reception state of the instance is stored in two independently locked objects. It is safe
+        to call the transmission methods (write_data(), send_data()) from one thread while another thread calls the
+        reception methods (available, receive_data(), read_data()). Calling the methods of the same direction from
+        multiple threads is also safe, but the calls are serialized and the order in which the payloads are staged or
+        consumed is not defined.
+
+        The instance does not rely on the GIL to protect its state, so it is also safe to use on free-threaded
+        (no-GIL) Python builds. All mutable state, including the packet counters, is owned by one of the two locked
+        path objects, and the shared COBS and CRC jitclass instances are never modified after initialization. Each
+        instance is fully independent, so separate instances (ports) driven from separate threads scale across CPU
+        cores on free-threaded builds.
+
+        When forward error correction is enabled, the Reed-Solomon parity bytes are appended after the CRC checksum
+        and protect the COBS-encoded payload and the checksum. The received packets are corrected before the CRC
+        verification, so the CRC check also verifies the correction. Since each protected block cannot exceed 255
+        bytes, the parity bytes reduce the maximum payload size. The preamble (start byte and payload size) is not
+        protected, so corrupting either of these bytes still causes the packet to be lost.
+
+        When compression is enabled, each payload is preceded by a 1-byte header that marks whether the rest of the
+        payload is compressed. The payload is only compressed if this makes it smaller, so incompressible payloads cost
+        exactly one extra byte. The header reduces the maximum transmitted and received payload size by one byte.
+
+        When delta transmission is enabled, each payload is preceded by a 2-byte header that stores the frame type and
+        the frame's sequence number. Delta frames only store the (offset, length, bytes) patches that convert the
+        previous payload into the current payload, and are only sent if they are smaller than the full payload. The
+        receiver rebuilds the full payload in its reception buffer. If the receiver detects a gap in the sequence
+        numbers, it rejects all delta frames until the next keyframe, so keyframes bound the number of payloads lost
+        to a single corrupted packet. The header reduces the maximum transmitted payload size by two bytes. If
+        compression is also enabled, the delta frames are compressed before transmission.
+
+        The framing codec is selected at initialization. Each codec is implemented as a separate jitclass, and the
+        JIT-compiled packet construction, parsing, and processing methods are compiled separately for each codec type,
+        so the codec is resolved at compile time rather than during packet processing. The COBS and COBS/R codecs never
+        expand the payload by more than 2 bytes. The SLIP and HDLC codecs add one byte per escaped payload byte, so the
+        reception buffer is sized for the worst case of twice the maximum payload size. Since the size of packets
+        encoded with codecs other than COBS depends on their contents, these codecs cannot be used together with
+        forward error correction. Regardless of the codec, the packets keep the start byte and payload size preamble
+        and append the CRC postamble after the delimiter, so the SLIP and HDLC packets are not wire-compatible with
+        standard SLIP or HDLC devices. Since the postamble is read by its size, the CRC bytes may contain the delimiter
+        value. The maximum transmitted payload size is reduced until the largest packet the codec can produce fits
+        into the microcontroller's serial buffer.
+
+        The generic packet processing methods receive the start byte, the payload size limits, and the postamble size
+        as runtime arguments, and the CRC jitclass selects its width-specific logic for each processed byte. When the
+        specialized pipeline is enabled, these values are instead captured as compile-time constants by a set of
+        kernels built for the instance's configuration, which allows the compiler to fold the CRC width-specific
+        shifts and unroll the postamble handling. The GIL-free reception engine always uses the generic methods.
+
+        When lazy decoding is enabled, the verified packet stays encoded in the reception buffer until the payload is
+        first accessed. Payloads that are dropped or replaced without being read (for example, after routing them by
+        their first byte) are never decoded. Since decoding the accessed payloads requires an additional JIT-compiled
+        function call, lazy decoding only reduces the reception cost if most payloads are dropped without being read.
+        The CRC checksum is verified during reception, so decoding the payload can only fail if the Microcontroller
+        uses a different framing codec, in which case the accessing call raises the error.
+
+        When the non-blocking transmission mode is enabled, a slow or stalled receiver fills the serial port's output
+        queue and then the transmission ring, instead of blocking the thread that sends the data. The transmitted bytes
+        always leave the instance in order, as the pending ring bytes are written before any new packet. If the ring
+        cannot store the next packet, the transmission method raises an error without sending the packet. Use the
+        set_transmission_watermarks() method to be notified when the transmission backlog (the pending ring bytes and
+        the bytes queued by the serial port) grows too large, so that the producers can throttle before the ring fills
+        up. The watermarks also work in the blocking mode, where the backlog only includes the serial port's queue.
+
+    Attributes:
+        _opened: Tracks whether the serial communication has been opened (the port has been connected).
+        _port: Depending on the test_mode flag, stores either a SerialMock or Serial object that provides the serial
+            communication interface.
+        _poller: Stores the poll object registered for the serial port's file descriptor, which is used to wait for
+            new bytes and to detect the port's hang-up, or None if the port does not expose a pollable descriptor.
+        _crc_processor: Stores the CRCProcessor instance that provides methods for working CRC checksums. The instance
+            is shared by all TransportLayer instances that use the same CRC parameters.
+        _framing_processor: Stores the COBSProcessor, COBSRProcessor, or ByteStuffingProcessor instance that provides
+            methods for encoding and decoding transmitted payloads, depending on the framing codec.
+        _start_byte: Stores the byte-value that marks the beginning of transmitted and received packets.
+        _delimiter_byte: Stores the byte-value that marks the end of transmitted and received packets.
+        _timeout: Stores the number of microseconds to wait between receiving any two consecutive bytes of a packet.
+        _max_tx_payload_size: Stores the maximum number of bytes that can be transmitted as a single payload.
+        _max_rx_payload_size: Stores the maximum number of bytes that can be received from the microcontroller as a
+            single payload.
+        _min_rx_payload_size: Stores the minimum number of bytes that can be received from the Microcontroller as a
+            single payload.
+        _postamble_size: Stores the combined byte-size of the CRC checksum and the forward error correction parity
+            bytes.
+        _fec_processor: Stores the ReedSolomonProcessor instance that provides methods for correcting the received
+            packets or None if forward error correction is disabled.
+        _lz_processor: Stores the LZProcessor instance that provides methods for compressing and decompressing the
+            payloads or None if compression is disabled.
+        _delta_keyframe_interval: Stores the number of payloads in each keyframe cycle or 0 if delta transmission is
+            disabled.
+        _tx: Stores the _TransmissionPath instance that owns the transmission buffer, its trackers, timer, and lock.
+        _rx: Stores the _ReceptionPath instance that owns the reception buffer, the unconsumed serial stream bytes, and
+            the reception timer and lock.
+        _accepted_numpy_scalars: Stores numpy types (classes) that can be used as scalar inputs or as 'dtype'
+            fields of the numpy arrays that are provided to class methods.
+        _accepted_scalar_types: Stores the accepted numpy scalar types as a set used by the scatter-gather methods.
+        _accepted_dtypes: Stores the datatypes of the accepted numpy scalar types as a set used by the scatter-gather
+            methods.
+        _minimum_packet_size: Stores the minimum number of bytes that can represent a valid packet. This value is used
+            to optimize packet reception logic.
+        _gil_free_reception: Determines whether the instance receives packets using the GIL-free reception engine.
+        _lazy_decoding: Determines whether the instance defers decoding the received payloads until they are accessed.
+        _max_packet_size: Stores the maximum number of bytes that can make up a single transmitted packet.
+        _real_time_session: Stores the _RealTimeSession instance of the active real-time session or None if no session
+            is active.
+        _wait_strategy: Stores the WaitStrategy instance used to wait for the serial port to receive new bytes.
+        _pipeline: Stores the _PacketPipeline instance that provides the kernels specialized for the instance's
+            configuration or None if the instance uses the generic packet processing methods.
+
+    Raises:
+        TypeError: If any of the input arguments are not of the expected type.
+        ValueError: If any of the input arguments have invalid values.
+    """
+
+    _accepted_numpy_scalars: tuple[
+        type[np.uint8],
+        type[np.uint16],
+        type[np.uint32],
+        type[np.uint64],
+        type[np.int8],
+        type[np.int16],
+        type[np.int32],
+        type[np.int64],
+        type[np.float32],
+        type[np.float64],
+        type[np.bool],
+    ] = (
+        np.uint8,
+        np.uint16,
+        np.uint32,
+        np.uint64,
+        np.int8,
+        np.int16,
+        np.int32,
+        np.int64,
+        np.float32,
+        np.float64,
+        np.bool,
+    )  # Sets up a tuple of types used to verify the transmitted data
+    # Mirrors the accepted types as hashed sets to support the constant-time type checks of the scatter-gather methods.
+    _accepted_scalar_types: frozenset[type[Any]] = frozenset(_accepted_numpy_scalars)
+    _accepted_dtypes: frozenset[np.dtype[Any]] = frozenset(np.dtype(scalar) for scalar in _accepted_numpy_scalars)
+
+    def __init__(
+        self,
+        port: str,
+        microcontroller_serial_buffer_size: int,
+        baudrate: int,
+        polynomial: CRCType = _POLYNOMIAL,
+        initial_crc_value: CRCType = _ZERO,
+        final_crc_xor_value: CRCType = _ZERO,
+        *,
+        test_mode: bool = False,
+        gil_free_reception: bool = False,
+        wait_strategy: WaitStrategy | None = None,
+        fec_parity_size: int = 0,
+        compression: bool = False,
+        delta_keyframe_interval: int = 0,
+        framing_codec: FramingCodec | str = FramingCodec.COBS,
+        specialized_pipeline: bool = False,
+        crc_preset: CRCPreset | str | None = None,
+        reception_slots: int = 1,
+        lazy_decoding: bool = False,
+        transmission_ring_size: int = 0,
+    ) -> None:
+        # Tracks whether the serial port is open. This is used solely to avoid a __del__ error during testing.
+        self._opened: bool = False
+
+        # Verifies that input arguments are valid. Does not check polynomial parameters that are offloaded to the
+        # CRCProcessor class.
+        if not isinstance(port, str):
+            message = (
+                f"Unable to initialize TransportLayer class. Expected a string value for 'port' argument, but "
+                f"encountered {port} of type {type(port).__name__}."
+            )
+            console.error(message=message, error=TypeError)
+
+        if not isinstance(baudrate, int) or baudrate <= 0:
+            message = (
+                f"Unable to initialize TransportLayer class. Expected a positive integer value for 'baudrate' "
+                f"argument, but encountered {baudrate} of type {type(baudrate).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        self._capabilities: MicrocontrollerCapabilities | None = None
+        self._configure(
+            microcontroller_serial_buffer_size=microcontroller_serial_buffer_size,
+            polynomial=polynomial,
+            initial_crc_value=initial_crc_value,
+            final_crc_xor_value=final_crc_xor_value,
+            test_mode=test_mode,
+            gil_free_reception=gil_free_reception,
+            wait_strategy=wait_strategy,
+            fec_parity_size=fec_parity_size,
+            compression=compression,
+            delta_keyframe_interval=delta_keyframe_interval,
+            framing_codec=framing_codec,
+            specialized_pipeline=specialized_pipeline,
+            crc_preset=crc_preset,
+            reception_slots=reception_slots,
+            lazy_decoding=lazy_decoding,
+            transmission_ring_size=transmission_ring_size,
+        )
+
+        # Stores the information used to reopen the serial port after the Microcontroller is disconnected. USB devices
+        # are located by their serial number, as the OS may assign a different port name to the reconnected device.
+        self._port_name: str = port
+        self._baudrate: int = baudrate
+        self._serial_number: str | None = None if test_mode else _find_serial_number(port)
+        self._port_lock: Lock = Lock()
+        self._connected: bool = False
+        self._reconnections: int = 0
+        self._reconnection_timeout: int = 0
+        self._initial_backoff: int = _RECONNECTION_BACKOFF
+        self._maximum_backoff: int = _MAXIMUM_RECONNECTION_BACKOFF
+
+        # Based on the class runtime selector, initializes a real or mock serial port manager class
+        self._port: SerialMock | Serial
+        if not test_mode:
+            # Statically disables built-in timeout. Our jit- and c-extension classes are more optimized for this job
+            # than Serial's built-in timeout.
+            self._port = Serial(port, baudrate, timeout=0)  # pragma: no cover
+            # On Windows, the non-blocking transmission mode relies on the pySerial's write() method, which only
+            # returns without waiting for the transmission to complete if the write timeout is 0.
+            if transmission_ring_size != 0 and sys.platform == "win32":  # pragma: no cover
+                self._port.write_timeout = 0
+        else:
+            self._port = SerialMock()
+
+        # Opens (connects to) the serial port. Cycles closing and opening to ensure the port is opened,
+        # non-graciously replacing whatever is using the port at the time of instantiating TransportLayer class.
+        # This non-safe procedure was implemented to avoid a frequent issue with Windows taking a long time to release
+        # COM ports, preventing quick connection cycling.
+        self._port.close()
+        self._port.open()
+        self._poller: select.poll | None = self._register_poller()
+        self._opened = True
+        self._connected = True
+
+    def _configure(
+        self,
+        microcontroller_serial_buffer_size: int,
+        polynomial: CRCType = _POLYNOMIAL,
+        initial_crc_value: CRCType = _ZERO,
+        final_crc_xor_value: CRCType = _ZERO,
+        *,
+        test_mode: bool = False,
+        gil_free_reception: bool = False,
+        wait_strategy: WaitStrategy | None = None,
+        fec_parity_size: int = 0,
+        compression: bool = False,
+        delta_keyframe_interval: int = 0,
+        framing_codec: FramingCodec | str = FramingCodec.COBS,
+        specialized_pipeline: bool = False,
+        crc_preset: CRCPreset | str | None = None,
+        reception_slots: int = 1,
+        lazy_decoding: bool = False,
+        transmission_ring_size: int = 0,
+    ) -> None:
+        """Verifies the configuration arguments and builds the processors, buffers, and paths used by the instance.
+
+        This worker method implements the configuration part of the __init__() method. The negotiate() method also uses
+        it to apply the negotiated configuration without reopening the serial port, which discards all staged, pending,
+        and received data of the previous configuration. The method does not access the serial port, and its arguments
+        match the arguments of the __init__() method.
+        """
+        if not isinstance(microcontroller_serial_buffer_size, int) or microcontroller_serial_buffer_size < 1:
+            message = (
+                f"Unable to initialize TransportLayer class. Expected a positive integer value for "
+                f"'microcontroller_serial_buffer_size' argument, but encountered {microcontroller_serial_buffer_size} "
+                f"of type {type(microcontroller_serial_buffer_size).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        # The GIL-free reception engine works with the file descriptor of the serial port, which is not available for
+        # the mocked serial port and Windows COM ports.
+        if gil_free_reception and (test_mode or sys.platform == "win32"):
+            message = (
+                f"Unable to initialize TransportLayer class. The GIL-free reception engine requires a real serial "
+                f"port on a Linux or macOS system, but test_mode is {test_mode} and the platform is {sys.platform}."
+            )
+            console.error(message=message, error=ValueError)
+        self._gil_free_reception: bool = gil_free_reception
+        self._real_time_session: _RealTimeSession | None = None
+
+        if wait_strategy is not None and not isinstance(wait_strategy, WaitStrategy):
+            message = (
+                f"Unable to initialize TransportLayer class. Expected a WaitStrategy instance or None for "
+                f"'wait_strategy' argument, but encountered {wait_strategy} of type {type(wait_strategy).__name__}."
+            )
+            console.error(message=message, error=TypeError)
+        self._wait_strategy: WaitStrategy = wait_strategy if wait_strategy is not None else WaitStrategy.spin()
+
+        # The GIL-free reception engine processes the whole packet inside a single nopython call and does not support
+        # the packet correction step.
+        if fec_parity_size != 0 and gil_free_reception:
+            message = (
+                f"Unable to initialize TransportLayer class. Forward error correction cannot be used together with "
+                f"the GIL-free reception engine, but fec_parity_size is {fec_parity_size} and gil_free_reception is "
+                f"{gil_free_reception}."
+            )
+            console.error(message=message, error=ValueError)
+
+        if not isinstance(delta_keyframe_interval, int) or delta_keyframe_interval < 0:
+            message = (
+                f"Unable to initialize TransportLayer class. Expected a non-negative integer value for "
+                f"'delta_keyframe_interval' argument, but encountered {delta_keyframe_interval} of type "
+                f"{type(delta_keyframe_interval).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+        self._delta_keyframe_interval: int = delta_keyframe_interval
+
+        if not isinstance(reception_slots, int) or reception_slots < 1:
+            message = (
+                f"Unable to initialize TransportLayer class. Expected a positive integer value for 'reception_slots' "
+                f"argument, but encountered {reception_slots} of type {type(reception_slots).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        # Compressed and delta-encoded payloads have to be decoded to be processed, and the GIL-free reception engine
+        # always decodes the packet inside its nopython call, so lazy decoding would not skip any work.
+        if lazy_decoding and (compression or delta_keyframe_interval != 0 or gil_free_reception):
+            message = (
+                f"Unable to initialize TransportLayer class. Lazy decoding cannot be used together with compression, "
+                f"delta transmission, or the GIL-free reception engine, but compression is {compression}, "
+                f"delta_keyframe_interval is {delta_keyframe_interval}, and gil_free_reception is {gil_free_reception}."
+            )
+            console.error(message=message, error=ValueError)
+        self._lazy_decoding: bool = lazy_decoding
+
+        if framing_codec not in tuple(FramingCodec):
+            message = (
+                f"Unable to initialize TransportLayer class. Expected a FramingCodec member or one of its values "
+                f"({', '.join(FramingCodec)}) for 'framing_codec' argument, but encountered {framing_codec} of type "
+                f"{type(framing_codec).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+        framing_codec = FramingCodec(framing_codec)
+
+        # Forward error correction disables the delimiter search, so the parser has to infer the size of the encoded
+        # payload from the payload size. This is only possible for COBS, the only codec with a fixed overhead.
+        if fec_parity_size != 0 and framing_codec != FramingCodec.COBS:
+            message = (
+                f"Unable to initialize TransportLayer class. Forward error correction can only be used together with "
+                f"the COBS framing codec, but fec_parity_size is {fec_parity_size} and framing_codec is "
+                f"{framing_codec}."
+            )
+            console.error(message=message, error=ValueError)
+
+        # This verifies the parity size at class initialization time
+        self._fec_processor: ReedSolomonProcessor | None = (
+            ReedSolomonProcessor(fec_parity_size) if fec_parity_size != 0 else None
+        )
+
+        # This verifies input polynomial parameters at class initialization time. The CRC processor is shared by all
+        # instances that use the same CRC parameters.
+        if crc_preset is not None:
+            self._crc_processor = CRCProcessor.from_preset(crc_preset)
+        else:
+            self._crc_processor = CRCProcessor.shared(polynomial, initial_crc_value, final_crc_xor_value)
+        self._framing_processor: FramingProcessor
+        if framing_codec == FramingCodec.COBS:
+            self._framing_processor = COBSProcessor()
+        elif framing_codec == FramingCodec.COBSR:
+            self._framing_processor = COBSRProcessor()
+        else:
+            self._framing_processor = ByteStuffingProcessor(scheme=framing_codec.value)
+
+        # Initializes serial packet attributes and casts all to numpy types. The delimiter is determined by the framing
+        # codec.
+        self._start_byte: np.uint8 = np.uint8(129)
+        self._delimiter_byte: np.uint8 = np.uint8(self._framing_processor.processor.delimiter)
+        self._timeout: int = 10000
+        self._postamble_size: np.uint8 = np.uint8(self._crc_processor.crc_byte_length + fec_parity_size)
+
+        # Initializes reception and transmission buffers. If forward error correction is enabled, the COBS-encoded
+        # payload (payload + 2 bytes), the CRC checksum, and the parity bytes have to fit into a single 255-byte
+        # Reed-Solomon block.
+        maximum_payload_size = min((microcontroller_serial_buffer_size - 8), 254)
+        if self._fec_processor is not None:
+            maximum_payload_size = min(maximum_payload_size, 253 - int(self._postamble_size))
+        # If compression is enabled, the compression header uses one byte of each transmitted payload. The reception
+        # limit is kept at the full size, as it applies to the received (compressed) payload.
+        self._lz_processor: LZProcessor | None = (
+            LZProcessor(maximum_size=maximum_payload_size - 1) if compression else None
+        )
+        # The largest packet sent to the Microcontroller has to fit into its serial buffer. Since the transmitted
+        # payload is encoded before it is sent, the transmission limit depends on the worst-case overhead of the framing
+        # codec. For the byte-stuffing codecs, this limits the transmitted payload to about half of the buffer.
+        framing_processor = self._framing_processor.processor
+        transmitted_payload_size = maximum_payload_size
+        while (
+            transmitted_payload_size > 0
+            and framing_processor.maximum_encoded_size(transmitted_payload_size) + 2 + int(self._postamble_size)
+            > microcontroller_serial_buffer_size
+        ):
+            transmitted_payload_size -= 1
+
+        # Similarly, the delta header uses two bytes of each transmitted payload.
+        header_size = int(compression) + 2 * int(delta_keyframe_interval != 0)
+        if transmitted_payload_size - header_size < 1:
+            message = (
+                f"Unable to initialize TransportLayer class. The microcontroller_serial_buffer_size of "
+                f"{microcontroller_serial_buffer_size} bytes is too small to transmit any payload bytes using the "
+                f"{framing_codec} framing codec and the requested packet postamble and payload headers."
+            )
+            console.error(message=message, error=ValueError)
+        self._max_tx_payload_size: np.uint8 = np.uint8(transmitted_payload_size - header_size)
+        self._max_rx_payload_size: np.uint8 = np.uint8(maximum_payload_size)
+        self._min_rx_payload_size: np.uint8 = np.uint8(1)
+
+        # Buffer sizes are up-case to uint16, as they may need to exceed the 256-size limit. They include the respective
+        # payload size, the postamble size (1 to 4 bytes) and 4 static bytes for the preamble and packet metadata.
+        # These 4 bytes are: start_byte, delimiter_byte, overhead_byte, and packet_size byte. Since the reception buffer
+        # also stores the encoded packet, it is sized for the largest packet the framing codec can produce.
+        tx_buffer_size: np.uint16 = np.uint16(self._max_tx_payload_size) + 4 + np.uint16(self._postamble_size)
+        rx_buffer_size: np.uint16 = np.uint16(
+            framing_processor.maximum_encoded_size(int(self._max_rx_payload_size)) + 2 + int(self._postamble_size)
+        )
+        # The transmitted payload, including the compression and delta headers, has the same size limit as the
+        # received payload, so the largest transmitted packet has the size of the reception buffer. The transmission
+        # ring has to be able to store at least one such packet.
+        self._max_packet_size: int = int(rx_buffer_size)
+        if not isinstance(transmission_ring_size, int) or (
+            transmission_ring_size != 0 and transmission_ring_size < self._max_packet_size
+        ):
+            message = (
+                f"Unable to initialize TransportLayer class. Expected 0 or an integer value of at least "
+                f"{self._max_packet_size} (the maximum packet size) for 'transmission_ring_size' argument, but "
+                f"encountered {transmission_ring_size} of type {type(transmission_ring_size).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        # Each direction owns its buffer, trackers, and timer. On very fast CPUs, the timers can be sub-microsecond
+        # precise. On older systems, this may not necessarily hold. Either way, microsecond precision is safe for most
+        # target systems.
+        self._tx: _TransmissionPath = _TransmissionPath(
+            buffer_size=int(tx_buffer_size), ring_size=transmission_ring_size
+        )
+        self._rx: _ReceptionPath = _ReceptionPath(buffer_size=int(rx_buffer_size), slot_count=reception_slots)
+
+        # Based on the minimum expected payload size, calculates the minimum number of bytes that can fully represent
+        # a packet. This is used to avoid costly pySerial calls unless there is a high chance that the call will return
+        # a parsable packet.
+        self._minimum_packet_size: int = (
+            framing_processor.minimum_encoded_size(int(self._min_rx_payload_size)) + 2 + int(self._postamble_size)
+        )
+
+        # If requested, resolves the packet processing kernels specialized for the instance's configuration.
+        self._pipeline: _PacketPipeline | None = (
+            _build_packet_pipeline(
+                start_byte=int(self._start_byte),
+                crc_processor=self._crc_processor,
+                max_payload_size=int(self._max_rx_payload_size),
+                min_payload_size=int(self._min_rx_payload_size),
+                postamble_size=int(self._postamble_size),
+                check_delimiter=self._fec_processor is None,
+            )
+            if specialized_pipeline
+            else None
+        )
+
+    @classmethod
+    def negotiate(
+        cls,
+        port: str,
+        baudrate: int,
+        *,
+        timeout: int = 1_000_000,
+        compression: bool = False,
+        delta_keyframe_interval: int = 0,
+        fec_parity_size: int = 0,
+        **kwargs: Any,
+    ) -> "TransportLayer":
+        """Connects to the microcontroller and configures the instance to the fastest mode supported by both sides via
+        the connection handshake.
+
+        The handshake replaces the manual configuration of the microcontroller's buffer size, CRC parameters, and
+        framing codec. The instance connects to the serial port using the baseline configuration, requests the
+        microcontroller's capabilities, selects the configuration, and waits for the microcontroller to acknowledge it.
+        Then, the instance applies the selected configuration without reopening the serial port.
+
+        Notes:
+            The handshake messages are exchanged using the baseline configuration: a 64-byte microcontroller buffer,
+            the default CRC-8 parameters, and the COBS framing codec. The payload of each message starts with the
+            reserved code 255, followed by the message type. The microcontroller switches to the selected configuration
+            after sending the acknowledgment. Until the response arrives, the request and the selection are resent
+            every 100 milliseconds, as the microcontroller may miss them while it resets after the port is opened.
+
+            The instance uses the whole buffer of the microcontroller, its CRC parameters, and the first framing codec
+            supported by the microcontroller out of COBS, COBS/R, SLIP, and HDLC. The requested optional features are
+            only enabled if the microcontroller supports them. Forward error correction is also only enabled if the
+            microcontroller supports the COBS codec. Record batching is selected whenever the microcontroller supports
+            it. Otherwise, the send_records() method sends each record in a separate payload. The extended frames and
+            the packet acknowledgments are not implemented and are never selected. Use the capabilities property to
+            access the microcontroller's capabilities.
+
+        Args:
+            port: The name of the serial port to connect to, e.g.: 'COM3' or '/dev/ttyUSB0'.
+            baudrate: The baudrate to use for communication if the microcontroller uses the UART interface.
+            timeout: The maximum number of microseconds to wait for each handshake response from the microcontroller.
+            compression: Determines whether to enable the payload compression if the microcontroller supports it.
+            delta_keyframe_interval: The keyframe interval to use if the microcontroller supports delta transmission or
+                0 to disable delta transmission.
+            fec_parity_size: The number of parity bytes to use if the microcontroller supports forward error correction
+                or 0 to disable forward error correction.
+            **kwargs: The remaining keyword arguments of the class initializer that do not describe the
+                microcontroller's configuration, such as wait_strategy or reception_slots.
+
+        Returns:
+            The TransportLayer instance configured to the negotiated mode.
+
+        Raises:
+            ValueError: If the keyword arguments include the arguments determined by the handshake, any of the
+                arguments have invalid values, or the requested arguments are not compatible with the microcontroller's
+                capabilities.
+            RuntimeError: If the microcontroller does not respond to the handshake, uses a different handshake protocol
+                version, reports an invalid configuration, or does not acknowledge the selected configuration.
+        """
+        negotiated_arguments = _NEGOTIATED_ARGUMENTS.intersection(kwargs)
+        if negotiated_arguments:
+            message = (
+                f"Unable to negotiate the TransportLayer configuration. The {', '.join(sorted(negotiated_arguments))} "
+                f"argument(s) are determined by the connection handshake and cannot be provided."
+            )
+            console.error(message=message, error=ValueError)
+
+        if not isinstance(delta_keyframe_interval, int) or not 0 <= delta_keyframe_interval <= 0xFFFF:
+            message = (
+                f"Unable to negotiate the TransportLayer configuration. Expected an integer value between 0 and 65535 "
+                f"for 'delta_keyframe_interval' argument, but encountered {delta_keyframe_interval} of type "
+                f"{type(delta_keyframe_interval).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        # Verifies the requested configuration before the handshake, as the microcontroller switches to the selected
+        # configuration as soon as it acknowledges it. Since the verification uses a mocked port, it skips the GIL-free
+        # reception engine check.
+        cls(
+            port=port,
+            microcontroller_serial_buffer_size=_HANDSHAKE_BUFFER_SIZE,
+            baudrate=baudrate,
+            test_mode=True,
+            compression=compression,
+            delta_keyframe_interval=delta_keyframe_interval,
+            fec_parity_size=fec_parity_size,
+            **{key: value for key, value in kwargs.items() if key != "gil_free_reception"},
+        )
+
+        instance = cls(
+            port=port,
+            microcontroller_serial_buffer_size=_HANDSHAKE_BUFFER_SIZE,
+            baudrate=baudrate,
+            wait_strategy=kwargs.get("wait_strategy"),
+        )
+
+        # Releases the serial port if the handshake fails, as the caller does not receive the instance that owns it.
+        try:
+            capabilities = instance._request_capabilities(timeout=timeout)
+
+            # Selects the fastest mutually supported configuration.
+            framing_codec = next(codec for codec in _CODEC_PREFERENCE if codec in capabilities.framing_codecs)
+            if MicrocontrollerFeature.COMPRESSION not in capabilities.features:
+                compression = False
+            if MicrocontrollerFeature.DELTA_TRANSMISSION not in capabilities.features:
+                delta_keyframe_interval = 0
+            if MicrocontrollerFeature.FORWARD_ERROR_CORRECTION not in capabilities.features or (
+                framing_codec != FramingCodec.COBS
+            ):
+                fec_parity_size = 0
+            crc_type = {1: np.uint8, 2: np.uint16, 4: np.uint32}[capabilities.crc_byte_length]
+            configuration: dict[str, Any] = {
+                "microcontroller_serial_buffer_size": capabilities.buffer_size,
+                "polynomial": crc_type(capabilities.polynomial),
+                "initial_crc_value": crc_type(capabilities.initial_crc_value),
+                "final_crc_xor_value": crc_type(capabilities.final_crc_xor_value),
+                "framing_codec": framing_codec,
+                "compression": compression,
+                "delta_keyframe_interval": delta_keyframe_interval,
+                "fec_parity_size": fec_parity_size,
+            }
+
+            # Verifies the selected configuration against the microcontroller's capabilities before sending it, as the
+            # microcontroller switches to the selected configuration as soon as it acknowledges it.
+            cls(
+                port=port,
+                baudrate=baudrate,
+                test_mode=True,
+                **configuration,
+                **{key: value for key, value in kwargs.items() if key != "gil_free_reception"},
+            )
+
+            features = (
+                (MicrocontrollerFeature.COMPRESSION if compression else 0)
+                | (MicrocontrollerFeature.DELTA_TRANSMISSION if delta_keyframe_interval != 0 else 0)
+                | (MicrocontrollerFeature.FORWARD_ERROR_CORRECTION if fec_parity_size != 0 else 0)
+                | (capabilities.features & MicrocontrollerFeature.BATCHING)
+            )
+            selection = np.array(
+                [
+                    _HANDSHAKE_CODE,
+                    _HANDSHAKE_SELECTION,
+                    _HANDSHAKE_VERSION,
+                    tuple(FramingCodec).index(framing_codec),
+                    features,
+                    fec_parity_size,
+                    delta_keyframe_interval & 0xFF,
+                    delta_keyframe_interval >> 8,
+                ],
+                dtype=np.uint8,
+            )
+            response = instance._exchange_handshake_message(
+                payload=selection, response_type=_HANDSHAKE_ACKNOWLEDGMENT, timeout=timeout
+            )
+            if not np.array_equal(response[2:], selection[2:]):
+                message = (
+                    "Unable to negotiate the TransportLayer configuration. The Microcontroller did not acknowledge the "
+                    "selected configuration."
+                )
+                console.error(message=message, error=RuntimeError)
+
+            instance._configure(**configuration, **kwargs)
+            if kwargs.get("transmission_ring_size", 0) != 0 and sys.platform == "win32":  # pragma: no cover
+                instance._port.write_timeout = 0
+        except BaseException:
+            instance._port.close()
+            instance._opened = False
+            raise
+
+        instance._capabilities = capabilities
+        return instance
+
+    def _request_capabilities(self, timeout: int) -> MicrocontrollerCapabilities:
+        """Requests the configuration and the capabilities of the microcontroller as the first step of the connection
+        handshake.
+
+        The capabilities message stores the following fields, with the multibyte fields in little-endian order: the
+        handshake code (uint8), the message type (uint8), the protocol version (uint8), the buffer size (uint16), the
+        CRC width in bytes (uint8), the CRC polynomial, initial value, and final XOR value (uint32 each), the bit mask
+        of the supported framing codecs in the FramingCodec member order (uint8), and the MicrocontrollerFeature bit
+        mask (uint8).
+
+        Args:
+            timeout: The maximum number of microseconds to wait for the microcontroller's response.
+
+        Returns:
+            The MicrocontrollerCapabilities instance that stores the reported capabilities.
+
+        Raises:
+            RuntimeError: If the microcontroller does not respond, uses a different handshake protocol version, or
+                reports an invalid configuration.
+        """
+        response = self._exchange_handshake_message(
+            payload=np.array([_HANDSHAKE_CODE, _HANDSHAKE_REQUEST, _HANDSHAKE_VERSION], dtype=np.uint8),
+            response_type=_HANDSHAKE_CAPABILITIES,
+            timeout=timeout,
+        )
+        if response.size != _CAPABILITIES_SIZE or response[2] != _HANDSHAKE_VERSION:
+            message = (
+                f"Unable to negotiate the TransportLayer configuration. Expected a {_CAPABILITIES_SIZE}-byte "
+                f"capabilities message of the handshake protocol version {_HANDSHAKE_VERSION}, but the Microcontroller "
+                f"sent a {response.size}-byte message of the version {response[2] if response.size > 2 else None}."
+            )
+            console.error(message=message, error=RuntimeError)
+
+        crc_byte_length = int(response[5])
+        polynomial, initial_crc_value, final_crc_xor_value = (int(value) for value in response[6:18].view("<u4"))
+        capabilities = MicrocontrollerCapabilities(
+            protocol_version=int(response[2]),
+            buffer_size=int(response[3:5].view("<u2")[0]),
+            crc_byte_length=crc_byte_length,
+            polynomial=polynomial,
+            initial_crc_value=initial_crc_value,
+            final_crc_xor_value=final_crc_xor_value,
+            framing_codecs=tuple(codec for index, codec in enumerate(FramingCodec) if (response[18] >> index) & 1),
+            features=MicrocontrollerFeature(int(response[19])),
+        )
+
+        if (
+            capabilities.buffer_size < 1
+            or crc_byte_length not in (1, 2, 4)
+            or max(polynomial, initial_crc_value, final_crc_xor_value) >> (8 * crc_byte_length) != 0
+            or not capabilities.framing_codecs
+        ):
+            message = (
+                f"Unable to negotiate the TransportLayer configuration. The Microcontroller reported an invalid "
+                f"configuration: {capabilities}."
+            )
+            console.error(message=message, error=RuntimeError)
+        return capabilities
+
+    def _exchange_handshake_message(
+        self, payload: NDArray[np.uint8], response_type: int, timeout: int
+    ) -> NDArray[np.uint8]:
+        """Sends the input handshake message and waits for the microcontroller's handshake response of the requested
+        type.
+
+        Since the microcontroller may miss the message, for example, if opening the serial port resets it and the
+        message arrives while its bootloader runs, the message is resent every 100 milliseconds until the response is
+        received or the timeout runs out. The received payloads that are not handshake responses of the requested type
+        and the corrupted packets are discarded.
+
+        Args:
+            payload: The handshake message to send.
+            response_type: The message type of the expected response.
+            timeout: The maximum number of microseconds to wait for the response.
+
+        Returns:
+            The payload of the received response.
+
+        Raises:
+            RuntimeError: If the microcontroller does not respond within the timeout.
+        """
+        deadline = time.perf_counter_ns() + timeout * 1000
+        resend_time = time.perf_counter_ns()
+        while True:
+            current_time = time.perf_counter_ns()
+            if current_time >= deadline:
+                break
+            if current_time >= resend_time:
+                self.write_data(payload)
+                self.send_data()
+                resend_time = current_time + _HANDSHAKE_RESEND_INTERVAL * 1000
+
+            # Waits for the response until the message has to be resent or the timeout runs out.
+            remaining = max((min(deadline, resend_time) - time.perf_counter_ns()) // 1000, 1)
+            try:
+                if not self.receive_data(timeout=remaining):
+                    continue
+            except RuntimeError:
+                continue
+
+            response = self.reception_buffer[: self.bytes_in_reception_buffer]
+            if response.size >= 2 and response[0] == _HANDSHAKE_CODE and response[1] == response_type:
+                return response
+
+        message = (
+            f"Unable to negotiate the TransportLayer configuration. The Microcontroller did not respond to the "
+            f"connection handshake within {timeout} microseconds. Make sure that the Microcontroller's firmware "
+            f"supports the connection handshake."
+        )
+        console.error(message=message, error=RuntimeError)
+
+        # Fallback to appease MyPy, will never be reached.
+        raise RuntimeError(message)  # pragma: no cover
+
+    def probe_baudrate(
+        self,
+        candidates: Iterable[int],
+        probe_count: int = _BAUDRATE_PROBE_COUNT,
+        probe_size: int = 0,
+        timeout: int = _BAUDRATE_PROBE_TIMEOUT,
+    ) -> BaudrateProbeReport:
+        """Measures the error rate and the throughput of the communication at each candidate baudrate and switches the
+        serial port to the fastest error-free baudrate.
+
+        Use this method to find the fastest stable baudrate of the microcontrollers that use the UART interface instead
+        of calculating the baudrate error of the microcontroller's clock manually. At each candidate baudrate, the
+        instance sends a series of echo probes and waits for the microcontroller to send each probe back.
+
+        Notes:
+            The echo probes are handshake messages. The payload of each probe starts with the reserved code 255, the
+            echo request type (4), the handshake protocol version, and the probe's sequence number (uint16), followed by
+            the test pattern. The microcontroller is expected to respond with the code 255 and the echo response type
+            (5), followed by the probe's bytes that come after the message type. The probe fails if its uncorrupted
+            response is not received within the timeout or carries different data.
+
+            The method reconfigures the open serial port instead of reopening it, as reopening the port resets some
+            microcontrollers. The microcontroller has to follow the serial port's baudrate, for example, by detecting
+            the baudrate of the incoming probes. The USB interface ignores the baudrate. If none of the candidate
+            baudrates is error-free, the method restores the original baudrate.
+
+        Args:
+            candidates: The baudrates to probe, in the order they are probed.
+            probe_count: The number of echo probes to send at each candidate baudrate.
+            probe_size: The size of each probe's payload, in bytes, or 0 to use the maximum payload size.
+            timeout: The maximum number of microseconds to wait for each probe's response.
+
+        Returns:
+            The BaudrateProbeReport instance that stores the selected baudrate and the measurements of each candidate.
+
+        Raises:
+            ValueError: If any of the arguments is not valid.
+            ConnectionError: If the Microcontroller is disconnected and the automatic reconnection is disabled or
+                fails.
+        """
+        candidates = tuple(candidates)
+        if not candidates or not all(isinstance(baudrate, int) and baudrate > 0 for baudrate in candidates):
+            message = (
+                f"Unable to probe the baudrate. Expected a non-empty iterable of positive integers for 'candidates' "
+                f"argument, but encountered {candidates}."
+            )
+            console.error(message=message, error=ValueError)
+
+        if not isinstance(probe_count, int) or probe_count <= 0:
+            message = (
+                f"Unable to probe the baudrate. Expected a positive integer value for 'probe_count' argument, but "
+                f"encountered {probe_count} of type {type(probe_count).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        maximum_size = int(self._max_tx_payload_size)
+        if not isinstance(probe_size, int) or (probe_size != 0 and not _ECHO_HEADER_SIZE <= probe_size <= maximum_size):
+            message = (
+                f"Unable to probe the baudrate. Expected 0 or an integer value between {_ECHO_HEADER_SIZE} and "
+                f"{maximum_size} (the maximum payload size) for 'probe_size' argument, but encountered {probe_size} of "
+                f"type {type(probe_size).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        if not isinstance(timeout, int) or timeout <= 0:
+            message = (
+                f"Unable to probe the baudrate. Expected a positive integer value for 'timeout' argument, but "
+                f"encountered {timeout} of type {type(timeout).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        probe_size = probe_size if probe_size != 0 else maximum_size
+        original_baudrate = self._baudrate
+        measurements: list[BaudrateMeasurement] = []
+        # The sequence numbers are not reset between the baudrates, so that the late responses to the probes sent at
+        # the previous baudrate cannot be mistaken for the responses to the current probes.
+        sequence = 0
+        for baudrate in candidates:
+            self._set_baudrate(baudrate=baudrate, timeout=timeout)
+            error_count = 0
+            start = time.perf_counter_ns()
+            for _ in range(probe_count):
+                probe = np.empty(probe_size, dtype=np.uint8)
+                probe[:3] = (_HANDSHAKE_CODE, _HANDSHAKE_ECHO_REQUEST, _HANDSHAKE_VERSION)
+                probe[3:5] = np.array([sequence], dtype="<u2").view(np.uint8)
+                probe[5:] = (np.arange(probe_size - _ECHO_HEADER_SIZE) + sequence) % 256
+                if not self._exchange_echo_probe(probe=probe, timeout=timeout):
+                    error_count += 1
+                sequence = (sequence + 1) & 0xFFFF
+            elapsed = (time.perf_counter_ns() - start) / 1_000_000_000
+
+            measurements.append(
+                BaudrateMeasurement(
+                    baudrate=baudrate,
+                    probe_count=probe_count,
+                    error_count=error_count,
+                    error_rate=error_count / probe_count,
+                    throughput=2 * (probe_count - error_count) * probe_size / elapsed,
+                )
+            )
+
+        selected_baudrate = max(
+            (measurement.baudrate for measurement in measurements if measurement.error_count == 0), default=None
+        )
+        self._set_baudrate(
+            baudrate=selected_baudrate if selected_baudrate is not None else original_baudrate, timeout=timeout
+        )
+        return BaudrateProbeReport(baudrate=selected_baudrate, measurements=tuple(measurements))
+
+    def _exchange_echo_probe(self, probe: NDArray[np.uint8], timeout: int) -> bool:
+        """Sends the input echo probe and waits for the microcontroller to send it back.
+
+        The received payloads that are not responses to the input probe are discarded. Since a corrupted packet cannot
+        be attributed to a specific probe, for example, it may be a late response to a probe sent at the previous
+        baudrate, the method also discards the corrupted packets and keeps waiting for the response until the timeout
+        runs out.
+
+        Args:
+            probe: The echo probe to send.
+            timeout: The maximum number of microseconds to wait for the response.
+
+        Returns:
+            True if the microcontroller sent the probe back unchanged and False if the uncorrupted response was not
+            received within the timeout or carried different data.
+        """
+        self.write_data(probe)
+        self.send_data()
+
+        deadline = time.perf_counter_ns() + timeout * 1000
+        while True:
+            remaining = (deadline - time.perf_counter_ns()) // 1000
+            if remaining <= 0:
+                return False
+            try:
+                if not self.receive_data(timeout=remaining):
+                    continue
+            except RuntimeError:
+                continue
+
+            response = self.reception_buffer[: self.bytes_in_reception_buffer]
+            if (
+                response.size >= _ECHO_HEADER_SIZE
+                and response[0] == _HANDSHAKE_CODE
+                and response[1] == _HANDSHAKE_ECHO_RESPONSE
+                and np.array_equal(response[3:5], probe[3:5])
+            ):
+                return np.array_equal(response[2:], probe[2:])
+
+    def _set_baudrate(self, baudrate: int, timeout: int) -> None:
+        """Switches the serial port to the input baudrate after transmitting the pending bytes and discards the bytes
+        received at the previous baudrate.
+
+        Discarding the received bytes prevents the late responses to the probes sent at the previous baudrate from
+        being counted against the input baudrate.
+
+        Args:
+            baudrate: The baudrate to switch to.
+            timeout: The maximum number of microseconds to wait for the transmission ring to be flushed.
+
+        Raises:
+            ConnectionError: If the Microcontroller is disconnected and the automatic reconnection is disabled or
+                fails.
+        """
+        self.flush_transmission(timeout=timeout)
+
+        # Acquires the port lock before the reception lock, in the same order as the port reopening.
+        with self._port_lock, self._rx.lock:
+            connection = self._reconnections
+            try:
+                if isinstance(self._port, Serial):  # pragma: no cover
+                    self._port.flush()
+                    self._port.baudrate = baudrate
+                self._port.reset_input_buffer()
+                self._baudrate = baudrate
+
+                # Since the stream is empty, the next reception has to query the number of available bytes before
+                # reading the port.
+                self._rx.stream_size = 0
+                self._rx.read_saturated = False
+                return
+            except OSError as error:
+                disconnection = error
+        self._handle_disconnection(error=disconnection, connection=connection)
+
+    def __del__(self) -> None:
+        """Ensures that the instance releases all resources prior to being garbage-collected."""
+        # Closes the port before deleting the class instance. Not strictly required, but helpful to ensure resources
+        # are released
         if self._opened:
             self._port.close()
 
-    def __repr__(self) -> str:
-        """Returns a string representation of the class instance."""
-        if isinstance(self._port, Serial):  # pragma: no cover
-            representation_string = (
-                f"TransportLayer(port='{self._port.name}', baudrate={self._port.baudrate}, polynomial="
-                f"{self._crc_processor.polynomial}, start_byte={self._start_byte}, "
-                f"delimiter_byte={self._delimiter_byte}, timeout={self._timeout} us, "
-                f"maximum_tx_payload_size={self._max_tx_payload_size}, "
-                f"maximum_rx_payload_size={self._max_rx_payload_size})"
-            )
-        else:
-            representation_string = (
-                f"TransportLayer(port & baudrate=MOCKED, polynomial={self._crc_processor.polynomial}, "
-                f"start_byte={self._start_byte}, delimiter_byte={self._delimiter_byte}, timeout={self._timeout} us, "
-                f"maximum_tx_payload_size={self._max_tx_payload_size}, "
-                f"maximum_rx_payload_size={self._max_rx_payload_size})"
+    def __repr__(self) -> str:
+        """Returns a string representation of the class instance."""
+        if isinstance(self._port, Serial):  # pragma: no cover
+            representation_string = (
+                f"TransportLayer(port='{self._port.name}', baudrate={self._port.baudrate}, polynomial="
+                f"{self._crc_processor.polynomial}, start_byte={self._start_byte}, "
+                f"delimiter_byte={self._delimiter_byte}, timeout={self._timeout} us, "
+                f"maximum_tx_payload_size={self._max_tx_payload_size}, "
+                f"maximum_rx_payload_size={self._max_rx_payload_size})"
+            )
+        else:
+            representation_string = (
+                f"TransportLayer(port & baudrate=MOCKED, polynomial={self._crc_processor.polynomial}, "
+                f"start_byte={self._start_byte}, delimiter_byte={self._delimiter_byte}, timeout={self._timeout} us, "
+                f"maximum_tx_payload_size={self._max_tx_payload_size}, "
+                f"maximum_rx_payload_size={self._max_rx_payload_size})"
+            )
+        return representation_string
+
+    @property
+    def available(self) -> bool:
+        """Returns True if enough bytes are available from the serial port to justify attempting to receive a packet."""
+        # in_waiting is twice as fast as using the read() method. The 'true' outcome of this check is capped at the
+        # minimum packet size to minimize the chance of having to call read() more than once. The method counts the
+        # bytes available for reading and left over from previous packet parsing operations. If the bytes left over
+        # from previous reads are sufficient, the serial port is not queried.
+        with self._rx.lock:
+            if self._rx.stream_size >= self._minimum_packet_size:
+                return True
+            self._rx.port_calls += 1
+            connection = self._reconnections
+            try:
+                return (self._port.in_waiting + self._rx.stream_size) >= self._minimum_packet_size
+            except OSError as error:
+                disconnection = error
+
+        # Handles the disconnection after releasing the reception lock, as reopening the port acquires it.
+        self._handle_disconnection(error=disconnection, connection=connection)
+        return False
+
+    @property
+    def wait_strategy(self) -> WaitStrategy:
+        """Returns the WaitStrategy instance used to wait for the serial port to receive new bytes."""
+        return self._wait_strategy
+
+    @property
+    def capabilities(self) -> MicrocontrollerCapabilities | None:
+        """Returns the capabilities reported by the microcontroller during the connection handshake or None if the
+        instance was not configured by the negotiate() method.
+        """
+        return self._capabilities
+
+    @property
+    def transmission_buffer(self) -> NDArray[np.uint8]:
+        """Returns a copy of the transmission buffer array.
+
+        This buffer stores the 'staged' data to be sent to the Microcontroller. Use this method to safely access the
+        contents of the buffer.
+        """
+        with self._tx.lock:
+            return self._tx.buffer.copy()
+
+    @property
+    def reception_buffer(self) -> NDArray[np.uint8]:
+        """Returns a copy of the reception buffer array.
+
+        This buffer stores the decoded data received from the Microcontroller. Use this method to safely access the
+        contents of the buffer.
+        """
+        with self._rx.lock:
+            self._decode_pending_payload()
+            return self._rx.buffer.copy()
+
+    @property
+    def bytes_in_transmission_buffer(self) -> int:
+        """Returns the number of payload bytes stored inside the instance's transmission buffer."""
+        return self._tx.bytes_in_buffer
+
+    @property
+    def bytes_in_reception_buffer(self) -> int:
+        """Returns the number of payload bytes stored inside the instance's reception buffer."""
+        # Lazily decoded payloads have to be decoded to determine their size.
+        with self._rx.lock:
+            self._decode_pending_payload()
+            return self._rx.bytes_in_buffer
+
+    @property
+    def free_reception_slots(self) -> int:
+        """Returns the number of reception slots that do not store held payloads."""
+        with self._rx.slot_lock:
+            return len(self._rx.slots) - len(self._rx.held_slots)
+
+    @property
+    def transmitted_packets(self) -> int:
+        """Returns the number of packets sent by the instance since initialization."""
+        with self._tx.lock:
+            return self._tx.packet_count
+
+    @property
+    def pending_transmission_bytes(self) -> int:
+        """Returns the number of packet bytes stored in the transmission ring that the serial port has not accepted
+        yet.
+        """
+        with self._tx.lock:
+            return self._tx.ring_count
+
+    @property
+    def transmission_backlog(self) -> int:
+        """Returns the number of transmitted bytes that have not left the host yet.
+
+        The backlog includes the bytes pending in the transmission ring and the bytes queued by the serial port.
+        """
+        with self._tx.lock:
+            return self._tx.ring_count + self._port.out_waiting
+
+    @property
+    def transmission_throttled(self) -> bool:
+        """Returns True if the transmission backlog has reached the high watermark and has not yet fallen to the low
+        watermark.
+        """
+        return self._tx.throttled
+
+    @property
+    def received_packets(self) -> int:
+        """Returns the number of packets received and verified by the instance since initialization."""
+        with self._rx.lock:
+            return self._rx.packet_count
+
+    @property
+    def reception_port_calls(self) -> int:
+        """Returns the number of serial port queries and reads made by the reception methods since initialization.
+
+        Each query (in_waiting) or read is counted as a single call. The calls made by the GIL-free reception engine
+        are not counted.
+        """
+        with self._rx.lock:
+            return self._rx.port_calls
+
+    @property
+    def port_calls_per_packet(self) -> float:
+        """Returns the average number of serial port queries and reads made by the reception methods for each received
+        packet or 0.0 if no packets have been received.
+
+        Under sustained streaming, the reception methods read many packets with each call, so this value falls below 1.
+        """
+        with self._rx.lock:
+            return self._rx.port_calls / self._rx.packet_count if self._rx.packet_count else 0.0
+
+    @property
+    def connected(self) -> bool:
+        """Returns True if the serial port is open and the instance has not detected the Microcontroller's
+        disconnection since the port was last opened.
+        """
+        return self._connected
+
+    @property
+    def reconnections(self) -> int:
+        """Returns the number of times the serial port was reopened by the reconnect() method or the automatic
+        reconnection since initialization.
+        """
+        return self._reconnections
+
+    def start_real_time_session(
+        self,
+        cpu_core: int | None = None,
+        fifo_priority: int | None = None,
+        *,
+        lock_memory: bool = True,
+        disable_gc: bool = True,
+    ) -> None:
+        """Configures the calling thread and the Python runtime to minimize the worst-case packet reception latency.
+
+        Starting the session pins the calling thread to the requested CPU core, assigns it the requested SCHED_FIFO
+        real-time priority, locks the process's memory into RAM, pre-faults all instance buffers, and disables the
+        cyclic garbage collector. While the session is active, the instance records the latency of each received
+        packet. Use the stop_real_time_session() method to end the session and retrieve the achieved latency.
+
+        Notes:
+            The CPU pinning and the scheduling priority are applied to the calling thread. Call this method from the
+            thread that calls receive_data() (the reader thread).
+
+            Each feature degrades gracefully: if the host system does not support a feature or the process lacks the
+            permissions to use it, the feature is skipped, and the session continues with the remaining features.
+            Use the report returned by the stop_real_time_session() method to determine which features were applied.
+            CPU pinning and SCHED_FIFO priority are only supported on Linux, and memory locking is only supported on
+            Linux and macOS.
+
+            Memory locking only locks the pages mapped at the time of the call, so that the allocations made during
+            the session cannot fail due to the memory locking limits of the host system.
+
+            The memory locking and the garbage collector suppression affect the whole process and are shared by all
+            active sessions, for example, the sessions of the instances that manage different ports. These features
+            are only restored when the last session that uses them ends.
+
+        Args:
+            cpu_core: The index of the CPU core to pin the calling thread to. If None, the thread is not pinned.
+            fifo_priority: The SCHED_FIFO priority, from 1 to 99, to assign to the calling thread. If None, the
+                thread keeps its current scheduling policy.
+            lock_memory: Determines whether to lock the process's memory into RAM to prevent page faults.
+            disable_gc: Determines whether to disable the cyclic garbage collector for the duration of the session.
+
+        Raises:
+            RuntimeError: If a real-time session is already active.
+        """
+        with self._rx.lock:
+            if self._real_time_session is not None:
+                message = (
+                    "Unable to start the real-time session. The TransportLayer instance already has an active "
+                    "real-time session. Stop the active session before starting a new one."
+                )
+                console.error(message=message, error=RuntimeError)
+
+            session = _RealTimeSession()
+
+            # Pins the calling thread to the requested CPU core to prevent the OS from migrating it across cores.
+            if cpu_core is not None:
+                try:
+                    session.previous_affinity = os.sched_getaffinity(0)
+                    os.sched_setaffinity(0, {cpu_core})
+                    session.cpu_core = cpu_core
+                except (AttributeError, OSError, ValueError):
+                    session.previous_affinity = None
+
+            # Requests the real-time scheduling policy. This requires elevated permissions on most systems.
+            if fifo_priority is not None:
+                try:
+                    session.previous_policy = (os.sched_getscheduler(0), os.sched_getparam(0).sched_priority)
+                    os.sched_setscheduler(0, os.SCHED_FIFO, os.sched_param(fifo_priority))
+                    session.fifo_priority = fifo_priority
+                except (AttributeError, OSError, ValueError):
+                    session.previous_policy = None
+
+            # Pre-faults the unused portions of all buffers so that their first use during the session does not
+            # trigger page faults. The used portions of the buffers are already faulted in.
+            with self._tx.lock:
+                self._tx.buffer[self._tx.bytes_in_buffer :] = 0
+            self._rx.buffer[max(self._rx.bytes_in_buffer, self._rx.encoded_size) :] = 0
+            with self._rx.slot_lock:
+                for index in self._rx.free_slots:
+                    self._rx.slots[index][:] = 0
+            self._rx.stream_buffer[self._rx.stream_size :] = 0
+
+            with _SESSION_FEATURE_LOCK:
+                # Locks all currently mapped pages, including the pre-faulted buffers, into RAM. If another session
+                # already locked the memory, the call also locks the pages mapped since then.
+                if lock_memory and sys.platform != "win32" and _mlockall is not None:
+                    session.memory_locked = _mlockall(_MCL_CURRENT) == 0
+                    _SESSION_FEATURE_COUNTS["memory_locked"] += int(session.memory_locked)
+
+                # Collects all garbage before disabling the collector, so that the session starts with a clean heap. If
+                # the collector was disabled outside the sessions, leaves it disabled when the session ends.
+                if disable_gc and (_SESSION_FEATURE_COUNTS["gc_disabled"] > 0 or gc.isenabled()):
+                    if gc.isenabled():
+                        gc.collect()
+                        gc.disable()
+                    _SESSION_FEATURE_COUNTS["gc_disabled"] += 1
+                    session.gc_disabled = True
+
+            self._real_time_session = session
+
+    def stop_real_time_session(self) -> RealTimeReport:
+        """Ends the active real-time session, restoring all settings changed by the start_real_time_session() method.
+
+        Notes:
+            Call this method from the same thread that started the session, as the CPU pinning and the scheduling
+            priority are restored for the calling thread.
+
+        Returns:
+            The RealTimeReport instance that describes the applied real-time features and the packet reception
+            latency achieved during the session.
+
+        Raises:
+            RuntimeError: If no real-time session is active.
+        """
+        with self._rx.lock:
+            session = self._real_time_session
+            if session is None:
+                message = (
+                    "Unable to stop the real-time session. The TransportLayer instance does not have an active "
+                    "real-time session."
+                )
+                console.error(message=message, error=RuntimeError)
+
+                # Fallback to appease MyPy, will never be reached.
+                raise RuntimeError(message)  # pragma: no cover
+
+            # Restores all settings in the reverse order of their application. The process-wide features are only
+            # restored by the last session that holds them.
+            with _SESSION_FEATURE_LOCK:
+                if session.gc_disabled:
+                    _SESSION_FEATURE_COUNTS["gc_disabled"] -= 1
+                    if _SESSION_FEATURE_COUNTS["gc_disabled"] == 0:
+                        gc.enable()
+                if session.memory_locked:
+                    _SESSION_FEATURE_COUNTS["memory_locked"] -= 1
+                    if _SESSION_FEATURE_COUNTS["memory_locked"] == 0 and _munlockall is not None:
+                        _munlockall()
+            if session.previous_policy is not None:
+                os.sched_setscheduler(0, session.previous_policy[0], os.sched_param(session.previous_policy[1]))
+            if session.previous_affinity is not None:
+                os.sched_setaffinity(0, session.previous_affinity)
+
+            self._real_time_session = None
+            return session.report()
+
+    def start_transmission_tracking(self) -> None:
+        """Starts recording the outbound latency of each sent packet.
+
+        While the tracking is active, the instance records the moment each packet is handed off to the transmission
+        path, and a background watcher thread records the moment the serial port's driver finishes transmitting the
+        packet. Use the stop_transmission_tracking() method to end the tracking and retrieve the recorded latencies.
+
+        Notes:
+            On Linux and macOS, the watcher thread waits in the tcdrain() syscall, which returns as soon as the
+            driver's output queue empties. Since the queue only empties between the bursts of packets, the latency of
+            each packet sent as part of a burst also includes the transmission of the later packets of the burst. On
+            Windows and in the test mode, the watcher thread polls the size of the output queue (out_waiting) at the
+            wait strategy's poll interval, which determines the precision of the drain timestamps.
+
+            Bytes stored in the transmission ring are not yet handed off to the driver, so the latency of the packets
+            sent in the non-blocking mode also includes the time the packets spend in the ring.
+
+            Reopening the serial port discards the bytes queued by the closed port's driver. The packets that were
+            fully or partially handed off to that driver, but not drained, are reported as failed. The packets stored
+            in the transmission ring are transmitted through the reopened port.
+
+        Raises:
+            RuntimeError: If the transmission tracking is already active.
+        """
+        with self._tx.lock:
+            if self._tx.tracker is not None:
+                message = (
+                    "Unable to start the transmission tracking. The TransportLayer instance is already tracking the "
+                    "transmitted packets. Stop the active tracking before starting a new one."
+                )
+                console.error(message=message, error=RuntimeError)
+
+            tracker = _TransmissionTracker()
+            tracker.thread = Thread(target=self._watch_transmission, args=(tracker,), daemon=True)
+            self._tx.tracker = tracker
+        tracker.thread.start()
+
+    def stop_transmission_tracking(self) -> TransmissionReport:
+        """Ends the active transmission tracking and summarizes the outbound latency of the tracked packets.
+
+        Notes:
+            The packets that have not been drained by the time this method is called are reported as pending. If the
+            watcher thread is blocked waiting for the driver to drain its queue, the method does not wait for the
+            thread, which exits once the driver drains the queue.
+
+        Returns:
+            The TransmissionReport instance that describes the outbound latency of the packets sent during the tracking.
+
+        Raises:
+            RuntimeError: If the transmission tracking is not active.
+        """
+        with self._tx.lock:
+            tracker = self._tx.tracker
+            if tracker is None:
+                message = (
+                    "Unable to stop the transmission tracking. The TransportLayer instance is not tracking the "
+                    "transmitted packets."
+                )
+                console.error(message=message, error=RuntimeError)
+
+                # Fallback to appease MyPy, will never be reached.
+                raise RuntimeError(message)  # pragma: no cover
+
+            self._tx.tracker = None
+            tracker.stop.set()
+            tracker.wake.set()
+
+        if tracker.thread is not None:
+            tracker.thread.join(timeout=self._wait_strategy.poll_interval / 1_000_000)
+
+        # The watcher thread only modifies the tracker while holding the transmission lock and exits as soon as it
+        # observes the stop event, so the report cannot be modified while it is being built.
+        with self._tx.lock:
+            return tracker.report()
+
+    def _watch_transmission(self, tracker: _TransmissionTracker) -> None:
+        """Records the drain timestamps of the packets tracked by the input tracker until the tracking stops.
+
+        This worker method runs in the tracker's watcher thread. The number of drained bytes is the number of the
+        tracked bytes handed off to the serial port's driver minus the bytes still queued by the driver.
+
+        Args:
+            tracker: The _TransmissionTracker instance that stores the tracked packets.
+        """
+        use_tcdrain = isinstance(self._port, Serial) and sys.platform != "win32"
+        interval = self._wait_strategy.poll_interval / 1_000_000
+        while True:
+            with self._tx.lock:
+                if tracker.stop.is_set():
+                    return
+                idle = not tracker.pending
+                if idle:
+                    tracker.wake.clear()
+                # Packets whose bytes are still stored in the transmission ring cannot be drained by the driver yet.
+                handed_off = not idle and tracker.pending[0][2] <= tracker.queued_bytes - self._tx.ring_count
+
+            if idle:
+                tracker.wake.wait()
+                continue
+
+            # If the Microcontroller is disconnected, keeps polling the port until it is reopened. The disconnection is
+            # handled by the methods that send and receive the data.
+            try:
+                if use_tcdrain and handed_off:  # pragma: no cover
+                    _tcdrain(self._port.fileno())
+                else:
+                    time.sleep(interval)
+
+                with self._tx.lock:
+                    if tracker.stop.is_set():
+                        return
+                    self._complete_drained_packets(tracker=tracker)
+            except OSError:
+                time.sleep(interval)
+
+    def _complete_drained_packets(self, tracker: _TransmissionTracker) -> None:
+        """Records the drain timestamps of the tracked packets that the serial port's driver has finished transmitting.
+
+        This worker method expects the caller to hold the transmission lock.
+
+        Args:
+            tracker: The _TransmissionTracker instance that stores the tracked packets.
+
+        Raises:
+            OSError: If the serial port cannot report the size of its output queue.
+        """
+        tracker.complete(drained_bytes=tracker.queued_bytes - self._tx.ring_count - self._port.out_waiting)
+
+    def set_reconnection_policy(
+        self,
+        timeout: int,
+        initial_backoff: int = _RECONNECTION_BACKOFF,
+        maximum_backoff: int = _MAXIMUM_RECONNECTION_BACKOFF,
+    ) -> None:
+        """Configures the automatic reconnection to the Microcontroller after its USB device is disconnected.
+
+        By default, the methods that access the serial port raise a ConnectionError when they detect the
+        Microcontroller's disconnection. If the automatic reconnection is enabled, these methods instead keep
+        attempting to reopen the port via the reconnect() method until the timeout runs out and only raise the error if
+        all attempts fail.
+
+        Notes:
+            The delay between the consecutive reconnection attempts starts at the initial backoff and doubles after
+            each failed attempt, up to the maximum backoff.
+
+        Args:
+            timeout: The maximum number of microseconds to spend reconnecting after each detected disconnection or 0
+                to disable the automatic reconnection.
+            initial_backoff: The delay between the first and the second reconnection attempts, in microseconds.
+            maximum_backoff: The upper limit of the delay between the reconnection attempts, in microseconds.
+
+        Raises:
+            ValueError: If any of the arguments is not valid.
+        """
+        if not isinstance(timeout, int) or timeout < 0:
+            message = (
+                f"Unable to set the reconnection policy. Expected a non-negative integer value for 'timeout' argument, "
+                f"but encountered {timeout} of type {type(timeout).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        if not isinstance(initial_backoff, int) or initial_backoff <= 0:
+            message = (
+                f"Unable to set the reconnection policy. Expected a positive integer value for 'initial_backoff' "
+                f"argument, but encountered {initial_backoff} of type {type(initial_backoff).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        if not isinstance(maximum_backoff, int) or maximum_backoff < initial_backoff:
+            message = (
+                f"Unable to set the reconnection policy. Expected an integer value of at least {initial_backoff} (the "
+                f"initial backoff) for 'maximum_backoff' argument, but encountered {maximum_backoff} of type "
+                f"{type(maximum_backoff).__name__}."
+            )
+            console.error(message=message, error=ValueError)
+
+        with self._port_lock:
+            self._reconnection_timeout = timeout
+            self._initial_backoff = initial_backoff
+            self._maximum_backoff = maximum_backoff
+
+    def reconnect(self, port: str | None = None, timeout: int = 0) -> bool:
+        """Closes the serial port and reopens it in place, preserving the instance's configuration, buffers,
+        statistics, and compiled processors.
+
+        Use this method to resume the communication after the Microcontroller's USB device is disconnected and
+        re-enumerated by the OS, instead of initializing a new TransportLayer instance.
+
+        Notes:
+            If the original port is connected to a USB device that reports a serial number, the method reopens the port
+            currently assigned to the device with the same serial number, as the OS may assign a different port name to
+            the reconnected device. Otherwise, the method reopens the port with the original name.
+
+            The stream bytes received before the reconnection are discarded. If delta transmission is enabled, the
+            next payload sent in each direction is expected to be a keyframe, as the Microcontroller may have been
+            reset. The packet bytes stored in the transmission ring are kept and written to the reopened port.
+
+        Args:
+            port: The name of the serial port to open instead of locating the Microcontroller's port.
+            timeout: The maximum number of microseconds to keep attempting to reopen the port. If 0, the method makes
+                a single attempt. The delay between the attempts follows the reconnection policy's backoff (see
+                set_reconnection_policy()).
+
+        Returns:
+            True if the serial port was reopened and False otherwise.
+        """
+        with self._port_lock:
+            return self._reconnect(port=port, timeout=timeout)
+
+    def _reconnect(self, port: str | None, timeout: int) -> bool:
+        """Keeps attempting to reopen the serial port with the exponential backoff until the timeout runs out.
+
+        This worker method implements reconnect() and expects the caller to hold the port lock.
+        """
+        deadline = time.perf_counter_ns() + timeout * 1000
+        backoff = self._initial_backoff
+        while not self._reopen_port(port=port):
+            remaining = (deadline - time.perf_counter_ns()) // 1000
+            if remaining <= 0:
+                return False
+            time.sleep(min(backoff, remaining) / 1_000_000)
+            backoff = min(2 * backoff, self._maximum_backoff)
+        return True
+
+    def _reopen_port(self, port: str | None) -> bool:
+        """Closes the serial port and attempts to open the port that the Microcontroller is connected to.
+
+        This worker method expects the caller to hold the port lock.
+
+        Args:
+            port: The name of the serial port to open or None to locate the Microcontroller's port.
+
+        Returns:
+            True if the serial port was opened and False otherwise.
+        """
+        # Acquires the locks of both paths to prevent other threads from using the port while it is being replaced.
+        with self._rx.lock, self._tx.lock:
+            self._connected = False
+
+            # Closing the port discards the bytes queued by its driver. Records the packets that were drained before
+            # the port was closed and counts the remaining packets handed off to the driver as failed.
+            tracker = self._tx.tracker
+            if tracker is not None:
+                with contextlib.suppress(OSError):
+                    self._complete_drained_packets(tracker=tracker)
+                tracker.fail(handed_off_bytes=tracker.queued_bytes - self._tx.ring_count)
+
+            with contextlib.suppress(OSError):
+                self._port.close()
+
+            if isinstance(self._port, Serial):  # pragma: no cover
+                name = port if port is not None else self._locate_port()
+                if name is None:
+                    return False
+                try:
+                    reopened_port = Serial(name, self._baudrate, timeout=0)
+                except OSError:
+                    return False
+                if self._tx.ring.size != 0 and sys.platform == "win32":
+                    reopened_port.write_timeout = 0
+                self._port = reopened_port
+                self._port_name = name
+                self._poller = self._register_poller()
+            else:
+                self._port.open()
+
+            # The reception and transmission paths discard their connection-specific state the next time they are
+            # used.
+            self._reconnections += 1
+            self._connected = True
+            return True
+
+    def _register_poller(self) -> "select.poll | None":
+        """Creates the poll object that waits for the serial port's file descriptor to receive new bytes.
+
+        Unlike select(), poll() supports file descriptors above 1023. Registering the descriptor once per opened port
+        avoids creating a poll object for every wait.
+
+        Returns:
+            The poll object registered for the serial port's file descriptor or None if the port is mocked or the host
+            runs Windows.
+        """
+        if not isinstance(self._port, Serial) or sys.platform == "win32":
+            return None
+        poller = select.poll()  # pragma: no cover
+        poller.register(self._port.fileno(), select.POLLIN)  # pragma: no cover
+        return poller  # pragma: no cover
+
+    def _locate_port(self) -> str | None:
+        """Returns the name of the serial port that the Microcontroller is currently connected to or None if the
+        Microcontroller's USB device is not connected to the host.
+        """
+        if self._serial_number is None:
+            return self._port_name
+        ports = list_available_ports(serial_number=self._serial_number, use_cache=True)
+        return ports[0].device if ports else None
+
+    def _resolve_disconnection(self) -> None:
+        """Handles the Microcontroller's disconnection recorded by the transmission worker methods.
+
+        Since reopening the serial port acquires the locks of both paths, the transmission worker methods only record
+        the disconnection, and the transmission methods call this method after releasing the transmission lock.
+
+        Raises:
+            ConnectionError: If the automatic reconnection is disabled or fails to reopen the port within the timeout.
+        """
+        if self._tx.disconnection is None:
+            return
+        with self._tx.lock:
+            disconnection = self._tx.disconnection
+            self._tx.disconnection = None
+        if disconnection is not None:
+            self._handle_disconnection(error=disconnection[0], connection=disconnection[1])
+
+    def _handle_disconnection(self, error: OSError, connection: int) -> None:
+        """Handles the serial port error that indicates the Microcontroller's disconnection.
+
+        If the automatic reconnection is enabled, attempts to reopen the port. Errors raised while using the
+        connection that has already been replaced by another thread are ignored. The caller must not hold the
+        reception or transmission lock, as reopening the port acquires both locks after the port lock.
+
+        Args:
+            error: The error raised by the serial port.
+            connection: The number of reconnections that preceded the opening of the port that raised the error.
+
+        Raises:
+            ConnectionError: If the automatic reconnection is disabled or fails to reopen the port within the timeout.
+        """
+        with self._port_lock:
+            if connection != self._reconnections:
+                return
+
+            self._connected = False
+            timeout = self._reconnection_timeout
+            if timeout != 0 and self._reconnect(port=None, timeout=timeout):
+                return
+
+        if timeout != 0:
+            message = (
+                f"Unable to communicate with the Microcontroller. The serial port {self._port_name} was disconnected "
+                f"({error}), and the Microcontroller was not reconnected within {timeout} microseconds."
+            )
+        else:
+            message = (
+                f"Unable to communicate with the Microcontroller. The serial port {self._port_name} was disconnected "
+                f"({error}). Use the reconnect() method to reopen the port once the Microcontroller is reconnected."
+            )
+        console.error(message=message, error=ConnectionError)
+
+    def reset_transmission_buffer(self) -> None:
+        """Resets the instance's transmission buffer, discarding any stored data."""
+        with self._tx.lock:
+            self._tx.bytes_in_buffer = 0
+
+    def reset_reception_buffer(self) -> None:
+        """Resets the instance's reception buffer, discarding any stored data."""
+        with self._rx.lock:
+            self._rx.bytes_in_buffer = 0
+            self._rx.encoded_size = 0
+            self._rx.consumed_bytes = 0
+
+    def peek_payload(self) -> int:
+        """Returns the value of the first byte of the received payload without consuming it.
+
+        Use this method to route or discard the received payloads based on their first byte (for example, the message
+        protocol code). If lazy decoding is enabled and the payload has not been accessed yet, the method returns the
+        byte extracted from the encoded packet during its verification, without decoding the payload.
+
+        Returns:
+            The value of the first payload byte, regardless of how many payload bytes have been consumed by read_data()
+            calls.
+
+        Raises:
+            RuntimeError: If the reception buffer does not store a received payload.
+        """
+        with self._rx.lock:
+            if self._rx.encoded_size:
+                if self._rx.first_byte >= 0:
+                    return self._rx.first_byte
+
+                # If the packet does not store a valid encoded payload, decodes it to raise the decoding error.
+                self._decode_pending_payload()
+
+            if self._rx.bytes_in_buffer == 0:
+                message = (
+                    "Unable to peek at the received payload. The reception buffer does not store a payload. Call "
+                    "receive_data() to receive a payload before peeking at it."
+                )
+                console.error(message=message, error=RuntimeError)
+            return int(self._rx.buffer[0])
+
+    def hold_payload(self) -> HeldPayload:
+        """Holds the last received payload in its reception slot, so that it stays valid while the instance receives
+        the next payloads.
+
+        The returned HeldPayload provides a zero-copy, read-only view of the whole payload, regardless of how many of
+        its bytes have been consumed by read_data() calls. The payload can still be read with the read_data() method
+        until the next payload is received. The next call to receive_data() switches to a free reception slot, so the
+        held payload is not overwritten until it is released.
+
+        Notes:
+            The number of payloads that can be held at the same time is limited by the number of reception slots
+            configured at initialization. If all slots store held payloads, receive_data() leaves the incoming packets
+            unprocessed and returns False until at least one payload is released. With a single
+            reception slot, the instance cannot receive the next payload until the held payload is released.
+
+        Returns:
+            The HeldPayload instance that stores the view of the payload. Release it when it is no longer needed.
+
+        Raises:
+            RuntimeError: If the reception buffer does not store a received payload or if the payload is already held.
+        """
+        with self._rx.lock:
+            self._decode_pending_payload()
+            if self._rx.bytes_in_buffer == 0:
+                message = (
+                    "Unable to hold the received payload. The reception buffer does not store a payload. Call "
+                    "receive_data() to receive a payload before holding it."
+                )
+                console.error(message=message, error=RuntimeError)
+            if not self._rx.hold_slot():
+                message = (
+                    "Unable to hold the received payload. The payload stored in the reception buffer is already held."
+                )
+                console.error(message=message, error=RuntimeError)
+
+            data = self._rx.buffer[: self._rx.bytes_in_buffer]
+            data.flags.writeable = False
+            return HeldPayload(data=data, reception_path=self._rx, slot_index=self._rx.slot_index)
+
+    def write_data(
+        self,
+        data_object: Any,
+    ) -> None:
+        """Serializes and writes the input object's data to the end of the payload stored in the instance's transmission
+        buffer.
+
+        Notes:
+            At this time, the method only works with numpy scalars and arrays, as well as python dataclasses entirely
+            made out of valid numpy types.
+
+            The maximum runtime speed for this method is achieved when writing data as numpy arrays, which is optimized
+            to a single write operation. The minimum runtime speed is achieved by writing dataclasses, as it involves
+            looping over dataclass attributes. When writing dataclasses, all attributes are serialized and written
+            as a consecutive data block.
+
+        Args:
+            data_object: A numpy scalar or array object or a python dataclass made entirely out of valid numpy objects.
+                Supported numpy types are: uint8, uint16, uint32, uint64, int8, int16, int32, int64, float32, float64,
+                and bool. Arrays can have any number of dimensions and memory layout, but have to be non-empty to be
+                supported. Their elements are written in the C (row-major) order. BitField instances (including
+                dataclass fields) are written as bit-packed data blocks. VarintArray instances are written using the
+                variable-length integer encoding.
+
+        Raises:
+            TypeError: If the input object is not a supported numpy scalar, numpy array, or python dataclass.
+            ValueError: If the transmission buffer does not have enough space to accommodate the written object's data.
+                If the input object is an empty numpy array. If the input BitField's values do not fit into the bit
+                widths of their fields.
+        """
+        # Prevents other threads from modifying the transmission buffer while the object's data is being written.
+        with self._tx.lock:
+            self._write_data(data_object=data_object)
+
+    def _write_data(
+        self,
+        data_object: Any,
+    ) -> None:
+        """Serializes and writes the input object's data to the end of the payload stored in the transmission buffer.
+
+        This worker method implements write_data() and expects the caller to hold the transmission lock.
+        """
+        end_index = -10  # Initializes to a specific negative value that is not a valid index or runtime error code
+
+        # Resolves the index at which to start writing the object's data.
+        start_index = self._tx.bytes_in_buffer
+
+        # If the input object is a supported numpy scalar, calls the scalar data writing method.
+        if isinstance(data_object, self._accepted_numpy_scalars):
+            end_index = self._write_scalar_data(self._tx.buffer, data_object, start_index)
+
+        # If the input object is a numpy array, first ensures that it's datatype matches one of the accepted scalar
+        # numpy types and, if so, calls the array data writing method.
+        elif isinstance(data_object, np.ndarray) and data_object.dtype in self._accepted_numpy_scalars:
+            end_index = self._write_array_data(self._tx.buffer, data_object, start_index)
+
+        # If the input object is a bit field, converts its values to a common datatype and calls the bit-packing write
+        # method.
+        elif isinstance(data_object, BitField):
+            end_index = self._write_bit_field_data(
+                self._tx.buffer, data_object.values.astype(np.uint64), data_object.widths, start_index
+            )
+
+        # If the input object is a variable-length integer array, converts its values to the common bit pattern
+        # representation and calls the LEB128 write method.
+        elif isinstance(data_object, VarintArray):
+            end_index = self._write_varint_data(
+                self._tx.buffer, data_object.bits, data_object.signed, data_object.delta, start_index
+            )
+
+        # If the input object is a python dataclass, iteratively loops over each field of the class and recursively
+        # calls write_data() to write each attribute of the class to the buffer. This implementation supports using
+        # this function for any dataclass that stores numpy scalars or arrays, replicating the behavior of the
+        # Microcontroller TransportLayer class.
+        elif is_dataclass(data_object):
+            # Loops over each field (attribute) of the dataclass and writes it to the buffer
+            # noinspection PyDataclass
+            for field in fields(data_object):
+                # Calls the write method recursively onto the value of each field
+                data_value = getattr(data_object, field.name)
+
+                # If this call fails, it raises an error that terminates this loop early
+                self._write_data(data_object=data_value)
+
+            # The recurrent write_data calls resolve errors and update the payload size trackers as necessary, so if
+            # the method runs without errors, returns to caller without further processing
+            return
+
+        # Unsupported input type error
+        else:
+            message = (
+                f"Failed to write the data to the transmission buffer. Encountered an unsupported input data_object "
+                f"type ({type(data_object).__name__}). At this time, only the following numpy scalar or array "
+                f"types are supported: {self._accepted_numpy_scalars}. Alternatively, a dataclass with all attributes "
+                f"set to supported numpy scalar or array types is also supported."
+            )
+            console.error(message=message, error=TypeError)
+
+        # If the end_index exceeds the start_index, that means that an appropriate write operation was executed
+        # successfully. In that case, updates the transmission buffer payload size tracker
+        if end_index > start_index:
+            self._tx.bytes_in_buffer = end_index
+        elif end_index == TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR:
+            message = (
+                f"Failed to write the data to the transmission buffer. The transmission buffer does not have enough "
+                f"space to write the data starting at the index {start_index}. Specifically, given the data size of "
+                f"{data_object.nbytes} bytes, the required buffer size is {start_index + data_object.nbytes} bytes, "
+                f"but the available size is {self._tx.buffer.size} bytes."
+            )
+            console.error(message=message, error=ValueError)
+        elif end_index == TransportLayerStatus.EMPTY_ARRAY_ERROR:
+            message = (
+                "Failed to write the data to the transmission buffer. Encountered an empty (size 0) numpy array as "
+                "input data_object. Writing empty arrays is not supported."
+            )
+            console.error(message=message, error=ValueError)
+        elif end_index == TransportLayerStatus.BIT_FIELD_OVERFLOW_ERROR:
+            message = (
+                f"Failed to write the data to the transmission buffer. At least one of the input BitField values "
+                f"{data_object.values.tolist()} does not fit into the bit width of its field "
+                f"{data_object.widths.tolist()}."
+            )
+            console.error(message=message, error=ValueError)
+        else:
+            message = (
+                f"Failed to write the data to the transmission buffer. Encountered an unknown error code ({end_index}) "
+                f"returned by the writer method."
+            )  # pragma: no cover
+            console.error(message=message, error=RuntimeError)  # pragma: no cover
+
+            # This fallback is to appease MyPy and cannot be reached
+            raise RuntimeError(message)  # pragma: no cover
+
+    def write_many(self, *data_objects: Any, layout: MessageLayout | None = None) -> None:
+        """Serializes and writes all input objects' data to the end of the payload stored in the instance's transmission
+        buffer as a single consecutive data block.
+
+        This method is the scatter-gather equivalent of calling write_data() for each input object in order. It
+        validates all objects and computes the size of the written block before modifying the buffer, and then copies
+        the data of all objects into the buffer in a single compiled pass. This removes the interpreter dispatch and
+        compiled function call overhead of each field, but without the layout, the type of each field still has to be
+        resolved and flattened during every call.
+
+        If the MessageLayout instance that describes the message is provided, the method only verifies that the
+        objects match the layout, gathers their data via the buffer protocol, and copies the gathered block into the
+        buffer at once. This keeps the staging time nearly constant regardless of the number of fields. Create the
+        layout once for each message structure and reuse it for all messages.
+
+        Notes:
+            The method supports numpy scalars and arrays, as well as python dataclasses made entirely out of numpy
+            scalars and arrays (including nested dataclasses). BitField and VarintArray objects use variable-size
+            encodings and have to be written with the write_data() method.
+
+            The write operation is atomic: if any object is not supported or the data of all objects does not fit into
+            the transmission buffer, the method does not write any data to the buffer.
+
+            The copy pass is compiled separately for each unique sequence of object datatypes, dimensions, and memory
+            layouts, so the first call for each message layout is slower than the following calls.
+
+        Args:
+            *data_objects: The numpy scalars, numpy arrays, or python dataclasses to write to the transmission buffer,
+                in the order in which to write them. Supported numpy types are: uint8, uint16, uint32, uint64, int8,
+                int16, int32, int64, float32, float64, and bool. Arrays can have any number of dimensions and memory
+                layout, but have to be non-empty to be supported.
+            layout: The MessageLayout instance that describes the written objects or None to resolve the objects
+                during the call.
+
+        Raises:
+            TypeError: If any input object is not a supported numpy scalar, numpy array, or python dataclass. If the
+                input objects do not match the provided layout.
+            ValueError: If the transmission buffer does not have enough space to accommodate the written objects' data.
+                If any input object is an empty numpy array.
+        """
+        # Prevents other threads from modifying the transmission buffer while the objects' data is being written.
+        with self._tx.lock:
+            start_index = self._tx.bytes_in_buffer
+            if layout is not None:
+                objects = layout.flatten(data_objects=data_objects, operation="write")
+
+                # Arrays that are not C-contiguous do not support the buffer protocol. Such messages are copied by the
+                # compiled pass below.
+                try:
+                    data = b"".join(objects)
+                except TypeError:
+                    data = None
+                end_index = start_index + layout.nbytes
+                if data is not None and end_index <= self._tx.buffer.size:
+                    # Copies the gathered block through the buffer's memoryview, which avoids wrapping it in an array.
+                    self._tx.buffer.data[start_index:end_index] = data
+                    self._tx.bytes_in_buffer = end_index
+                    return
+            else:
+                objects = self._flatten_objects(data_objects=data_objects, operation="write")
+                if not objects:
+                    return
+
+            end_index = self._write_object_set(self._tx.buffer, start_index, *objects)
+
+            if end_index > start_index:
+                self._tx.bytes_in_buffer = end_index
+            elif end_index == TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR:
+                data_size = sum(data_object.nbytes for data_object in objects)
+                message = (
+                    f"Failed to write the data to the transmission buffer. The transmission buffer does not have "
+                    f"enough space to write the data starting at the index {start_index}. Specifically, given the data "
+                    f"size of {data_size} bytes, the required buffer size is {start_index + data_size} bytes, but the "
+                    f"available size is {self._tx.buffer.size} bytes."
+                )
+                console.error(message=message, error=ValueError)
+            elif end_index == TransportLayerStatus.EMPTY_ARRAY_ERROR:
+                message = (
+                    "Failed to write the data to the transmission buffer. Encountered an empty (size 0) numpy array as "
+                    "input data_object. Writing empty arrays is not supported."
+                )
+                console.error(message=message, error=ValueError)
+
+    def _flatten_objects(self, data_objects: tuple[Any, ...], operation: str) -> tuple[Any, ...]:
+        """Flattens the input objects into the sequence of numpy scalars and arrays processed by write_many() and
+        read_many().
+
+        Dataclasses are replaced with the values of their fields. When flattening the objects for a read operation,
+        scalars and read-only arrays are replaced with new writeable arrays of the same datatype and shape (scalars use
+        zero-dimensional arrays), and writeable arrays are filled in place.
+
+        Args:
+            data_objects: The objects to flatten.
+            operation: The performed operation, either 'write' or 'read'.
+
+        Returns:
+            A tuple that stores the numpy scalars and arrays that make up the input objects, in the order of their data.
+
+        Raises:
+            TypeError: If any input object is not a supported numpy scalar, numpy array, or python dataclass.
+        """
+        reading = operation == "read"
+        objects: list[Any] = []
+        for data_object in data_objects:
+            if isinstance(data_object, np.ndarray) and data_object.dtype in self._accepted_dtypes:
+                writeable = data_object.flags.writeable or not reading
+                objects.append(data_object if writeable else np.empty_like(data_object))
+            elif type(data_object) in self._accepted_scalar_types:
+                objects.append(np.empty((), dtype=data_object.dtype) if reading else data_object)
+            elif is_dataclass(data_object) and not isinstance(data_object, type):
+                # noinspection PyDataclass
+                attributes = tuple(getattr(data_object, field.name) for field in fields(data_object))
+                objects.extend(self._flatten_objects(data_objects=attributes, operation=operation))
+            else:
+                buffer_name = "reception" if reading else "transmission"
+                direction = "from" if reading else "to"
+                message = (
+                    f"Failed to {operation} the data {direction} the {buffer_name} buffer. Encountered an unsupported "
+                    f"input data_object type ({type(data_object).__name__}). The {operation}_many() method only "
+                    f"supports the following numpy scalar or array types: {self._accepted_numpy_scalars}, and "
+                    f"dataclasses with all attributes set to supported numpy scalar or array types. Use the "
+                    f"{operation}_data() method to {operation} BitField and VarintArray objects."
+                )
+                console.error(message=message, error=TypeError)
+        return tuple(objects)
+
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _write_scalar_data(
+        target_buffer: NDArray[np.uint8],
+        scalar_object: Any,
+        start_index: int,
+    ) -> int:
+        """Converts the input numpy scalar to a sequence of bytes and writes it to the transmission buffer at the
+        specified start_index.
+
+        Args:
+            target_buffer: The buffer where to write the data.
+            scalar_object: The scalar numpy object to be written to the transmission buffer.
+            start_index: The index inside the transmission buffer at which to start writing the data.
+
+        Returns:
+            The positive index inside the transmission buffer that immediately follows the last index of the buffer to
+            which the data was written. One of the TransportLayerStatus if the method encounters a runtime error.
+        """
+        # Converts the input scalar to a byte array. This is mostly so that Numba can work with the data via the
+        # service method calls below. Note, despite the input being scalar, the array object may have multiple elements.
+        array_object = np.frombuffer(np.array([scalar_object]), dtype=np.uint8)  # scalar → array → byte array
+
+        # Calculates the required space inside the buffer to store the data inserted at the start_index
+        data_size = array_object.size * array_object.itemsize  # Size of each element * the number of elements
+        required_size = start_index + data_size
+
+        # If the space to store the data extends outside the available transmission_buffer boundaries, returns 0.
+        if required_size > target_buffer.size:
+            return TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+
+        # Writes the data to the buffer.
+        target_buffer[start_index:required_size] = array_object
+
+        # Returns the required_size, which incidentally also matches the index that immediately follows the last index
+        # of the buffer that was overwritten with the input data.
+        return required_size
+
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _write_array_data(
+        target_buffer: NDArray[np.uint8],
+        array_object: NDArray[Any],
+        start_index: int,
+    ) -> int:
+        """Converts the input numpy array to a sequence of bytes and writes it to the transmission buffer at the
+        specified start_index.
+
+        Notes:
+            The array can have any number of dimensions and memory layout. Its elements are written in the C
+            (row-major) order, so the written data matches the data of the array's C-contiguous copy. Since the method
+            is compiled separately for each array layout, C-contiguous arrays are written as a single block copy, and
+            strided or otherwise non-contiguous arrays are gathered into the buffer without an intermediate copy.
+
+        Args:
+            target_buffer: The buffer where to write the data.
+            array_object: The numpy array to be written to the transmission buffer.
+            start_index: The index inside the transmission buffer at which to start writing the data.
+
+        Returns:
+            The positive index inside the transmission buffer that immediately follows the last index of the buffer to
+            which the data was written. One of the TransportLayerStatus if the method encounters a runtime error.
+        """
+        if array_object.size == 0:
+            return TransportLayerStatus.EMPTY_ARRAY_ERROR.value
+
+        # Calculates the required space inside the buffer to store the data inserted at the start_index
+        required_size = start_index + array_object.nbytes
+
+        if required_size > target_buffer.size:
+            return TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+
+        # Views the target region of the buffer as a C-contiguous array with the input array's datatype and shape and
+        # copies the input array's elements into the view.
+        target = target_buffer[start_index:required_size].view(array_object.dtype)
+        target.reshape(array_object.shape)[...] = array_object
+
+        # Returns the required_size, which incidentally also matches the index that immediately follows the last index
+        # of the buffer that was overwritten with the input data.
+        return required_size
+
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _write_object_set(
+        target_buffer: NDArray[np.uint8],
+        start_index: int,
+        *data_objects: Any,
+    ) -> int:
+        """Writes the data of all input numpy scalars and arrays to the transmission buffer as a consecutive data block
+        that starts at the specified start_index.
+
+        Notes:
+            The objects are accepted as separate arguments, rather than a tuple, as Numba resolves the types of
+            positional arguments faster than the types of tuple elements. The loops over the objects are unrolled at
+            compile time, and each object is copied using the same code as the _write_array_data() method (scalars are
+            viewed as zero-dimensional arrays). The method verifies that all arrays are non-empty and that all objects
+            fit into the buffer before writing any data.
+
+        Args:
+            target_buffer: The buffer where to write the data.
+            start_index: The index inside the transmission buffer at which to start writing the data.
+            *data_objects: The numpy scalars and arrays to be written to the transmission buffer, in the order in which
+                to write them.
+
+        Returns:
+            The positive index inside the transmission buffer that immediately follows the last index of the buffer to
+            which the data was written. One of the TransportLayerStatus if the method encounters a runtime error.
+        """
+        required_size = start_index
+        for data_object in literal_unroll(data_objects):
+            array_object = np.asarray(data_object)
+            if array_object.size == 0:
+                return TransportLayerStatus.EMPTY_ARRAY_ERROR.value
+            required_size += array_object.nbytes
+
+        if required_size > target_buffer.size:
+            return TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+
+        end_index = start_index
+        for data_object in literal_unroll(data_objects):
+            array_object = np.asarray(data_object)
+            start_index = end_index
+            end_index = start_index + array_object.nbytes
+            target = target_buffer[start_index:end_index].view(array_object.dtype)
+            target.reshape(array_object.shape)[...] = array_object
+
+        return required_size
+
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _write_bit_field_data(
+        target_buffer: NDArray[np.uint8],
+        values: NDArray[np.uint64],
+        widths: NDArray[np.uint8],
+        start_index: int,
+    ) -> int:
+        """Packs the input bit field values into a sequence of bytes and writes it to the transmission buffer at the
+        specified start_index.
+
+        Args:
+            target_buffer: The buffer where to write the data.
+            values: The values of the bit fields, cast to uint64.
+            widths: The bit width of each field.
+            start_index: The index inside the transmission buffer at which to start writing the data.
+
+        Returns:
+            The positive index inside the transmission buffer that immediately follows the last index of the buffer to
+            which the data was written. One of the TransportLayerStatus if the method encounters a runtime error.
+        """
+        # Verifies that each value fits into its field and calculates the number of bytes used by all fields.
+        total_bits = 0
+        for i in range(values.size):
+            if widths[i] < _MAXIMUM_BIT_WIDTH and values[i] >> np.uint64(widths[i]) != 0:
+                return TransportLayerStatus.BIT_FIELD_OVERFLOW_ERROR.value
+            total_bits += widths[i]
+        required_size = start_index + (total_bits + 7) // 8
+
+        if required_size > target_buffer.size:
+            return TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+
+        # Clears the written region, as the fields are OR-ed into the buffer.
+        target_buffer[start_index:required_size] = 0
+
+        # Writes each field in chunks that end at the next byte boundary, so each loop iteration fills a whole byte
+        # unless the field ends first.
+        position = 0  # The bit offset from the start_index
+        for i in range(values.size):
+            value = values[i]
+            remaining = int(widths[i])
+            while remaining > 0:
+                offset = position & 7
+                chunk_size = min(8 - offset, remaining)
+                chunk = value & np.uint64((1 << chunk_size) - 1)
+                target_buffer[start_index + (position >> 3)] |= np.uint8(chunk << np.uint64(offset))
+                value >>= np.uint64(chunk_size)
+                remaining -= chunk_size
+                position += chunk_size
+
+        # Returns the required_size, which incidentally also matches the index that immediately follows the last index
+        # of the buffer that was overwritten with the input data.
+        return required_size
+
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _write_varint_data(
+        target_buffer: NDArray[np.uint8],
+        bits: NDArray[np.uint64],
+        signed: bool,
+        delta: bool,
+        start_index: int,
+    ) -> int:
+        """Encodes the input values using the LEB128 scheme and writes them to the transmission buffer at the specified
+        start_index.
+
+        Args:
+            target_buffer: The buffer where to write the data.
+            bits: The values to encode as 64-bit two's complement bit patterns.
+            signed: Determines whether the values (or their deltas) are zigzag-encoded.
+            delta: Determines whether each value is encoded as the difference from the previous value.
+            start_index: The index inside the transmission buffer at which to start writing the data.
+
+        Returns:
+            The positive index inside the transmission buffer that immediately follows the last index of the buffer to
+            which the data was written. One of the TransportLayerStatus if the method encounters a runtime error.
+        """
+        # Resolves the encoded size first to avoid partially writing the data if it does not fit into the buffer.
+        required_size = start_index + int(_varint_sizes(bits, signed, delta).sum())
+        if required_size > target_buffer.size:
+            return TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+
+        index = start_index
+        previous = np.uint64(0)
+        for i in range(bits.size):
+            if delta:
+                value = _zigzag_encode(bits[i] - previous)
+            elif signed:
+                value = _zigzag_encode(bits[i])
+            else:
+                value = bits[i]
+            previous = bits[i]
+
+            # Writes 7 bits per byte, setting the most significant bit of every byte except the last one.
+            while value >= np.uint64(0x80):
+                target_buffer[index] = np.uint8((value & np.uint64(0x7F)) | np.uint64(0x80))
+                value >>= np.uint64(7)
+                index += 1
+            target_buffer[index] = np.uint8(value)
+            index += 1
+
+        # Returns the required_size, which incidentally also matches the index that immediately follows the last index
+        # of the buffer that was overwritten with the input data.
+        return required_size
+
+    def read_data(
+        self,
+        data_object: Any,
+    ) -> Any:
+        """Overwrites the input object's data with the data from the instance's reception buffer, consuming (discarding)
+        all read bytes.
+
+        This method deserializes the objects stored in the reception buffer as a sequence of bytes. Calling this method
+        consumes the read bytes, making it impossible to retrieve the same data from the reception buffer again.
+
+        Notes:
+            At this time, the method only works with valid numpy scalars and arrays as well as python dataclasses
+            entirely made out of valid numpy types.
+
+            The maximum runtime speed of this method is achieved when reading data as numpy arrays, which is
+            optimized to a single read operation. The minimum runtime speed is achieved by reading dataclasses, as it
+            involves looping over dataclass attributes.
+
+        Args:
+            data_object: An initialized numpy scalar or array object or a python dataclass made entirely out of valid
+                numpy objects. Supported numpy types are: uint8, uint16, uint32, uint64, int8, int16, int32, int64,
+                float32, float64, and bool. Array prototypes can have any number of dimensions and memory layout, but
+                have to be non-empty to be supported. Writeable array prototypes are filled in place (in the C
+                order) and returned, so reusing the same prototype for each message avoids allocating a new array.
+                BitField prototypes (including dataclass fields) are read from bit-packed data blocks. VarintArray
+                prototypes are read using the variable-length integer encoding.
+
+        Returns:
+            The deserialized data object extracted from the instance's reception buffer.
+
+        Raises:
+            TypeError: If the input object is not a supported numpy scalar, numpy array, or python dataclass.
+            ValueError: If the payload stored inside the reception buffer does not have enough unconsumed bytes
+                available to reconstruct the requested object. If the input object is an empty numpy array.
+        """
+        # Prevents other threads from modifying the reception buffer while the object's data is being read.
+        with self._rx.lock:
+            if self._rx.encoded_size:
+                self._decode_pending_payload()
+            return self._read_data(data_object=data_object)
+
+    def _read_data(
+        self,
+        data_object: Any,
+    ) -> Any:
+        """Overwrites the input object's data with the data from the reception buffer, consuming all read bytes.
+
+        This worker method implements read_data() and expects the caller to hold the reception lock.
+        """
+        end_index = -10  # Initializes to a specific negative value that is not a valid index or runtime error code
+
+        # Computes the index at which to start reading the input object's data based on the number of bytes already
+        # consumed from the buffer.
+        start_index = self._rx.consumed_bytes
+
+        # If the input object is a supported numpy scalar, converts it to a numpy array and calls the read method.
+        # Converts the returned one-element array back to a scalar numpy type. Due to current Numba limitations, this
+        # is the most efficient available method.
+        if isinstance(data_object, self._accepted_numpy_scalars):
+            returned_object = np.empty(1, dtype=data_object.dtype)
+            end_index = self._read_array_data(self._rx.buffer, returned_object, start_index, self._rx.bytes_in_buffer)
+            out_object = returned_object[0]
+
+        # If the input object is a numpy array, first ensures that its datatype matches one of the accepted scalar
+        # numpy types and, if so, calls the array data reading method. The method fills the prototype in place. If the
+        # prototype is read-only, fills a new array with the prototype's datatype and shape instead.
+        elif isinstance(data_object, np.ndarray):
+            if data_object.dtype in self._accepted_numpy_scalars:
+                out_object = data_object if data_object.flags.writeable else np.empty_like(data_object)
+                end_index = self._read_array_data(self._rx.buffer, out_object, start_index, self._rx.bytes_in_buffer)
+
+        # If the input object is a bit field, unpacks the values into a new BitField instance that uses the same
+        # datatype and field widths as the input prototype.
+        elif isinstance(data_object, BitField):
+            values, end_index = self._read_bit_field_data(
+                self._rx.buffer, data_object.widths, start_index, self._rx.bytes_in_buffer
+            )
+            if end_index > start_index:
+                out_object = BitField(values=values.astype(data_object.values.dtype), widths=data_object.widths)
+
+        # If the input object is a variable-length integer array, decodes the number of values stored in the prototype
+        # into a new VarintArray instance that uses the same datatype and encoding as the prototype.
+        elif isinstance(data_object, VarintArray):
+            bits, end_index = self._read_varint_data(
+                self._rx.buffer,
+                data_object.values.size,
+                data_object.signed,
+                data_object.delta,
+                start_index,
+                self._rx.bytes_in_buffer,
+            )
+            if end_index > start_index:
+                out_object = data_object.from_bits(bits)
+
+        # If the input object is a python dataclass, enters a recursive loop which calls this method for each class
+        # attribute. This allows retrieving and overwriting each attribute with the bytes read from the buffer,
+        # similar to the Microcontroller TransportLayer class.
+        elif is_dataclass(data_object):
+            # Loops over each field of the dataclass
+            # noinspection PyDataclass
+            for field in fields(data_object):
+                # Calls the reader function recursively onto each field of the class
+                attribute_value = getattr(data_object, field.name)
+                attribute_object = self._read_data(data_object=attribute_value)
+
+                # Updates the field in the original dataclass instance with the read object
+                setattr(data_object, field.name, attribute_object)
+
+            # The recurrent read_data calls resolve errors and update the payload size trackers as necessary, so if
+            # the method runs without errors, returns to caller without further processing
+            return data_object
+
+        # If the input value is not a valid numpy scalar, an array using a valid scalar datatype or a python dataclass
+        # raises TypeError exception.
+        else:
+            message = (
+                f"Failed to read the data from the reception buffer. Encountered an unsupported input data_object "
+                f"type ({type(data_object).__name__}). At this time, only the following numpy scalar or array types "
+                f"are supported: {self._accepted_numpy_scalars}. Alternatively, a dataclass with all attributes "
+                f"set to supported numpy scalar or array types is also supported."
+            )
+            console.error(message=message, error=TypeError)
+
+        # If end_index is different from the start_index and no error has been raised, the method runtime was
+        # successful, so returns the read data_object and the end_index to the caller
+        if end_index > start_index:
+            # Updates the consumed bytes tracker adn returns the object recreated using data from the buffer
+            self._rx.consumed_bytes = end_index
+            # noinspection PyUnboundLocalVariable
+            return out_object
+        if end_index == TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR and isinstance(data_object, VarintArray):
+            message = (
+                f"Failed to read the data from the reception buffer. The reception buffer does not have enough "
+                f"unconsumed bytes to decode {data_object.values.size} variable-length integers. The available payload "
+                f"size is {self.bytes_in_reception_buffer - self._rx.consumed_bytes} bytes."
+            )
+            console.error(message=message, error=ValueError)
+        elif end_index == TransportLayerStatus.MALFORMED_VARINT_ERROR:
+            message = (
+                f"Failed to read the data from the reception buffer. Encountered a variable-length integer that uses "
+                f"more than {_MAXIMUM_VARINT_SIZE} bytes, which indicates that the payload does not store the "
+                f"requested VarintArray data."
+            )
+            console.error(message=message, error=ValueError)
+        elif end_index == TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR:
+            message = (
+                f"Failed to read the data from the reception buffer. The reception buffer does not have enough "
+                f"unconsumed bytes to recreate the object. Specifically, the object requires {data_object.nbytes} "
+                f"bytes, but the available payload size is {self.bytes_in_reception_buffer - self._rx.consumed_bytes} "
+                f"bytes."
+            )
+            console.error(message=message, error=ValueError)
+        elif end_index == TransportLayerStatus.EMPTY_ARRAY_ERROR:
+            message = (
+                "Failed to read the data from the reception buffer. Encountered an empty (size 0) numpy array as "
+                "input data_object. Reading empty arrays is not supported."
+            )
+            console.error(message=message, error=ValueError)
+
+        message = (
+            f"Failed to read the data from the reception buffer. Encountered an unknown error code ({end_index})"
+            f"returned by the reader method."
+        )  # pragma: no cover
+        console.error(message=message, error=RuntimeError)  # pragma: no cover
+
+        # Fallback to appease MyPy, will never be reached
+        raise RuntimeError(message)  # pragma: no cover
+
+    def read_many(self, *data_objects: Any, layout: MessageLayout | None = None) -> tuple[Any, ...]:
+        """Overwrites the input objects' data with the data from the instance's reception buffer, consuming (discarding)
+        all read bytes.
+
+        This method is the scatter-gather equivalent of calling read_data() for each input object in order. It
+        validates all objects and computes the size of the read block before consuming any data, and then copies the
+        data of all objects from the buffer in a single compiled pass.
+
+        If the MessageLayout instance that describes the message is provided, the method only verifies that the
+        prototypes match the layout and distributes the message's data to the returned objects directly from the
+        buffer. The only remaining per-field work is creating or filling the returned objects.
+
+        Notes:
+            The method supports numpy scalars and arrays, as well as python dataclasses made entirely out of numpy
+            scalars and arrays (including nested dataclasses). BitField and VarintArray objects use variable-size
+            encodings and have to be read with the read_data() method.
+
+            The read operation is atomic: if any object is not supported or the payload does not store enough
+            unconsumed bytes to recreate all objects, the method does not consume any data.
+
+        Args:
+            *data_objects: The initialized numpy scalars, numpy arrays, or python dataclasses to read from the
+                reception buffer, in the order in which their data is stored in the payload. Writeable array prototypes
+                and dataclasses are filled in place and returned.
+            layout: The MessageLayout instance that describes the prototypes or None to resolve the prototypes during
+                the call.
+
+        Returns:
+            A tuple that stores the deserialized objects in the same order as the input prototypes.
+
+        Raises:
+            TypeError: If any input object is not a supported numpy scalar, numpy array, or python dataclass. If the
+                input objects do not match the provided layout.
+            ValueError: If the payload stored inside the reception buffer does not have enough unconsumed bytes
+                available to reconstruct the requested objects. If any input object is an empty numpy array.
+        """
+        # Prevents other threads from modifying the reception buffer while the objects' data is being read.
+        with self._rx.lock:
+            if self._rx.encoded_size:
+                self._decode_pending_payload()
+            start_index = self._rx.consumed_bytes
+            if layout is not None:
+                arrays = layout.flatten(data_objects=data_objects, operation="read")
+                end_index = start_index + layout.nbytes
+                if end_index <= self._rx.bytes_in_buffer:
+                    self._rx.consumed_bytes = end_index
+                    return layout.unpack(
+                        buffer=self._rx.buffer, start_index=start_index, data_objects=data_objects, objects=arrays
+                    )
+                end_index = TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+            else:
+                arrays = self._flatten_objects(data_objects=data_objects, operation="read")
+                if not arrays:
+                    return data_objects
+                end_index = self._read_array_set(self._rx.buffer, start_index, self._rx.bytes_in_buffer, *arrays)
+
+            if end_index > start_index:
+                self._rx.consumed_bytes = end_index
+                return self._restore_objects(data_objects=data_objects, arrays=iter(arrays))
+            if end_index == TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR:
+                message = (
+                    f"Failed to read the data from the reception buffer. The reception buffer does not have enough "
+                    f"unconsumed bytes to recreate the objects. Specifically, the objects require "
+                    f"{sum(array.nbytes for array in arrays)} bytes, but the available payload size is "
+                    f"{self.bytes_in_reception_buffer - self._rx.consumed_bytes} bytes."
+                )
+                console.error(message=message, error=ValueError)
+            message = (
+                "Failed to read the data from the reception buffer. Encountered an empty (size 0) numpy array as "
+                "input data_object. Reading empty arrays is not supported."
             )
-        return representation_string
+            console.error(message=message, error=ValueError)
 
-    @property
-    def available(self) -> bool:
-        """Returns True if enough bytes are available from the serial port to justify attempting to receive a packet."""
-        # in_waiting is twice as fast as using the read() method. The 'true' outcome of this check is capped at the
-        # minimum packet size to minimize the chance of having to call read() more than once. The method counts the
-        # bytes available for reading and left over from previous packet parsing operations.
-        return (self._port.in_waiting + len(self._leftover_bytes)) >= self._minimum_packet_size
+            # Fallback to appease MyPy, will never be reached
+            raise ValueError(message)  # pragma: no cover
 
-    @property
-    def transmission_buffer(self) -> NDArray[np.uint8]:
-        """Returns a copy of the transmission buffer array.
+    def _restore_objects(self, data_objects: tuple[Any, ...], arrays: Iterator[NDArray[Any]]) -> tuple[Any, ...]:
+        """Rebuilds the objects flattened by the _flatten_objects() method from the arrays filled by read_many().
 
-        This buffer stores the 'staged' data to be sent to the Microcontroller. Use this method to safely access the
-        contents of the buffer.
+        Args:
+            data_objects: The prototype objects passed to read_many().
+            arrays: An iterator over the filled arrays returned by the _flatten_objects() method.
+
+        Returns:
+            A tuple that stores the deserialized objects in the same order as the input prototypes.
         """
-        return self._transmission_buffer.copy()
+        restored: list[Any] = []
+        for data_object in data_objects:
+            if isinstance(data_object, np.ndarray):
+                restored.append(next(arrays))
+            elif type(data_object) in self._accepted_scalar_types:
+                restored.append(next(arrays)[()])
+            else:
+                # noinspection PyDataclass
+                field_names = tuple(field.name for field in fields(data_object))
+                attributes = self._restore_objects(
+                    data_objects=tuple(getattr(data_object, name) for name in field_names), arrays=arrays
+                )
+                for name, attribute in zip(field_names, attributes, strict=True):
+                    setattr(data_object, name, attribute)
+                restored.append(data_object)
+        return tuple(restored)
 
-    @property
-    def reception_buffer(self) -> NDArray[np.uint8]:
-        """Returns a copy of the reception buffer array.
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _read_array_data(
+        source_buffer: NDArray[np.uint8],
+        array_object: NDArray[Any],
+        start_index: int,
+        payload_size: int,
+    ) -> int:
+        """Reads the data of the requested array_object from the instance's reception buffer into the array_object.
 
-        This buffer stores the decoded data received from the Microcontroller. Use this method to safely access the
-        contents of the buffer.
+        Notes:
+            The array can have any number of dimensions and memory layout. Its elements are filled in the C (row-major)
+            order, mirroring the _write_array_data() method.
+
+        Args:
+            source_buffer: The buffer from which to read the data.
+            array_object: The writeable numpy array to be filled with the data read from the reception buffer.
+            start_index: The index inside the reception buffer at which to start reading the data.
+            payload_size: The number of payload bytes currently stored inside the buffer.
+
+        Returns:
+            The index that immediately follows the last index that was read during method runtime to support chained
+            read calls. If method runtime fails, returns one of the TransportLayerStatus values.
         """
-        return self._reception_buffer.copy()
+        # Calculates the end index for the read operation. This is based on how many bytes are required to represent the
+        # object and the start_index for the read operation.
+        required_size = start_index + array_object.nbytes
 
-    @property
-    def bytes_in_transmission_buffer(self) -> int:
-        """Returns the number of payload bytes stored inside the instance's transmission buffer."""
-        return self._bytes_in_transmission_buffer
+        # Prevents reading outside the payload boundaries.
+        if required_size > payload_size:
+            return TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
 
-    @property
-    def bytes_in_reception_buffer(self) -> int:
-        """Returns the number of payload bytes stored inside the instance's reception buffer."""
-        return self._bytes_in_reception_buffer
+        # Prevents reading empty numpy arrays
+        if array_object.size == 0:
+            return TransportLayerStatus.EMPTY_ARRAY_ERROR.value
 
-    def reset_transmission_buffer(self) -> None:
-        """Resets the instance's transmission buffer, discarding any stored data."""
-        self._bytes_in_transmission_buffer = 0
+        # Views the source region of the buffer as a C-contiguous array with the array_object's datatype and shape and
+        # copies its elements into the array_object.
+        source = source_buffer[start_index:required_size].view(array_object.dtype)
+        array_object[...] = source.reshape(array_object.shape)
+        return required_size
 
-    def reset_reception_buffer(self) -> None:
-        """Resets the instance's reception buffer, discarding any stored data."""
-        self._bytes_in_reception_buffer = 0
-        self._consumed_bytes = 0
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _read_array_set(
+        source_buffer: NDArray[np.uint8],
+        start_index: int,
+        payload_size: int,
+        *arrays: NDArray[Any],
+    ) -> int:
+        """Fills all input arrays with the data of the consecutive data block stored in the reception buffer at the
+        specified start_index.
 
-    def write_data(
+        Notes:
+            Similar to the _write_object_set() method, the arrays are accepted as separate arguments, and the loops
+            over the arrays are unrolled at compile time. Each array is filled using the same code as the
+            _read_array_data() method. The method verifies that all arrays are non-empty and that the payload stores
+            their data before reading any data.
+
+        Args:
+            source_buffer: The buffer from which to read the data.
+            start_index: The index inside the reception buffer at which to start reading the data.
+            payload_size: The number of payload bytes currently stored inside the buffer.
+            *arrays: The writeable numpy arrays to be filled with the data read from the reception buffer, in the order
+                in which their data is stored in the buffer.
+
+        Returns:
+            The index that immediately follows the last index that was read during method runtime to support chained
+            read calls. If method runtime fails, returns one of the TransportLayerStatus values.
+        """
+        required_size = start_index
+        for array_object in literal_unroll(arrays):
+            if array_object.size == 0:
+                return TransportLayerStatus.EMPTY_ARRAY_ERROR.value
+            required_size += array_object.nbytes
+
+        if required_size > payload_size:
+            return TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+
+        end_index = start_index
+        for array_object in literal_unroll(arrays):
+            start_index = end_index
+            end_index = start_index + array_object.nbytes
+            source = source_buffer[start_index:end_index].view(array_object.dtype)
+            array_object[...] = source.reshape(array_object.shape)
+
+        return required_size
+
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _read_bit_field_data(
+        source_buffer: NDArray[np.uint8],
+        widths: NDArray[np.uint8],
+        start_index: int,
+        payload_size: int,
+    ) -> tuple[NDArray[np.uint64], int]:
+        """Reads and unpacks the bit field values from the instance's reception buffer.
+
+        Args:
+            source_buffer: The buffer from which to read the data.
+            widths: The bit width of each field.
+            start_index: The index inside the reception buffer at which to start reading the data.
+            payload_size: The number of payload bytes currently stored inside the buffer.
+
+        Returns:
+            A two-element tuple. The first element is the uint64 numpy array that stores the unpacked value of each
+            field. The second element is the index that immediately follows the last index that was read during method
+            runtime to support chained read calls. If method runtime fails, returns an empty numpy array as the first
+            element and one of the TransportLayerStatus values as the second element.
+        """
+        total_bits = 0
+        for i in range(widths.size):
+            total_bits += widths[i]
+        required_size = start_index + (total_bits + 7) // 8
+
+        # Prevents reading outside the payload boundaries.
+        if required_size > payload_size:
+            return np.empty(0, dtype=np.uint64), TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+
+        # Reads each field in chunks that end at the next byte boundary, mirroring the _write_bit_field_data() method.
+        values = np.empty(widths.size, dtype=np.uint64)
+        position = 0  # The bit offset from the start_index
+        for i in range(widths.size):
+            value = np.uint64(0)
+            shift = 0
+            remaining = int(widths[i])
+            while remaining > 0:
+                offset = position & 7
+                chunk_size = min(8 - offset, remaining)
+                chunk = (source_buffer[start_index + (position >> 3)] >> offset) & ((1 << chunk_size) - 1)
+                value |= np.uint64(chunk) << np.uint64(shift)
+                shift += chunk_size
+                remaining -= chunk_size
+                position += chunk_size
+            values[i] = value
+
+        return values, required_size
+
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _read_varint_data(
+        source_buffer: NDArray[np.uint8],
+        count: int,
+        signed: bool,
+        delta: bool,
+        start_index: int,
+        payload_size: int,
+    ) -> tuple[NDArray[np.uint64], int]:
+        """Reads and decodes the requested number of LEB128-encoded values from the instance's reception buffer.
+
+        Args:
+            source_buffer: The buffer from which to read the data.
+            count: The number of values to read.
+            signed: Determines whether the values (or their deltas) are zigzag-encoded.
+            delta: Determines whether each value is encoded as the difference from the previous value.
+            start_index: The index inside the reception buffer at which to start reading the data.
+            payload_size: The number of payload bytes currently stored inside the buffer.
+
+        Returns:
+            A two-element tuple. The first element is the uint64 numpy array that stores the decoded values as 64-bit
+            two's complement bit patterns. The second element is the index that immediately follows the last index that
+            was read during method runtime to support chained read calls. If method runtime fails, returns an empty
+            numpy array as the first element and one of the TransportLayerStatus values as the second element.
+        """
+        bits = np.empty(count, dtype=np.uint64)
+        index = start_index
+        previous = np.uint64(0)
+        for i in range(count):
+            value = np.uint64(0)
+            shift = 0
+            while True:
+                # Prevents reading outside the payload boundaries.
+                if index >= payload_size:
+                    return np.empty(0, dtype=np.uint64), TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+                if shift >= _MAXIMUM_VARINT_SIZE * 7:
+                    return np.empty(0, dtype=np.uint64), TransportLayerStatus.MALFORMED_VARINT_ERROR.value
+
+                byte = source_buffer[index]
+                index += 1
+                value |= np.uint64(byte & 0x7F) << np.uint64(shift)
+                shift += 7
+                if byte < 0x80:
+                    break
+
+            if delta:
+                previous += _zigzag_decode(value)
+                bits[i] = previous
+            else:
+                bits[i] = _zigzag_decode(value) if signed else value
+
+        return bits, index
+
+    def send_data(self) -> None:
+        """Packages the data inside the instance's transmission buffer into a serialized packet and transmits it
+        over the communication interface.
+
+        Notes:
+            This method resets the instance's transmission buffer after transmitting the data, discarding any data
+            stored inside the buffer.
+
+        Raises:
+            RuntimeError: If the non-blocking transmission mode is enabled and the transmission ring does not have
+                enough free space to store the packet. In this case, the transmission buffer is not reset.
+            ConnectionError: If the Microcontroller is disconnected and the automatic reconnection is disabled or
+                fails. If the automatic reconnection succeeds, the packet is lost, and the method returns normally.
+        """
+        # Prevents other threads from modifying the transmission buffer while its payload is being sent.
+        with self._tx.lock:
+            self._send_data()
+        self._resolve_disconnection()
+
+    def _send_data(self) -> None:
+        """Packages the data inside the transmission buffer into a serialized packet and transmits it.
+
+        This worker method implements send_data() and expects the caller to hold the transmission lock.
+        """
+        # In the non-blocking mode, ensures the packet can be stored in the ring before constructing it, as
+        # constructing the packet advances the delta transmission state.
+        if self._tx.ring.size != 0:
+            self._reserve_ring(size=self._max_packet_size)
+
+        # Hands the constructed packet off to the communication interface.
+        packet = self._build_packet(self._tx.buffer, self._tx.bytes_in_buffer)
+        if self._tx.tracker is not None:
+            self._tx.tracker.enqueue(packet_size=packet.size)
+        self._transmit(packet)
+
+        # Resets the transmission buffer to indicate that the payload was sent and prepare for sending the next
+        # payload.
+        self._tx.bytes_in_buffer = 0
+        self._tx.packet_count += 1
+
+    def _transmit(self, data: NDArray[np.uint8]) -> None:
+        """Hands the input packet bytes off to the communication interface.
+
+        In the blocking mode, the method returns once the serial port accepts all bytes. In the non-blocking mode, the
+        method writes the bytes that the serial port accepts without blocking and stores the rest in the transmission
+        ring. This worker method expects the caller to hold the transmission lock and, in the non-blocking mode, to
+        reserve the ring space for the bytes via the _reserve_ring() method.
+
+        Args:
+            data: The bytes of one or more constructed packets.
+        """
+        connection = self._reconnections
+        try:
+            if self._tx.ring.size == 0:
+                self._port.write(data.tobytes())
+            else:
+                # The new bytes are only written directly if no earlier bytes are pending, as they would otherwise be
+                # transmitted out of order. The _reserve_ring() method has already flushed as many pending bytes as
+                # possible.
+                written = self._write_port(data) if self._tx.ring_count == 0 else 0
+                if written < data.size:
+                    self._tx.push_ring(data[written:])
+        except OSError as error:
+            # The bytes that were being written when the Microcontroller was disconnected are lost.
+            self._tx.disconnection = (error, connection)
+
+        if self._tx.high_watermark != 0:
+            self._update_backpressure()
+
+    def _reserve_ring(self, size: int) -> None:
+        """Flushes the pending bytes of the transmission ring and ensures that the ring can store the requested number
+        of bytes.
+
+        This worker method expects the caller to hold the transmission lock.
+
+        Args:
+            size: The maximum number of bytes that the caller may store in the ring.
+
+        Raises:
+            RuntimeError: If the ring does not have enough free space to store the requested number of bytes.
+        """
+        self._flush_ring()
+        free_space = self._tx.ring.size - self._tx.ring_count
+        if free_space < size:
+            message = (
+                f"Unable to send the data. The transmission ring has {free_space} free bytes, but the transmitted "
+                f"packets may require up to {size} bytes. The serial port does not accept the data as fast as it is "
+                f"sent. Use the flush_transmission() method or the transmission watermarks to wait for the serial "
+                f"port to accept the pending bytes before sending more data."
+            )
+            console.error(message=message, error=RuntimeError)
+
+    def _flush_ring(self) -> None:
+        """Writes as many pending bytes of the transmission ring to the serial port as it accepts without blocking.
+
+        This worker method expects the caller to hold the transmission lock.
+        """
+        connection = self._reconnections
+        try:
+            while self._tx.ring_count != 0:
+                segment = self._tx.pending_segment()
+                written = self._write_port(segment)
+                self._tx.consume_ring(written)
+                if written < segment.size:
+                    return
+        except OSError as error:
+            self._tx.disconnection = (error, connection)
+
+    def _write_port(self, data: NDArray[np.uint8]) -> int:
+        """Writes as many of the input bytes to the serial port as it accepts without blocking.
+
+        Notes:
+            On Linux and macOS, the method writes the bytes with a single write() syscall on the serial port's
+            non-blocking file descriptor, as the pySerial's write() method keeps retrying until all bytes are written.
+            Otherwise, it uses the write() method of the serial port.
+
+        Args:
+            data: The bytes to write.
+
+        Returns:
+            The number of bytes accepted by the serial port.
+        """
+        if isinstance(self._port, Serial) and sys.platform != "win32":  # pragma: no cover
+            try:
+                return os.write(self._port.fileno(), data)
+            except BlockingIOError:
+                return 0
+        return int(self._port.write(data.tobytes()) or 0)
+
+    def _update_backpressure(self) -> None:
+        """Compares the transmission backlog to the watermarks and invokes the callback of the crossed watermark.
+
+        The backlog has to rise to the high watermark to start signaling backpressure and fall to the low watermark to
+        stop signaling it, so the callbacks are not invoked repeatedly while the backlog hovers around one watermark.
+        This worker method expects the caller to hold the transmission lock.
+        """
+        connection = self._reconnections
+        try:
+            backlog = self._tx.ring_count + self._port.out_waiting
+        except OSError as error:
+            self._tx.disconnection = (error, connection)
+            return
+        if not self._tx.throttled and backlog >= self._tx.high_watermark:
+            self._tx.throttled = True
+            if self._tx.on_high is not None:
+                self._tx.on_high()
+        elif self._tx.throttled and backlog <= self._tx.low_watermark:
+            self._tx.throttled = False
+            if self._tx.on_low is not None:
+                self._tx.on_low()
+
+    def flush_transmission(self, timeout: int = 0) -> bool:
+        """Writes the packet bytes stored in the transmission ring to the serial port.
+
+        In the non-blocking transmission mode, the pending ring bytes are flushed by every send_data() and
+        send_records() call. Use this method to flush the ring when no new data is sent, for example, from a dedicated
+        writer thread. The method only holds the transmission lock while writing, so other threads can send data
+        while the method waits for the serial port.
+
+        Args:
+            timeout: The maximum number of microseconds to wait for the serial port to accept all pending bytes. If 0,
+                the method only writes the bytes that the serial port accepts without blocking. While waiting, the
+                method sleeps for at most the wait strategy's poll interval between the writes.
+
+        Returns:
+            True if the ring does not store any pending bytes, False otherwise.
+
+        Raises:
+            ConnectionError: If the Microcontroller is disconnected and the automatic reconnection is disabled or
+                fails.
+        """
+        deadline = time.perf_counter_ns() + timeout * 1000
+        poller: select.poll | None = None
+        connection = -1
+        while True:
+            with self._tx.lock:
+                self._flush_ring()
+                if self._tx.high_watermark != 0:
+                    self._update_backpressure()
+                flushed = self._tx.ring_count == 0
+            self._resolve_disconnection()
+            if flushed:
+                return True
+
+            remaining = (deadline - time.perf_counter_ns()) // 1000
+            if remaining <= 0:
+                return False
+
+            # On Linux and macOS, wakes up as soon as the serial port can accept more bytes. The poll object is created
+            # once per call, as other threads may flush the ring at the same time, and again if the port is reopened.
+            interval = min(self._wait_strategy.poll_interval, remaining)
+            if isinstance(self._port, Serial) and sys.platform != "win32":  # pragma: no cover
+                if poller is None or connection != self._reconnections:
+                    connection = self._reconnections
+                    poller = select.poll()
+                    poller.register(self._port.fileno(), select.POLLOUT)
+                poller.poll(interval / 1000)
+            else:
+                time.sleep(interval / 1_000_000)
+
+    def set_transmission_watermarks(
         self,
-        data_object: Any,
+        high_watermark: int,
+        low_watermark: int,
+        on_high: Callable[[], None] | None = None,
+        on_low: Callable[[], None] | None = None,
     ) -> None:
-        """Serializes and writes the input object's data to the end of the payload stored in the instance's transmission
-        buffer.
+        """Configures the transmission backlog watermarks used to signal backpressure to the data producers.
 
-        Notes:
-            At this time, the method only works with numpy scalars and arrays, as well as python dataclasses entirely
-            made out of valid numpy types.
+        The transmission backlog is the sum of the bytes pending in the transmission ring and the bytes queued by the
+        serial port (out_waiting). When the backlog rises to the high watermark, the instance starts signaling
+        backpressure and calls on_high. When the backlog then falls to the low watermark, the instance stops
+        signaling backpressure and calls on_low. Use the transmission_throttled property to poll the signal instead of
+        using the callbacks.
 
-            The maximum runtime speed for this method is achieved when writing data as numpy arrays, which is optimized
-            to a single write operation. The minimum runtime speed is achieved by writing dataclasses, as it involves
-            looping over dataclass attributes. When writing dataclasses, all attributes are serialized and written
-            as a consecutive data block.
+        Notes:
+            The backlog is checked after each transmitted packet and each flush_transmission() call, so on_low is only
+            called once the instance sends more data or flushes the ring. The callbacks are called by the thread that
+            sends or flushes the data while it holds the transmission lock, so they must not wait for other threads
+            that use the transmission methods.
 
         Args:
-            data_object: A numpy scalar or array object or a python dataclass made entirely out of valid numpy objects.
-                Supported numpy types are: uint8, uint16, uint32, uint64, int8, int16, int32, int64, float32, float64,
-                and bool. Arrays have to be 1-dimensional and not empty to be supported.
+            high_watermark: The backlog, in bytes, at which the instance starts signaling backpressure. If 0, the
+                watermarks are disabled.
+            low_watermark: The backlog, in bytes, at which the instance stops signaling backpressure. Must be lower
+                than the high watermark.
+            on_high: The callback to call when the backlog rises to the high watermark or None.
+            on_low: The callback to call when the backlog falls to the low watermark or None.
 
         Raises:
-            TypeError: If the input object is not a supported numpy scalar, numpy array, or python dataclass.
-            ValueError: If the transmission buffer does not have enough space to accommodate the written object's data.
-                If the input object is a multidimensional or empty numpy array.
+            ValueError: If the watermarks are not non-negative integers or the low watermark is not lower than the
+                high watermark.
         """
-        end_index = -10  # Initializes to a specific negative value that is not a valid index or runtime error code
+        if (
+            not isinstance(high_watermark, int)
+            or not isinstance(low_watermark, int)
+            or low_watermark < 0
+            or (high_watermark != 0 and low_watermark >= high_watermark)
+        ):
+            message = (
+                f"Unable to set the transmission watermarks. Expected non-negative integer values, with the "
+                f"'low_watermark' lower than the 'high_watermark' unless the 'high_watermark' is 0, but encountered "
+                f"a high_watermark of {high_watermark} and a low_watermark of {low_watermark}."
+            )
+            console.error(message=message, error=ValueError)
 
-        # Resolves the index at which to start writing the object's data.
-        start_index = self._bytes_in_transmission_buffer
+        with self._tx.lock:
+            self._tx.high_watermark = high_watermark
+            self._tx.low_watermark = low_watermark
+            self._tx.on_high = on_high
+            self._tx.on_low = on_low
+            self._tx.throttled = False
+            if high_watermark != 0:
+                self._update_backpressure()
+        self._resolve_disconnection()
 
-        # If the input object is a supported numpy scalar, calls the scalar data writing method.
-        if isinstance(data_object, self._accepted_numpy_scalars):
-            end_index = self._write_scalar_data(self._transmission_buffer, data_object, start_index)
+    def _build_packet(self, payload_buffer: NDArray[np.uint8], payload_size: int) -> NDArray[np.uint8]:
+        """Packages the payload stored at the beginning of the input buffer into a serialized packet.
 
-        # If the input object is a numpy array, first ensures that it's datatype matches one of the accepted scalar
-        # numpy types and, if so, calls the array data writing method.
-        elif isinstance(data_object, np.ndarray) and data_object.dtype in self._accepted_numpy_scalars:
-            end_index = self._write_array_data(self._transmission_buffer, data_object, start_index)
+        This worker method applies all payload transformations enabled for the instance (delta encoding, compression,
+        framing, CRC, and forward error correction) and expects the caller to hold the transmission lock.
 
-        # If the input object is a python dataclass, iteratively loops over each field of the class and recursively
-        # calls write_data() to write each attribute of the class to the buffer. This implementation supports using
-        # this function for any dataclass that stores numpy scalars or arrays, replicating the behavior of the
-        # Microcontroller TransportLayer class.
-        elif is_dataclass(data_object):
-            # Loops over each field (attribute) of the dataclass and writes it to the buffer
-            # noinspection PyDataclass
-            for field in fields(data_object):
-                # Calls the write method recursively onto the value of each field
-                data_value = getattr(data_object, field.name)
+        Args:
+            payload_buffer: The buffer that stores the payload to be packaged.
+            payload_size: The number of bytes that make up the payload.
 
-                # If this call fails, it raises an error that terminates this loop early
-                self.write_data(data_object=data_value)
+        Returns:
+            The constructed serial packet.
+        """
+        # If delta transmission is enabled, replaces the payload with the keyframe or delta frame that encodes it.
+        if self._delta_keyframe_interval != 0:
+            payload_buffer = self._encode_delta_frame(payload_buffer[:payload_size])
+            payload_size = payload_buffer.size
+
+        # If compression is enabled, compresses the payload and prepends the header that marks whether the payload is
+        # compressed. The payload is only sent compressed if this makes it smaller.
+        if self._lz_processor is not None:
+            payload = payload_buffer[:payload_size]
+            compressed = self._lz_processor.processor.compress(payload)
+            payload_buffer = np.empty(min(compressed.size, payload_size) + 1, dtype=np.uint8)
+            if compressed.size < payload_size:
+                payload_buffer[0] = _COMPRESSED_PAYLOAD
+                payload_buffer[1:] = compressed
+            else:
+                payload_buffer[0] = _RAW_PAYLOAD
+                payload_buffer[1:] = payload
+            payload_size = payload_buffer.size
 
-            # The recurrent write_data calls resolve errors and update the payload size trackers as necessary, so if
-            # the method runs without errors, returns to caller without further processing
-            return
+        # Constructs the serial packet to be sent. This is a fast inline aggregation of all packet construction steps,
+        # using JIT compilation to increase runtime speed. To maximize compilation benefits, it has to access the
+        # inner jitclasses instead of using the python COBS and CRC class wrappers.
+        if self._pipeline is not None:
+            packet = self._pipeline.construct_packet(payload_buffer, self._framing_processor.processor, payload_size)
+        else:
+            packet = self._construct_packet(
+                payload_buffer,
+                self._framing_processor.processor,
+                self._crc_processor.processor,
+                payload_size,
+                self._start_byte,
+            )
+
+        # If forward error correction is enabled, appends the parity bytes that protect the encoded payload and the CRC
+        # checksum (everything except the 2-byte preamble).
+        if self._fec_processor is not None:
+            packet = np.concatenate((packet, self._fec_processor.processor.encode(packet[2:])))
+
+        return packet
+
+    def send_records(self, records: Any) -> int:
+        """Packs the input fixed-size records into as few payloads as possible and transmits the resulting packets
+        over the communication interface in a single write.
+
+        Each payload stores as many whole records as fit into the maximum transmitted payload size, so the receiver
+        always gets whole records. If the instance was configured by the negotiate() method and the microcontroller
+        does not support record batching, each payload stores a single record. The data of each record matches the data
+        written by the write_data() method for the same record, and the records are transmitted in their input order.
+
+        Notes:
+            This method does not use the transmission buffer, so any data already written to the buffer is preserved
+            and sent with the next send_data() call.
+
+            The fastest input is a numpy structured array, which is packed and framed without per-record interpreter
+            overhead. Structured arrays with padded (aligned) datatypes are repacked to remove the padding bytes.
+            Sequences of dataclasses are first converted to a structured array, which requires visiting each record.
+
+            All packets are handed off to the communication interface at the same time, so the microcontroller has to
+            be able to process them at the rate at which they arrive. In the non-blocking transmission mode, the
+            transmission ring has to be able to store the maximum-size packet for each transmitted payload.
+
+        Args:
+            records: A numpy structured array whose fields use the supported numpy types (subarray and nested fields
+                are supported), or a sequence of instances of the same python dataclass made entirely out of supported
+                numpy scalars and arrays. Supported numpy types are: uint8, uint16, uint32, uint64, int8, int16, int32,
+                int64, float32, float64, and bool.
+
+        Returns:
+            The number of transmitted records.
 
-        # Unsupported input type error
-        else:
-            message = (
-                f"Failed to write the data to the transmission buffer. Encountered an unsupported input data_object "
-                f"type ({type(data_object).__name__}). At this time, only the following numpy scalar or array "
-                f"types are supported: {self._accepted_numpy_scalars}. Alternatively, a dataclass with all attributes "
-                f"set to supported numpy scalar or array types is also supported."
-            )
-            console.error(message=message, error=TypeError)
+        Raises:
+            TypeError: If the input records are not a supported numpy structured array or a sequence of dataclasses.
+            ValueError: If a single record is empty or does not fit into the maximum transmitted payload size.
+            RuntimeError: If the non-blocking transmission mode is enabled and the transmission ring does not have
+                enough free space to store the packets.
+            ConnectionError: If the Microcontroller is disconnected and the automatic reconnection is disabled or
+                fails. If the automatic reconnection succeeds, the packets are lost, and the method returns normally.
+        """
+        record_bytes = self._serialize_records(records=records)
+        record_count, record_size = record_bytes.shape
+        if record_count == 0:
+            return 0
 
-        # If the end_index exceeds the start_index, that means that an appropriate write operation was executed
-        # successfully. In that case, updates the _bytes_in_transmission_buffer tracker
-        if end_index > start_index:
-            self._bytes_in_transmission_buffer = end_index
-        elif end_index == TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR:
-            message = (
-                f"Failed to write the data to the transmission buffer. The transmission buffer does not have enough "
-                f"space to write the data starting at the index {start_index}. Specifically, given the data size of "
-                f"{data_object.nbytes} bytes, the required buffer size is {start_index + data_object.nbytes} bytes, "
-                f"but the available size is {self._transmission_buffer.size} bytes."
-            )
-            console.error(message=message, error=ValueError)
-        elif end_index == TransportLayerStatus.MULTIDIMENSIONAL_ARRAY_ERROR:
-            message = (
-                f"Failed to write the data to the transmission buffer. Encountered a multidimensional numpy array with "
-                f"{data_object.ndim} dimensions as input data_object. At this time, only one-dimensional (flat) arrays "
-                f"are supported."
-            )
-            console.error(message=message, error=ValueError)
-        elif end_index == TransportLayerStatus.EMPTY_ARRAY_ERROR:
+        maximum_payload_size = int(self._max_tx_payload_size)
+        if record_size == 0 or record_size > maximum_payload_size:
             message = (
-                "Failed to write the data to the transmission buffer. Encountered an empty (size 0) numpy array as "
-                "input data_object. Writing empty arrays is not supported."
+                f"Unable to send the records. Each record has to contain between 1 and {maximum_payload_size} bytes "
+                f"to fit into a transmitted payload, but encountered records of {record_size} bytes."
             )
             console.error(message=message, error=ValueError)
-        else:
-            message = (
-                f"Failed to write the data to the transmission buffer. Encountered an unknown error code ({end_index}) "
-                f"returned by the writer method."
-            )  # pragma: no cover
-            console.error(message=message, error=RuntimeError)  # pragma: no cover
 
-            # This fallback is to appease MyPy and cannot be reached
-            raise RuntimeError(message)  # pragma: no cover
-
-    @staticmethod
-    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
-    def _write_scalar_data(
-        target_buffer: NDArray[np.uint8],
-        scalar_object: Any,
-        start_index: int,
-    ) -> int:
-        """Converts the input numpy scalar to a sequence of bytes and writes it to the transmission buffer at the
-        specified start_index.
+        # Splits the records into the largest payloads that store whole records. The payloads are views into the
+        # serialized records, so the records are only copied when the packets are constructed.
+        records_per_payload = maximum_payload_size // record_size
+        if self._capabilities is not None and MicrocontrollerFeature.BATCHING not in self._capabilities.features:
+            records_per_payload = 1
+        payload_size = records_per_payload * record_size
+        payload_bytes = record_bytes.reshape(-1)
+        total_size = payload_bytes.size
+
+        # Prevents other threads from sending packets while the records are being sent, which would interleave the
+        # packets and, if delta transmission is enabled, desynchronize the delta reference.
+        with self._tx.lock:
+            if self._tx.ring.size != 0:
+                self._reserve_ring(size=-(-total_size // payload_size) * self._max_packet_size)
+            packets = [
+                self._build_packet(payload_bytes[start_index:], min(payload_size, total_size - start_index))
+                for start_index in range(0, total_size, payload_size)
+            ]
+            if self._tx.tracker is not None:
+                for packet in packets:
+                    self._tx.tracker.enqueue(packet_size=packet.size)
+            self._transmit(np.concatenate(packets))
+            self._tx.packet_count += len(packets)
+        self._resolve_disconnection()
+
+        return record_count
+
+    def _serialize_records(self, records: Any) -> NDArray[np.uint8]:
+        """Converts the input records to a two-dimensional array that stores the data of each record as a row.
 
         Args:
-            target_buffer: The buffer where to write the data.
-            scalar_object: The scalar numpy object to be written to the transmission buffer.
-            start_index: The index inside the transmission buffer at which to start writing the data.
+            records: The numpy structured array or the sequence of dataclasses passed to send_records().
 
         Returns:
-            The positive index inside the transmission buffer that immediately follows the last index of the buffer to
-            which the data was written. One of the TransportLayerStatus if the method encounters a runtime error.
+            The C-contiguous array that stores the serialized records, with one row of bytes per record.
+
+        Raises:
+            TypeError: If the input records are not a supported numpy structured array or a sequence of dataclasses.
         """
-        # Converts the input scalar to a byte array. This is mostly so that Numba can work with the data via the
-        # service method calls below. Note, despite the input being scalar, the array object may have multiple elements.
-        array_object = np.frombuffer(np.array([scalar_object]), dtype=np.uint8)  # scalar → array → byte array
+        # Converts a sequence of dataclasses to a structured array whose fields match the flattened fields of the first
+        # record.
+        if isinstance(records, (list, tuple)) and records and is_dataclass(records[0]):
+            record_type = type(records[0])
+            values = []
+            for record in records:
+                if type(record) is not record_type:
+                    message = (
+                        f"Unable to send the records. All records have to be instances of the same dataclass "
+                        f"({record_type.__name__}), but encountered a record of type {type(record).__name__}."
+                    )
+                    console.error(message=message, error=TypeError)
+                values.append(self._flatten_objects(data_objects=(record,), operation="write"))
+            layout = [np.asarray(value) for value in values[0]]
+            dtype = np.dtype([(f"f{index}", value.dtype, value.shape) for index, value in enumerate(layout)])
+            records = np.array(values, dtype=dtype)
+
+        elif isinstance(records, (list, tuple)) and not records:
+            return np.empty((0, 0), dtype=np.uint8)
+
+        structured = isinstance(records, np.ndarray) and records.dtype.names is not None
+        if not structured or not self._accepted_record(records.dtype):
+            datatype = f" with the datatype {records.dtype}" if isinstance(records, np.ndarray) else ""
+            message = (
+                f"Unable to send the records. Expected a numpy structured array whose fields use the following numpy "
+                f"types: {self._accepted_numpy_scalars}, or a sequence of dataclasses with all attributes set to "
+                f"supported numpy scalar or array types, but encountered an object of type {type(records).__name__}"
+                f"{datatype}."
+            )
+            console.error(message=message, error=TypeError)
 
-        # Calculates the required space inside the buffer to store the data inserted at the start_index
-        data_size = array_object.size * array_object.itemsize  # Size of each element * the number of elements
-        required_size = start_index + data_size
+        # Removes the padding bytes of aligned datatypes and makes the records contiguous, so that each record is
+        # serialized as the consecutive data of its fields.
+        packed = np.ascontiguousarray(repack_fields(records.reshape(-1)))
+        return packed.view(np.uint8).reshape(packed.size, packed.dtype.itemsize)
 
-        # If the space to store the data extends outside the available transmission_buffer boundaries, returns 0.
-        if required_size > target_buffer.size:
-            return TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+    def _accepted_record(self, dtype: np.dtype[Any]) -> bool:
+        """Determines whether all fields of the input structured datatype use the supported numpy types.
 
-        # Writes the data to the buffer.
-        target_buffer[start_index:required_size] = array_object
+        Args:
+            dtype: The structured datatype to check.
 
-        # Returns the required_size, which incidentally also matches the index that immediately follows the last index
-        # of the buffer that was overwritten with the input data.
-        return required_size
+        Returns:
+            True if the datatype is supported, False otherwise.
+        """
+        for field_dtype, *_ in dtype.fields.values():  # type: ignore[union-attr]
+            base = field_dtype.base
+            supported = self._accepted_record(base) if base.names is not None else base in self._accepted_dtypes
+            if not supported:
+                return False
+        return True
 
     @staticmethod
     @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
-    def _write_array_data(
-        target_buffer: NDArray[np.uint8],
-        array_object: NDArray[Any],
-        start_index: int,
-    ) -> int:
-        """Converts the input numpy array to a sequence of bytes and writes it to the transmission buffer at the
-        specified start_index.
+    def _construct_packet(
+        payload_buffer: NDArray[np.uint8],
+        framing_processor: _FramingProcessor,
+        crc_processor: _CRCProcessor,
+        payload_size: int,
+        start_byte: np.uint8,
+    ) -> NDArray[np.uint8]:
+        """Constructs the serial packet using the payload stored inside the input buffer.
 
         Args:
-            target_buffer: The buffer where to write the data.
-            array_object: The numpy array to be written to the transmission buffer.
-            start_index: The index inside the transmission buffer at which to start writing the data.
+            payload_buffer: The buffer that stores the payload to be encoded into a packet.
+            framing_processor: The inner jitclass instance of the framing codec.
+            crc_processor: The inner _CRCProcessor jitclass instance.
+            payload_size: The number of bytes that make up the payload.
+            start_byte: The byte-value used to mark the beginning of each transmitted packet.
 
         Returns:
-            The positive index inside the transmission buffer that immediately follows the last index of the buffer to
-            which the data was written. One of the TransportLayerStatus if the method encounters a runtime error.
+            The constructed serial packet.
         """
-        if array_object.ndim != 1:
-            return TransportLayerStatus.MULTIDIMENSIONAL_ARRAY_ERROR.value
+        # Extracts the payload from the input buffer and encodes it using the framing codec.
+        packet = framing_processor.encode_payload(payload_buffer[:payload_size])
 
-        if array_object.size == 0:
-            return TransportLayerStatus.EMPTY_ARRAY_ERROR.value
-
-        # Calculates the required space inside the buffer to store the data inserted at the start_index
-        array_data = np.frombuffer(array_object, dtype=np.uint8)  # Serializes to bytes
-        data_size = array_data.size * array_data.itemsize  # Size of each element * the number of elements
-        required_size = start_index + data_size
-
-        if required_size > target_buffer.size:
-            return TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+        # Extends the packet's buffer to include the space for the CRC checksum postamble.
+        # noinspection PyTypeChecker
+        crc_packet = np.empty(len(packet) + crc_processor.crc_byte_length, dtype=np.uint8)
+        crc_packet[: len(packet)] = packet
 
-        # Writes the array data to the buffer, starting at the start_index and ending just before the required_size
-        # index
-        target_buffer[start_index:required_size] = array_data
+        # Calculates the CRC checksum for the encoded payload and adds it to the end of the crc_packet buffer (to the
+        # end of the COBS-encoded packet).
+        crc_processor.calculate_checksum(buffer=crc_packet, check=False)
 
-        # Returns the required_size, which incidentally also matches the index that immediately follows the last index
-        # of the buffer that was overwritten with the input data.
-        return required_size
+        # Generates the message preamble using start_byte and payload_size.
+        preamble = np.array([start_byte, payload_size], dtype=np.uint8)
 
-    def read_data(
-        self,
-        data_object: Any,
-    ) -> Any:
-        """Overwrites the input object's data with the data from the instance's reception buffer, consuming (discarding)
-        all read bytes.
+        # Concatenates the preamble, the encoded payload, and the checksum postamble to form the serial packet
+        # and returns the constructed packet to the caller.
+        return np.concatenate((preamble, crc_packet))
 
-        This method deserializes the objects stored in the reception buffer as a sequence of bytes. Calling this method
-        consumes the read bytes, making it impossible to retrieve the same data from the reception buffer again.
+    def receive_data(self, timeout: int = 0) -> bool:
+        """Receives a data packet from the communication interface, verifies its integrity, and decodes its payload into
+        the instance's reception buffer.
 
         Notes:
-            At this time, the method only works with valid numpy scalars and arrays as well as python dataclasses
-            entirely made out of valid numpy types.
+            Before attempting to receive the packet, the method uses the Available() method to check whether the
+            communication interface is likely to store a well-formed packet. It is safe to call this method cyclically
+            (as part of a loop) until a packet is received.
 
-            The maximum runtime speed of this method is achieved when reading data as numpy arrays, which is
-            optimized to a single read operation. The minimum runtime speed is achieved by reading dataclasses, as it
-            involves looping over dataclass attributes.
+            This method resets the instance's reception buffer before attempting to receive the data, discarding any
+            potentially unprocessed data. If the buffer's payload is held (see hold_payload()), the method receives the
+            data into a free reception slot instead and returns False if all slots store held payloads.
+
+            If the timeout is not 0, the method blocks until a packet is received or the timeout runs out, using the
+            instance's wait strategy to wait for the packet's bytes.
 
         Args:
-            data_object: An initialized numpy scalar or array object or a python dataclass made entirely out of valid
-                numpy objects. Supported numpy types are: uint8, uint16, uint32, uint64, int8, int16, int32, int64,
-                float32, float64, and bool. Array prototypes have to be 1-dimensional and not empty to be supported.
+            timeout: The maximum number of microseconds to wait for a packet to become available. If 0, the method
+                returns immediately if the communication interface does not contain a packet.
 
         Returns:
-            The deserialized data object extracted from the instance's reception buffer.
+            True if the packet was successfully received and unpacked and False if the communication interface does not
+            contain enough bytes to justify processing the packet.
 
         Raises:
-            TypeError: If the input object is not a supported numpy scalar, numpy array, or python dataclass.
-            ValueError: If the payload stored inside the reception buffer does not have enough unconsumed bytes
-                available to reconstruct the requested object. If the input object is a multidimensional or empty
-                numpy array.
+            RuntimeError: If the method runs into an error while receiving or processing the packet's data.
+            ConnectionError: If the Microcontroller is disconnected and the automatic reconnection is disabled or
+                fails. If the automatic reconnection succeeds, the method returns False.
         """
-        end_index = -10  # Initializes to a specific negative value that is not a valid index or runtime error code
+        # Prevents other threads from accessing the reception buffer while the packet is being received.
+        with self._rx.lock:
+            connection = self._reconnections
+            try:
+                received = self._receive_data()
+                if received or timeout <= 0:
+                    return received
+
+                # If the packet is not available and the timeout is not 0, waits for the packet to arrive.
+                self._rx.wait_timer.reset()
+                while True:
+                    elapsed = self._rx.wait_timer.elapsed
+                    if elapsed >= timeout:
+                        return False
+                    self._wait(waited=elapsed, remaining=timeout - elapsed)
+                    if self._receive_data():
+                        return True
+            except OSError as error:
+                disconnection = error
+
+        # Handles the disconnection after releasing the reception lock, as reopening the port acquires it.
+        self._handle_disconnection(error=disconnection, connection=connection)
+        return False
 
-        # Computes the index at which to start reading the input object's data based on the number of bytes already
-        # consumed from the buffer.
-        start_index = self._consumed_bytes
+    def _receive_data(self) -> bool:
+        """Receives a data packet from the communication interface and decodes its payload into the reception buffer.
 
-        # If the input object is a supported numpy scalar, converts it to a numpy array and calls the read method.
-        # Converts the returned one-element array back to a scalar numpy type. Due to current Numba limitations, this
-        # is the most efficient available method.
-        if isinstance(data_object, self._accepted_numpy_scalars):
-            returned_object, end_index = self._read_array_data(
-                self._reception_buffer,
-                np.array(data_object, dtype=data_object.dtype),
-                start_index,
-                self._bytes_in_reception_buffer,
-            )
-            out_object = returned_object[0].copy()
+        This worker method implements receive_data() and expects the caller to hold the reception lock.
+        """
+        # Clears the reception buffer
+        self._rx.bytes_in_buffer = 0
+        self._rx.encoded_size = 0
+        self._rx.consumed_bytes = 0
 
-        # If the input object is a numpy array, first ensures that its datatype matches one of the accepted scalar
-        # numpy types and, if so, calls the array data reading method.
-        elif isinstance(data_object, np.ndarray):
-            if data_object.dtype in self._accepted_numpy_scalars:
-                out_object, end_index = self._read_array_data(
-                    self._reception_buffer,
-                    data_object,
-                    start_index,
-                    self._bytes_in_reception_buffer,
-                )
+        # If the current reception slot stores a held payload, switches to a free slot. If all slots are held, leaves
+        # the incoming packets unprocessed until a payload is released.
+        if not self._rx.rotate_slot():
+            return False
 
-        # If the input object is a python dataclass, enters a recursive loop which calls this method for each class
-        # attribute. This allows retrieving and overwriting each attribute with the bytes read from the buffer,
-        # similar to the Microcontroller TransportLayer class.
-        elif is_dataclass(data_object):
-            # Loops over each field of the dataclass
-            # noinspection PyDataclass
-            for field in fields(data_object):
-                # Calls the reader function recursively onto each field of the class
-                attribute_value = getattr(data_object, field.name)
-                attribute_object = self.read_data(data_object=attribute_value)
+        # After the serial port is reopened, discards the stream bytes and the delta reference left over from the
+        # previous connection, as the Microcontroller may have been reset.
+        if self._rx.connection != self._reconnections:
+            self._rx.connection = self._reconnections
+            self._rx.stream_size = 0
+            self._rx.read_saturated = False
+            self._rx.delta_reference_size = -1
 
-                # Updates the field in the original dataclass instance with the read object
-                setattr(data_object, field.name, attribute_object)
+        # During real-time sessions, times each reception to record the latency of the received packets.
+        session = self._real_time_session
+        if session is not None:
+            session.timer.reset()
 
-            # The recurrent read_data calls resolve errors and update the payload size trackers as necessary, so if
-            # the method runs without errors, returns to caller without further processing
-            return data_object
+        # If the GIL-free engine is enabled, receives, validates, and unpacks the packet in a single nopython call.
+        if self._gil_free_reception:
+            received, payload_size = self._receive_packet_gil_free()
+
+            # If the engine does not find any packet bytes to process, it returns False.
+            if not received:
+                return False
 
-        # If the input value is not a valid numpy scalar, an array using a valid scalar datatype or a python dataclass
-        # raises TypeError exception.
         else:
-            message = (
-                f"Failed to read the data from the reception buffer. Encountered an unsupported input data_object "
-                f"type ({type(data_object).__name__}). At this time, only the following numpy scalar or array types "
-                f"are supported: {self._accepted_numpy_scalars}. Alternatively, a dataclass with all attributes "
-                f"set to supported numpy scalar or array types is also supported."
-            )
-            console.error(message=message, error=TypeError)
+            # Attempts to receive a new packet. If successful, this method saves the received packet to the reception
+            # buffer and the size of the packet to the reception buffer payload size tracker. If the method runs into
+            # an error, it raises the appropriate RuntimeError.
+            if not self._receive_packet():
+                # If the packet parsing method does not find any packet bytes to process, it returns False.
+                return False
+
+            # If forward error correction is enabled, corrects the parsed packet in place and excludes the parity bytes
+            # from further processing. If the packet cannot be corrected, it is left unchanged, and the CRC check below
+            # detects the corruption.
+            packet_size = self._rx.bytes_in_buffer
+            if self._fec_processor is not None:
+                self._fec_processor.processor.decode(self._rx.buffer[:packet_size])
+                packet_size -= self._fec_processor.parity_size
+
+            # If lazy decoding is enabled, only verifies the packet and leaves its payload encoded until it is accessed.
+            if self._lazy_decoding:
+                if self._pipeline is not None:
+                    encoded_size, first_byte = self._pipeline.verify_packet(
+                        self._rx.buffer, packet_size, self._framing_processor.processor
+                    )
+                else:
+                    encoded_size, first_byte = self._verify_packet(
+                        self._rx.buffer, packet_size, self._framing_processor.processor, self._crc_processor.processor
+                    )
+                if encoded_size:
+                    # Until the payload is decoded, the encoded size tracker stores the size of the verified packet
+                    # and the payload size tracker is reset, as the decoded payload size is not known yet.
+                    self._rx.bytes_in_buffer = 0
+                    self._rx.encoded_size = encoded_size
+                    self._rx.first_byte = first_byte
+                    self._rx.packet_count += 1
+                    if session is not None:
+                        session.record(latency=session.timer.elapsed)
+                    return True
+                payload_size = 0
+
+            # If the packet is successfully parsed, validates and unpacks the payload into the class reception buffer
+            elif self._pipeline is not None:
+                payload_size = self._pipeline.process_packet(
+                    self._rx.buffer, packet_size, self._framing_processor.processor
+                )
+            else:
+                payload_size = self._process_packet(
+                    self._rx.buffer,
+                    packet_size,
+                    self._framing_processor.processor,
+                    self._crc_processor.processor,
+                )
 
-        # If end_index is different from the start_index and no error has been raised, the method runtime was
-        # successful, so returns the read data_object and the end_index to the caller
-        if end_index > start_index:
-            # Updates the consumed bytes tracker adn returns the object recreated using data from the buffer
-            self._consumed_bytes = end_index
-            # noinspection PyUnboundLocalVariable
-            return out_object
-        if end_index == TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR:
-            message = (
-                f"Failed to read the data from the reception buffer. The reception buffer does not have enough "
-                f"unconsumed bytes to recreate the object. Specifically, the object requires {data_object.nbytes} "
-                f"bytes, but the available payload size is {self.bytes_in_reception_buffer - self._consumed_bytes} "
-                f"bytes."
-            )
-            console.error(message=message, error=ValueError)
-        elif end_index == TransportLayerStatus.MULTIDIMENSIONAL_ARRAY_ERROR:
-            message = (
-                f"Failed to read the data from the reception buffer. Encountered a multidimensional numpy array with "
-                f"{data_object.ndim} dimensions as input data_object. At this time, only one-dimensional (flat) arrays "
-                f"are supported."
-            )
-            console.error(message=message, error=ValueError)
-        elif end_index == TransportLayerStatus.EMPTY_ARRAY_ERROR:
-            message = (
-                "Failed to read the data from the reception buffer. Encountered an empty (size 0) numpy array as "
-                "input data_object. Reading empty arrays is not supported."
-            )
-            console.error(message=message, error=ValueError)
+        # If compression is enabled, removes the compression header and, if necessary, decompresses the payload.
+        if payload_size and self._lz_processor is not None:
+            payload_size = self._decompress_payload(payload_size)
+
+        # If delta transmission is enabled, removes the delta header and, if necessary, rebuilds the full payload from
+        # the received patches.
+        if payload_size and self._delta_keyframe_interval != 0:
+            payload_size = self._decode_delta_frame(payload_size)
+
+        # Returned payload_size is a positive integer (>= 1) if verification succeeds. If verification
+        # succeeds, overwrites the reception buffer payload size tracker with the payload size and returns True to
+        # indicate runtime success
+        if payload_size:
+            self._rx.bytes_in_buffer = payload_size
+            self._rx.packet_count += 1
+            if session is not None:
+                session.record(latency=session.timer.elapsed)
+            return True
 
+        # Otherwise, notifies the user about an error processing the packet
         message = (
-            f"Failed to read the data from the reception buffer. Encountered an unknown error code ({end_index})"
-            f"returned by the reader method."
-        )  # pragma: no cover
-        console.error(message=message, error=RuntimeError)  # pragma: no cover
+            "Failed to process the received serial packet. This indicates that the packet was corrupted during "
+            "transmission or reception."
+        )
+        console.error(message=message, error=RuntimeError)
 
-        # Fallback to appease MyPy, will never be reached
+        # Fallback to appease MyPy, will never be reached.
         raise RuntimeError(message)  # pragma: no cover
 
-    @staticmethod
-    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
-    def _read_array_data(
-        source_buffer: NDArray[np.uint8],
-        array_object: NDArray[Any],
-        start_index: int,
-        payload_size: int,
-    ) -> tuple[NDArray[Any], int]:
-        """Reads the requested array_object from the instance's reception buffer.
+    def _decode_pending_payload(self) -> None:
+        """Decodes the verified packet stored in the reception buffer if lazy decoding has deferred its decoding.
+
+        This worker method expects the caller to hold the reception lock.
+
+        Raises:
+            RuntimeError: If the verified packet does not store a valid encoded payload.
+        """
+        encoded_size = self._rx.encoded_size
+        if encoded_size == 0:
+            return
+
+        self._rx.encoded_size = 0
+        payload_size = self._decode_packet(self._rx.buffer, encoded_size, self._framing_processor.processor)
+        if payload_size:
+            self._rx.bytes_in_buffer = payload_size
+            return
+
+        message = (
+            "Failed to decode the received serial packet. The packet's checksum is valid, but the packet does not "
+            "store a payload encoded with the instance's framing codec. This indicates that the Microcontroller uses "
+            "a different framing codec."
+        )
+        console.error(message=message, error=RuntimeError)
+
+    def _decompress_payload(self, payload_size: int) -> int:
+        """Removes the compression header from the payload stored in the reception buffer and decompresses the payload
+        if necessary.
 
-        Specifically, the object's data is read as bytes and is converted to an array with the appropriate datatype.
+        This worker method expects the caller to hold the reception lock and compression to be enabled.
 
         Args:
-            source_buffer: The buffer from which to read the data.
-            array_object: The numpy array to be read from the _reception_buffer.
-            start_index: The index inside the reception buffer at which to start reading the data.
-            payload_size: The number of payload bytes currently stored inside the buffer.
+            payload_size: The size of the received payload, including the compression header.
 
         Returns:
-            A two-element tuple. The first element is the numpy array that uses the datatype and size derived from the
-            input array_object, which holds the extracted data. The second element is the index that immediately follows
-            the last index that was read during method runtime to support chained read calls. If method runtime fails,
-            returns an empty numpy array as the first element and one of the TransportLayerStatus values as the
-            second element.
+            The size of the decompressed payload or 0 if the payload is malformed.
         """
-        # Calculates the end index for the read operation. This is based on how many bytes are required to represent the
-        # object and the start_index for the read operation.
-        required_size = start_index + array_object.nbytes
+        header = self._rx.buffer[0]
+        data = self._rx.buffer[1:payload_size]
 
-        # Prevents reading outside the payload boundaries.
-        if required_size > payload_size:
-            return np.empty(0, dtype=array_object.dtype), TransportLayerStatus.INSUFFICIENT_BUFFER_SPACE_ERROR.value
+        # Uncompressed payloads only need to be shifted to the beginning of the buffer to discard the header.
+        if header == _RAW_PAYLOAD:
+            self._rx.buffer[: payload_size - 1] = data
+            return payload_size - 1
 
-        # Prevents reading multidimensional numpy arrays.
-        if array_object.ndim > 1:
-            return np.empty(0, dtype=array_object.dtype), TransportLayerStatus.MULTIDIMENSIONAL_ARRAY_ERROR.value
+        if header == _COMPRESSED_PAYLOAD and self._lz_processor is not None:
+            payload = self._lz_processor.processor.decompress(data)
+            self._rx.buffer[: payload.size] = payload
+            return int(payload.size)
 
-        # Prevents reading empty numpy arrays
-        if array_object.size == 0:
-            return np.empty(0, dtype=array_object.dtype), TransportLayerStatus.EMPTY_ARRAY_ERROR.value
+        return 0
 
-        # Generates a new array using the input data_object datatype and a slice of the byte-buffer that corresponds to
-        # the number of bytes necessary to represent the object. Uses copy to ensure the returned object is not sharing
-        # the buffer with the source_buffer.
-        return (
-            np.frombuffer(source_buffer[start_index:required_size], dtype=array_object.dtype).copy(),
-            required_size,
-        )
+    def _encode_delta_frame(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]:
+        """Encodes the input payload as a keyframe or a delta frame and updates the delta reference.
 
-    def send_data(self) -> None:
-        """Packages the data inside the instance's transmission buffer into a serialized packet and transmits it
-        over the communication interface.
+        This worker method expects the caller to hold the transmission lock and delta transmission to be enabled.
 
-        Notes:
-            This method resets the instance's transmission buffer after transmitting the data, discarding any data
-            stored inside the buffer.
+        Args:
+            payload: The payload to encode.
+
+        Returns:
+            The encoded frame, including the delta header.
         """
-        # Constructs the serial packet to be sent. This is a fast inline aggregation of all packet construction steps,
-        # using JIT compilation to increase runtime speed. To maximize compilation benefits, it has to access the
-        # inner jitclasses instead of using the python COBS and CRC class wrappers.
-        packet = self._construct_packet(
-            self._transmission_buffer,
-            self._cobs_processor.processor,
-            self._crc_processor.processor,
-            self._bytes_in_transmission_buffer,
-            self._start_byte,
-        )
+        tx = self._tx
+        payload_size = payload.size
+        sequence = (tx.delta_sequence + 1) & 0xFF
+
+        # After the serial port is reopened, sends a keyframe, as the Microcontroller may have been reset.
+        if tx.connection != self._reconnections:
+            tx.connection = self._reconnections
+            tx.delta_reference_size = -1
+        frame = np.empty(payload_size + 2, dtype=np.uint8)
+        frame[1] = sequence
+
+        # Attempts to encode the payload as a delta frame unless the next frame has to be a keyframe. If the patches
+        # would not make the frame smaller than the keyframe, falls back to sending the keyframe.
+        patches_size = -1
+        if tx.delta_reference_size >= 0 and tx.delta_frame_count % self._delta_keyframe_interval != 0:
+            patches_size = self._encode_delta(
+                tx.delta_reference, tx.delta_reference_size, payload, frame[3 : payload_size + 1]
+            )
 
-        # Hands the constructed packet off to the communication interface.
-        self._port.write(packet.tobytes())
+        if patches_size >= 0:
+            frame[0] = _DELTA_FRAME
+            frame[2] = payload_size
+            frame = frame[: patches_size + 3]
+            tx.delta_frame_count += 1
+        else:
+            frame[0] = _KEY_FRAME
+            frame[2:] = payload
+            tx.delta_frame_count = 1
 
-        # Resets the transmission buffer to indicate that the payload was sent and prepare for sending the next
-        # payload.
-        self.reset_transmission_buffer()
+        tx.delta_reference[:payload_size] = payload
+        tx.delta_reference_size = payload_size
+        tx.delta_sequence = sequence
+        return frame
 
     @staticmethod
     @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
-    def _construct_packet(
-        payload_buffer: NDArray[np.uint8],
-        cobs_processor: _COBSProcessor,
-        crc_processor: _CRCProcessor,
-        payload_size: int,
-        start_byte: np.uint8,
-    ) -> NDArray[np.uint8]:
-        """Constructs the serial packet using the payload stored inside the input buffer.
+    def _encode_delta(
+        reference: NDArray[np.uint8],
+        reference_size: int,
+        payload: NDArray[np.uint8],
+        target_buffer: NDArray[np.uint8],
+    ) -> int:
+        """Encodes the differences between the reference and the payload as (offset, length, bytes) patches.
+
+        Runs of differing bytes separated by at most two matching bytes are merged into a single patch, as each patch
+        uses two bytes to store its offset and length. Bytes that are not covered by the reference are always encoded.
 
         Args:
-            payload_buffer: The buffer that stores the payload to be encoded into a packet.
-            cobs_processor: The inner _COBSProcessor jitclass instance.
-            crc_processor: The inner _CRCProcessor jitclass instance.
-            payload_size: The number of bytes that make up the payload.
-            start_byte: The byte-value used to mark the beginning of each transmitted packet.
+            reference: The buffer that stores the previously transmitted payload.
+            reference_size: The size of the previously transmitted payload.
+            payload: The payload to encode.
+            target_buffer: The buffer to write the patches to. Encoding fails if the patches do not fit into this
+                buffer.
 
         Returns:
-            The constructed serial packet.
+            The size of the encoded patches or -1 if the patches do not fit into the target buffer.
         """
-        # Extracts the payload from the input buffer and encodes it using the COBS scheme.
-        packet = cobs_processor.encode_payload(payload_buffer[:payload_size])
-
-        # Extends the packet's buffer to include the space for the CRC checksum postamble.
-        # noinspection PyTypeChecker
-        crc_packet = np.empty(len(packet) + crc_processor.crc_byte_length, dtype=np.uint8)
-        crc_packet[: len(packet)] = packet
+        payload_size = payload.size
+        capacity = target_buffer.size
+        written = 0
+        index = 0
+        while index < payload_size:
+            # Skips the bytes that match the reference.
+            if index < reference_size and payload[index] == reference[index]:
+                index += 1
+                continue
 
-        # Calculates the CRC checksum for the encoded payload and adds it to the end of the crc_packet buffer (to the
-        # end of the COBS-encoded packet).
-        crc_processor.calculate_checksum(buffer=crc_packet, check=False)
+            # Extends the patch until it is followed by more than two matching bytes or reaches the maximum length.
+            start = index
+            last = index
+            index += 1
+            while index < payload_size and index - start < 255 and index - last <= 2:
+                if index >= reference_size or payload[index] != reference[index]:
+                    last = index
+                index += 1
+            length = last - start + 1
+            index = last + 1
 
-        # Generates the message preamble using start_byte and payload_size.
-        preamble = np.array([start_byte, payload_size], dtype=np.uint8)
+            if written + 2 + length > capacity:
+                return -1
+            target_buffer[written] = start
+            target_buffer[written + 1] = length
+            target_buffer[written + 2 : written + 2 + length] = payload[start : last + 1]
+            written += 2 + length
 
-        # Concatenates the preamble, the encoded payload, and the checksum postamble to form the serial packet
-        # and returns the constructed packet to the caller.
-        return np.concatenate((preamble, crc_packet))
+        return written
 
-    def receive_data(self) -> bool:
-        """Receives a data packet from the communication interface, verifies its integrity, and decodes its payload into
-        the instance's reception buffer.
+    def _decode_delta_frame(self, payload_size: int) -> int:
+        """Removes the delta header from the frame stored in the reception buffer and, if necessary, rebuilds the full
+        payload from the received patches.
 
-        Notes:
-            Before attempting to receive the packet, the method uses the Available() method to check whether the
-            communication interface is likely to store a well-formed packet. It is safe to call this method cyclically
-            (as part of a loop) until a packet is received.
+        This worker method expects the caller to hold the reception lock and delta transmission to be enabled.
 
-            This method resets the instance's reception buffer before attempting to receive the data, discarding any
-            potentially unprocessed data.
+        Args:
+            payload_size: The size of the received frame, including the delta header.
 
         Returns:
-            True if the packet was successfully received and unpacked and False if the communication interface does not
-            contain enough bytes to justify processing the packet.
+            The size of the rebuilt payload or 0 if the frame is malformed.
 
         Raises:
-            RuntimeError: If the method runs into an error while receiving or processing the packet's data.
+            RuntimeError: If the received frame is a delta frame, but the payload it was encoded against has not been
+                received.
         """
-        # Clears the reception buffer
-        self.reset_reception_buffer()
+        rx = self._rx
+        if payload_size < 2:
+            return 0
+        header = rx.buffer[0]
+        sequence = int(rx.buffer[1])
+
+        # Keyframes store the full payload, which also becomes the new reference.
+        if header == _KEY_FRAME:
+            size = payload_size - 2
+            rx.buffer[:size] = rx.buffer[2:payload_size]
+            rx.delta_reference[:size] = rx.buffer[:size]
+            rx.delta_reference_size = size
+            rx.delta_sequence = sequence
+            return size
+
+        if header != _DELTA_FRAME or payload_size < 3:
+            return 0
+
+        # Delta frames can only be applied to the payload that immediately precedes them.
+        if rx.delta_reference_size < 0 or sequence != (rx.delta_sequence + 1) & 0xFF:
+            rx.delta_reference_size = -1
+            message = (
+                f"Failed to rebuild the received delta frame {sequence}. The payload it was encoded against has not "
+                f"been received. All delta frames are discarded until the next keyframe is received."
+            )
+            console.error(message=message, error=RuntimeError)
 
-        # Attempts to receive a new packet. If successful, this method saves the received packet to the
-        # _transmission_buffer and the size of the packet to the _bytes_in_transmission_buffer tracker. If the method
-        # runs into an error, it raises the appropriate RuntimeError.
-        if not self._receive_packet():
-            # If the packet parsing method does not find any packet bytes to process, it returns False.
-            return False
+        size = self._apply_delta(rx.delta_reference, rx.buffer[3:payload_size], int(rx.buffer[2]))
+        if size < 0:
+            return 0
+        rx.buffer[:size] = rx.delta_reference[:size]
+        rx.delta_reference_size = size
+        rx.delta_sequence = sequence
+        return size
 
-        # If the packet is successfully parsed, validates and unpacks the payload into the class reception buffer
-        payload_size = self._process_packet(
-            self._reception_buffer,
-            self._bytes_in_reception_buffer,
-            self._cobs_processor.processor,
-            self._crc_processor.processor,
-        )
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _apply_delta(reference: NDArray[np.uint8], patches: NDArray[np.uint8], payload_size: int) -> int:
+        """Applies the (offset, length, bytes) patches to the reference payload in place.
 
-        # Returned payload_size is a positive integer (>= 1) if verification succeeds. If verification
-        # succeeds, overwrites the _bytes_in_reception_buffer tracker with the payload size and returns True to
-        # indicate runtime success
-        if payload_size:
-            self._bytes_in_reception_buffer = payload_size
-            return True
+        The patches are validated before any of them is applied, so the reference is left unchanged if the patches
+        are malformed.
 
-        # Otherwise, notifies the user about an error processing the packet
-        message = (
-            "Failed to process the received serial packet. This indicates that the packet was corrupted during "
-            "transmission or reception."
-        )
-        console.error(message=message, error=RuntimeError)
+        Args:
+            reference: The buffer that stores the previously received payload.
+            patches: The encoded patches.
+            payload_size: The size of the payload encoded by the patches.
 
-        # Fallback to appease MyPy, will never be reached.
-        raise RuntimeError(message)  # pragma: no cover
+        Returns:
+            The size of the rebuilt payload or -1 if the patches are malformed.
+        """
+        if payload_size > reference.size:
+            return -1
+
+        # Verifies that all patches are complete and fit into the payload.
+        index = 0
+        while index < patches.size:
+            if index + 2 > patches.size:
+                return -1
+            offset = int(patches[index])
+            length = int(patches[index + 1])
+            if length == 0 or offset + length > payload_size or index + 2 + length > patches.size:
+                return -1
+            index += 2 + length
+
+        index = 0
+        while index < patches.size:
+            offset = int(patches[index])
+            length = int(patches[index + 1])
+            reference[offset : offset + length] = patches[index + 2 : index + 2 + length]
+            index += 2 + length
+
+        return payload_size
 
     def _receive_packet(self) -> bool:
         """Parses the bytes stored in the reception buffer of the communication interface as a serialized packet
@@ -872,33 +5411,55 @@ class TransportLayer:
         start_found: bool = False
 
         # Enters the packet parsing loop. Due to the parsing implementation, the packet can be resolved over at most
-        # three iterations of the parsing method. Therefore, this loop is statically capped at 3 iterations.
-        for _call_count in range(3):
-            # Converts leftover_bytes (bytes) to a numpy uint8 array for compatibility with _parse_packet
-            remaining_bytes = np.frombuffer(self._leftover_bytes, dtype=np.uint8).copy()
+        # three iterations of the parsing method. Therefore, this loop is statically capped at 3 iterations. If the
+        # framing codec is not fixed-size, the exact size of the packet is only known once its delimiter is parsed, so
+        # each iteration may only consume a single newly received byte. In this case, the cap is raised to cover the
+        # largest packet that fits into the reception buffer.
+        fixed_size = self._framing_processor.processor.fixed_size
+        for _call_count in range(3 if fixed_size else 3 + self._rx.buffer.size):
+            # Extracts the unconsumed serial stream bytes. The parsing method does not modify the input array, so it is
+            # safe to use a view of the stream buffer.
+            remaining_bytes = self._rx.stream_buffer[: self._rx.stream_size]
 
             # Calls the packet parsing method. The method reuses some iterative outputs as arguments for later
             # calls.
-            status, parsed_bytes_count, remaining_bytes, parsed_bytes = self._parse_packet(
-                remaining_bytes,
-                self._start_byte,
-                self._delimiter_byte,
-                self._max_rx_payload_size,
-                self._min_rx_payload_size,
-                self._postamble_size,
-                start_found,
-                parsed_bytes_count,
-                parsed_bytes,
-            )
+            if self._pipeline is not None:
+                status, parsed_bytes_count, remaining_bytes, parsed_bytes = self._pipeline.parse_packet(
+                    remaining_bytes, self._framing_processor.processor, start_found, parsed_bytes_count, parsed_bytes
+                )
+            else:
+                status, parsed_bytes_count, remaining_bytes, parsed_bytes = self._parse_packet(
+                    remaining_bytes,
+                    self._start_byte,
+                    self._framing_processor.processor,
+                    self._max_rx_payload_size,
+                    self._min_rx_payload_size,
+                    self._postamble_size,
+                    start_found,
+                    parsed_bytes_count,
+                    parsed_bytes,
+                    self._fec_processor is None,
+                )
+
+            # Moves the bytes left over after parsing to the beginning of the stream buffer.
+            self._rx.stream_buffer[: remaining_bytes.size] = remaining_bytes
+            self._rx.stream_size = remaining_bytes.size
+
+            # Partial success statuses are only returned after the start byte is found. Records this so that the next
+            # iteration continues parsing the same packet instead of searching for a new start byte inside the
+            # packet's data.
+            start_found = status in {
+                TransportLayerStatus.PACKET_SIZE_UNKNOWN,
+                TransportLayerStatus.NOT_ENOUGH_PACKET_BYTES,
+                TransportLayerStatus.NOT_ENOUGH_CRC_BYTES,
+            }
 
-            # Convert remaining_bytes_np (numpy array) back to bytes after function runtime
-            self._leftover_bytes = remaining_bytes.tobytes()
             # Resolves parsing result:
-            # Packet parsed. Saves the packet to the _reception_buffer and the packet size to the
-            # _bytes_in_reception_buffer tracker.
+            # Packet parsed. Saves the packet to the reception buffer and the packet size to the reception buffer
+            # payload size tracker.
             if status == 1:
-                self._reception_buffer[: parsed_bytes.size] = parsed_bytes
-                self._bytes_in_reception_buffer = parsed_bytes.size  # Includes encoded payload + CRC postamble!
+                self._rx.buffer[: parsed_bytes.size] = parsed_bytes
+                self._rx.bytes_in_buffer = parsed_bytes.size  # Includes encoded payload + CRC postamble!
                 return True  # Success code
 
             # Partial success status. The method was able to resolve the start_byte, but not the payload_size. This
@@ -914,10 +5475,7 @@ class TransportLayer:
             ):
                 # The only way for _bytes_available() to return False is due to timeout guard aborting additional bytes'
                 # reception.
-                message = (
-                    f"Failed to parse the size of the incoming serial packet. The packet size byte was not received in "
-                    f"time ({self._timeout} microseconds), following the reception of the START byte."
-                )
+                message = self._reception_error_message(status, parsed_bytes_count, parsed_bytes.size, last_byte=0)
                 console.error(message=message, error=RuntimeError)
 
                 # This explicit fallback terminator is here to appease Mypy and will never be reached.
@@ -926,17 +5484,13 @@ class TransportLayer:
             # Partial success status. This is generally similar to status 0 with one notable exception. Status 2 means
             # that the payload size was parsed and, therefore, the exact number of bytes making up the processed packet
             # is known. This method, therefore, blocks until the class is able to receive enough bytes to fully
-            # represent the packet or until the reception timeout.
+            # represent the packet or until the reception timeout. If the framing codec is not fixed-size, only the
+            # maximum size of the packet is known, so the method only waits for the next byte of the packet.
+            remaining_packet_bytes = parsed_bytes.size - parsed_bytes_count if fixed_size else 1
             if status == TransportLayerStatus.NOT_ENOUGH_PACKET_BYTES and not self._bytes_available(
-                required_bytes_count=parsed_bytes.size - parsed_bytes_count, timeout=self._timeout
+                required_bytes_count=remaining_packet_bytes, timeout=self._timeout
             ):
-                # The only way for _bytes_available() to return False is due to timeout guard aborting additional bytes'
-                # reception.
-                message = (
-                    f"Failed to parse the incoming serial packet data. The byte number {parsed_bytes_count + 1} "
-                    f"out of {parsed_bytes.size} was not received in time ({self._timeout} microseconds), "
-                    f"following the reception of the previous byte. Packet reception staled."
-                )
+                message = self._reception_error_message(status, parsed_bytes_count, parsed_bytes.size, last_byte=0)
                 console.error(message=message, error=RuntimeError)
 
                 # This explicit fallback terminator is here to appease Mypy and will never be reached.
@@ -947,16 +5501,9 @@ class TransportLayer:
             # packet parsing method). However, it is implemented to avoid confusion with status 2 and 0.
             if status == TransportLayerStatus.NOT_ENOUGH_CRC_BYTES and not self._bytes_available(
                 required_bytes_count=parsed_bytes.size - parsed_bytes_count, timeout=self._timeout
-            ):
-                # The only way for _bytes_available() to return False is due to timeout guard aborting additional bytes'
-                # reception.
-                message = (
-                    f"Failed to parse the incoming serial packet's CRC postamble. The byte number "
-                    f"{parsed_bytes_count + 1} out of {parsed_bytes.size} was not received in time "
-                    f"({self._timeout} microseconds), following the reception of the previous byte. Packet reception "
-                    f"staled."
-                )  # pragma: no cover
-                console.error(message=message, error=RuntimeError)  # pragma: no cover
+            ):  # pragma: no cover
+                message = self._reception_error_message(status, parsed_bytes_count, parsed_bytes.size, last_byte=0)
+                console.error(message=message, error=RuntimeError)
 
                 # This explicit fallback terminator is here to appease Mypy and will never be reached.
                 raise RuntimeError(message)  # pragma: no cover
@@ -966,65 +5513,165 @@ class TransportLayer:
             if status <= TransportLayerStatus.NOT_ENOUGH_CRC_BYTES:
                 continue
 
-            # Any code other than partial or full success code is interpreted as the terminal code. All codes other
-            # than 101 are error codes. Code 101 is a non-error non-success terminal code. This clause also contains
-            # the resolution for unexpected status codes.
-
             # No packet to receive. This is a non-error terminal status.
             if status == TransportLayerStatus.NO_BYTES_TO_READ:
                 return False  # Non-error, non-success return code
 
-            # Parsed payload size is not within the boundaries specified by the minimum and maximum payload sizes.
-            if status == TransportLayerStatus.PAYLOAD_SIZE_MISMATCH:
-                message = (
-                    f"Failed to parse the incoming serial packet data. The parsed size of the COBS-encoded payload "
-                    f"({parsed_bytes.size}), is outside the expected boundaries "
-                    f"({self._min_rx_payload_size} to {self._max_rx_payload_size}). This likely indicates a "
-                    f"mismatch in the transmission parameters between this system and the Microcontroller."
-                )
+            # Any other code is an error code. This also resolves unexpected status codes.
+            last_byte = int(parsed_bytes[parsed_bytes_count - 1]) if 0 < parsed_bytes_count <= parsed_bytes.size else 0
+            message = self._reception_error_message(status, parsed_bytes_count, parsed_bytes.size, last_byte)
+            console.error(message=message, error=RuntimeError)
 
-            # Delimiter byte value was encountered before reaching the end of the COBS-encoded payload data region.
-            # 'expected number' is calculated like this: parsed_bytes has space for the encoded packet + CRC. So, to get
-            # the expected delimiter byte number, we just subtract the CRC size from the parsed_bytes size.
-            elif status == TransportLayerStatus.DELIMITER_FOUND_TOO_EARLY:
-                message = (
-                    f"Failed to parse the incoming serial packet data. Delimiter byte value ({self._delimiter_byte}) "
-                    f"encountered at payload byte number {parsed_bytes_count}, instead of the expected byte number "
-                    f"{parsed_bytes.size - int(self._postamble_size)}. This likely indicates packet corruption or "
-                    f"mismatch in the transmission parameters between this system and the Microcontroller."
-                )
+            # This explicit fallback terminator is here to appease Mypy and will never be reached.
+            raise RuntimeError(message)  # pragma: no cover
 
-            # The last COBS-encoded payload (encoded packet's) data value does not match the expected delimiter byte
-            # value.
-            elif status == TransportLayerStatus.DELIMITER_NOT_FOUND:
-                message = (
-                    f"Failed to parse the incoming serial packet data. Delimiter byte value ({self._delimiter_byte}) "
-                    f"expected as the last encoded packet byte ({parsed_bytes.size - int(self._postamble_size)}), but "
-                    f"instead encountered {parsed_bytes[parsed_bytes_count - 1]}. This likely indicates packet "
-                    f"corruption or mismatch in the transmission parameters between this system and the "
-                    f"Microcontroller."
-                )
+        # The static guard for the loop exhausting its iterations. Reaching this clause should not be possible.
+        message = self._reception_error_message(status, parsed_bytes_count, parsed_bytes.size, last_byte=0)
+        console.error(message=message, error=RuntimeError)  # pragma: no cover
 
-            # Unknown status_code. Reaching this clause should not be possible. This is a static guard to help
-            # developers during future codebase updates.
-            else:  # pragma: no cover
-                break  # Breaks the loop, which issues the 'unknown status code' message
+        # This explicit fallback terminator is here to appease Mypy and will never be reached.
+        raise RuntimeError(message)  # pragma: no cover
 
-            # Raises the resolved error message as RuntimeError.
-            console.error(message=message, error=RuntimeError)
+    def _receive_packet_gil_free(self) -> tuple[bool, int]:
+        """Receives, validates, and decodes the next packet using the GIL-free reception engine.
 
-        # The static guard for unknown status code. This is moved to the end of the message to appease MyPy.
-        message = (
-            f"Failed to parse the incoming serial packet data. Encountered an unknown status value "
-            f"{status}, returned by the _receive_packet() method. Manual user intervention is required to "
-            f"resolve the issue."
-        )  # pragma: no cover
-        # Raises the resolved error message as RuntimeError.
-        console.error(message=message, error=RuntimeError)  # pragma: no cover
+        Notes:
+            Unlike the _receive_packet() method, this method does not return to the interpreter while waiting for the
+            packet's bytes. The whole reception runtime, including the reads from the serial port, is executed by the
+            _receive_packet_nogil() method, which does not hold the GIL.
+
+        Returns:
+            A tuple of two elements. The first element is True if the method received a packet and False if there are
+            no packet bytes to parse (valid non-error status). The second element is the size of the decoded payload
+            stored in the reception buffer or 0 if the received packet failed the integrity verification.
+
+        Raises:
+            RuntimeError: If the method runs into an error while parsing the incoming packet.
+            SerialException: If the serial port was hung up.
+        """
+        # Converts the inter-byte timeout from microseconds to milliseconds, which is the resolution of the poll()
+        # syscall. Rounds up to never wait less than the configured timeout.
+        timeout = max(-(-self._timeout // 1000), 1)
+
+        status, stream_size, parsed_bytes_count, packet_size, last_byte, payload_size = self._receive_packet_nogil(
+            self._port.fileno(),
+            self._rx.stream_buffer,
+            self._rx.stream_size,
+            self._rx.buffer,
+            self._start_byte,
+            self._max_rx_payload_size,
+            self._min_rx_payload_size,
+            self._postamble_size,
+            self._minimum_packet_size,
+            self._framing_processor.processor,
+            self._crc_processor.processor,
+            timeout,
+        )
+        self._rx.stream_size = stream_size
+
+        # Packet received. The payload size is 0 if the packet failed the integrity verification.
+        if status == TransportLayerStatus.PACKET_PARSED:
+            return True, payload_size
+
+        # No packet to receive. This is a non-error terminal status.
+        if status == TransportLayerStatus.NO_BYTES_TO_READ:
+            return False, 0
+
+        # The Microcontroller was disconnected. The error is handled by the caller, which reopens the port if the
+        # automatic reconnection is enabled.
+        if status == TransportLayerStatus.PORT_DISCONNECTED:
+            message = "The serial port was hung up."
+            raise SerialException(message)
+
+        # Any other status is an error. This includes the partial success statuses, which the engine only returns if
+        # the packet's bytes were not received in time.
+        message = self._reception_error_message(status, parsed_bytes_count, packet_size, last_byte)
+        console.error(message=message, error=RuntimeError)
 
         # This explicit fallback terminator is here to appease Mypy and will never be reached.
         raise RuntimeError(message)  # pragma: no cover
 
+    def _reception_error_message(self, status: int, parsed_bytes_count: int, packet_size: int, last_byte: int) -> str:
+        """Resolves the error message that describes the input packet reception status.
+
+        This method is shared by all packet reception routines to ensure they report errors identically.
+
+        Args:
+            status: The TransportLayerStatus code returned by the packet parsing routine.
+            parsed_bytes_count: The number of packet's bytes parsed before the routine escaped.
+            packet_size: The size of the packet (COBS-encoded payload + CRC postamble) being parsed. For the
+                PAYLOAD_SIZE_MISMATCH status, this is the invalid payload size parsed from the packet.
+            last_byte: The value of the last parsed packet byte. Only used by the DELIMITER_NOT_FOUND status.
+
+        Returns:
+            The error message to be raised as RuntimeError by the caller.
+        """
+        # Packet size byte was not received in time, following the reception of the start byte.
+        if status == TransportLayerStatus.PACKET_SIZE_UNKNOWN:
+            message = (
+                f"Failed to parse the size of the incoming serial packet. The packet size byte was not received in "
+                f"time ({self._timeout} microseconds), following the reception of the START byte."
+            )
+
+        # The packet's data bytes were not received in time.
+        elif status == TransportLayerStatus.NOT_ENOUGH_PACKET_BYTES:
+            message = (
+                f"Failed to parse the incoming serial packet data. The byte number {parsed_bytes_count + 1} "
+                f"out of {packet_size} was not received in time ({self._timeout} microseconds), "
+                f"following the reception of the previous byte. Packet reception staled."
+            )
+
+        # The packet's CRC postamble bytes were not received in time.
+        elif status == TransportLayerStatus.NOT_ENOUGH_CRC_BYTES:  # pragma: no cover
+            message = (
+                f"Failed to parse the incoming serial packet's CRC postamble. The byte number "
+                f"{parsed_bytes_count + 1} out of {packet_size} was not received in time "
+                f"({self._timeout} microseconds), following the reception of the previous byte. Packet reception "
+                f"staled."
+            )
+
+        # Parsed payload size is not within the boundaries specified by the minimum and maximum payload sizes.
+        elif status == TransportLayerStatus.PAYLOAD_SIZE_MISMATCH:
+            message = (
+                f"Failed to parse the incoming serial packet data. The parsed size of the COBS-encoded payload "
+                f"({packet_size}), is outside the expected boundaries "
+                f"({self._min_rx_payload_size} to {self._max_rx_payload_size}). This likely indicates a "
+                f"mismatch in the transmission parameters between this system and the Microcontroller."
+            )
+
+        # Delimiter byte value was encountered before reaching the end of the COBS-encoded payload data region.
+        # 'expected number' is calculated like this: the packet has space for the encoded payload + CRC. So, to get
+        # the expected delimiter byte number, we just subtract the CRC size from the packet size.
+        elif status == TransportLayerStatus.DELIMITER_FOUND_TOO_EARLY:
+            message = (
+                f"Failed to parse the incoming serial packet data. Delimiter byte value ({self._delimiter_byte}) "
+                f"encountered at payload byte number {parsed_bytes_count}, instead of the expected byte number "
+                f"{packet_size - int(self._postamble_size)}. This likely indicates packet corruption or "
+                f"mismatch in the transmission parameters between this system and the Microcontroller."
+            )
+
+        # The last COBS-encoded payload (encoded packet's) data value does not match the expected delimiter byte
+        # value.
+        elif status == TransportLayerStatus.DELIMITER_NOT_FOUND:
+            message = (
+                f"Failed to parse the incoming serial packet data. Delimiter byte value ({self._delimiter_byte}) "
+                f"expected as the last encoded packet byte ({packet_size - int(self._postamble_size)}), but "
+                f"instead encountered {last_byte}. This likely indicates packet "
+                f"corruption or mismatch in the transmission parameters between this system and the "
+                f"Microcontroller."
+            )
+
+        # Unknown status_code. Reaching this clause should not be possible. This is a static guard to help
+        # developers during future codebase updates.
+        else:  # pragma: no cover
+            message = (
+                f"Failed to parse the incoming serial packet data. Encountered an unknown status value "
+                f"{status}, returned by the _receive_packet() method. Manual user intervention is required to "
+                f"resolve the issue."
+            )
+
+        return message
+
     def _bytes_available(self, required_bytes_count: int = 1, timeout: int = 0) -> bool:
         """Determines if the required number of bytes is available across all class buffers that store unprocessed
         serial stream bytes.
@@ -1043,56 +5690,158 @@ class TransportLayer:
         Returns:
             True if enough bytes are available at the end of this method's runtime to justify parsing the packet.
         """
-        # Tracks the number of bytes available from the leftover_bytes buffer
-        available_bytes = len(self._leftover_bytes)
+        # Tracks the number of bytes available from the stream buffer
+        available_bytes = self._rx.stream_size
 
-        # If the requested number of bytes is already available from the leftover_bytes buffer, returns True.
+        # If the requested number of bytes is already available from the stream buffer, returns True.
         if available_bytes >= required_bytes_count:
             return True
 
-        # If there are not enough leftover bytes to satisfy the requirement, enters a timed loop that waits for
+        # If there are not enough stream buffer bytes to satisfy the requirement, enters a timed loop that waits for
         # the serial port to receive additional bytes. The serial port has its own buffer, and it takes a
         # comparatively long time to view and access that buffer. Hence, this is a 'fallback' procedure.
-        self._timer.reset()  # Resets the timer before entering the loop
+        self._rx.timer.reset()  # Resets the timer before entering the loop
         previous_additional_bytes = 0  # Tracks how many bytes were available during the previous iteration of the loop
         once = True  # Allows the loop below to run once even if timeout is 0
-        while self._timer.elapsed < timeout or once:
+        while self._rx.timer.elapsed < timeout or once:
             # Deactivates the 'once' condition to make future loop iterations correctly depend on timeout
             if once:
                 once = False
 
+            # Does not read more bytes than the stream buffer can store. Since the stream buffer is always large enough
+            # to store a complete packet, this does not prevent parsing the packet.
+            free_space = self._rx.stream_buffer.size - self._rx.stream_size
+
+            # If the previous read returned all requested bytes, the serial port likely stores more bytes, so reads
+            # them without querying the number of available bytes first.
+            if self._rx.read_saturated:
+                if self._read_stream_bytes(min(self._rx.read_size, free_space)):
+                    self._rx.timer.reset()
+                if self._rx.stream_size >= required_bytes_count:
+                    return True
+                continue
+
+            self._rx.port_calls += 1
             additional_bytes = self._port.in_waiting  # Returns the number of bytes that can be read from serial port.
-            total_bytes = available_bytes + additional_bytes  # Combines leftover and serial port bytes.
+            total_bytes = self._rx.stream_size + additional_bytes  # Combines buffered and serial port bytes.
 
-            # If the combined total matches the required number of bytes, reads additional bytes into the leftover_bytes
-            # buffer and returns True.
+            # If the combined total matches the required number of bytes, reads additional bytes into the stream
+            # buffer and returns True. Requests at least the adaptive read size, so that the read also collects the
+            # bytes that arrive after the query.
             if total_bytes >= required_bytes_count:
-                self._leftover_bytes += self._port.read(
-                    additional_bytes
-                )  # This takes twice as long as the 'available' check
+                # This takes twice as long as the 'available' check
+                self._read_stream_bytes(min(max(additional_bytes, self._rx.read_size), free_space))
                 return True
 
             # If the total number of bytes was not enough, checks whether serial port has received any additional bytes
             # since the last loop iteration. This is primarily used to reset the timer upon new bytes' reception.
             if previous_additional_bytes < additional_bytes:  # pragma: no cover
                 previous_additional_bytes = additional_bytes  # Updates the byte tracker, if necessary
-                self._timer.reset()  # Resets the timeout timer as long as the port receives additional bytes
+                self._rx.timer.reset()  # Resets the timeout timer as long as the port receives additional bytes
+
+            # Waits for the serial port to receive additional bytes, as determined by the instance's wait strategy.
+            elapsed = self._rx.timer.elapsed
+            self._wait(waited=elapsed, remaining=timeout - elapsed)
 
         # If there are not enough bytes across both buffers, returns False.
         return False
 
+    def _read_stream_bytes(self, size: int) -> int:
+        """Reads up to the requested number of bytes from the serial port into the stream buffer and adapts the size
+        of the next read to the number of returned bytes.
+
+        Notes:
+            On Linux and macOS, the method reads the bytes directly into the stream buffer with a single read() syscall
+            on the serial port's non-blocking file descriptor. Otherwise, it uses the read() method of the serial port.
+
+            If the read returns all requested bytes, the next read requests twice as many bytes. Otherwise, the next
+            read requests twice the number of bytes that arrived since the previous read. The read size is bounded, as
+            the bytes left over after parsing each packet are moved to the beginning of the stream buffer.
+
+            Since the serial port is configured to return immediately, a read of a port without new bytes either
+            fails or returns no bytes. A read of a hung-up port, for example, after the Microcontroller's USB device is
+            unplugged, also returns no bytes (the end of the stream), so the method checks the port for the hang-up
+            event whenever a read returns no bytes.
+
+        Args:
+            size: The maximum number of bytes to read. Must not exceed the free space of the stream buffer.
+
+        Returns:
+            The number of bytes read from the serial port.
+
+        Raises:
+            SerialException: If the serial port was hung up.
+        """
+        self._rx.port_calls += 1
+        if isinstance(self._port, Serial) and sys.platform != "win32":  # pragma: no cover
+            start = self._rx.stream_size
+            try:
+                count = os.readv(self._port.fileno(), (self._rx.stream_buffer[start : start + size],))
+            except BlockingIOError:
+                count = 0
+            if (
+                count == 0
+                and self._poller is not None
+                and any(mask & _POLL_FAILURE for _, mask in self._poller.poll(0))
+            ):
+                message = "The serial port was hung up: the read returned the end of the stream."
+                raise SerialException(message)
+            self._rx.stream_size += count
+        else:
+            count = self._rx.append_stream_bytes(self._port.read(size))
+
+        self._rx.read_saturated = 0 < count == size
+        self._rx.read_size = min(max(2 * count, self._rx.buffer.size), _MAXIMUM_READ_SIZE)
+        return count
+
+    def _wait(self, waited: int, remaining: int) -> None:
+        """Waits for the serial port to receive new bytes, as determined by the instance's wait strategy.
+
+        This method is shared by all routines that wait for the serial port's bytes to ensure they wait consistently.
+        During the spin phase, the method returns immediately. During the yield phase, it yields the CPU to other
+        threads. During the sleep phase, it sleeps until the serial port receives new bytes or the poll interval runs
+        out.
+
+        Args:
+            waited: The number of microseconds that passed since the beginning of the wait or the most recent
+                reception of new bytes.
+            remaining: The maximum number of microseconds the method is allowed to wait.
+        """
+        strategy = self._wait_strategy
+        if waited < strategy.spin_duration or remaining <= 0:
+            return
+
+        if waited - strategy.spin_duration < strategy.yield_duration:
+            time.sleep(0)
+            return
+
+        # Does not sleep past the caller's timeout. Since poll() has the millisecond resolution, the timeout is
+        # rounded up to the next whole millisecond.
+        interval = min(strategy.poll_interval, remaining)
+        if self._poller is not None:  # pragma: no cover
+            events = self._poller.poll(interval / 1000)
+
+            # A hung-up port is always readable, so the sleep would end immediately without detecting the
+            # Microcontroller's disconnection. Checks the returned events for the hang-up instead.
+            if any(mask & _POLL_FAILURE for _, mask in events):
+                message = "The serial port was hung up."
+                raise SerialException(message)
+        else:
+            time.sleep(interval / 1_000_000)
+
     @staticmethod
     @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
     def _parse_packet(
         unparsed_bytes: NDArray[np.uint8],
         start_byte: np.uint8,
-        delimiter_byte: np.uint8,
+        framing_processor: _FramingProcessor,
         max_payload_size: np.uint8,
         min_payload_size: np.uint8,
         postamble_size: np.uint8,
         start_found: bool = False,
         parsed_byte_count: int = 0,
         parsed_bytes: NDArray[np.uint8] = _EMPTY_ARRAY,
+        check_delimiter: bool = True,
     ) -> tuple[int, int, NDArray[np.uint8], NDArray[np.uint8]]:
         """Parses as much of the incoming serialized packet's data as possible using the input unparsed_bytes object.
 
@@ -1101,23 +5850,32 @@ class TransportLayer:
             multiple calls to fully parse the packet. The method is written in a way that supports iterative calls to
             work on the same packet.
 
-            For this method, the 'packet' refers to the COBS encoded payload + the CRC checksum postamble. While each
+            For this method, the 'packet' refers to the encoded payload + the CRC checksum postamble. While each
             received byte stream also necessarily includes the metadata preamble, the preamble data is used and
             discarded during this method's runtime.
 
+            If the size of the encoded payload depends on its contents (the framing codec is not fixed-size), the
+            encoded payload ends at the first delimiter byte, and the parsed_bytes array is trimmed to the actual size
+            of the packet once the delimiter is found.
+
         Args:
             unparsed_bytes: A bytes() object that stores the serial stream bytes ot be parsed.
             start_byte: The byte-value used to mark the beginning of a transmitted packet in the byte-stream.
-            delimiter_byte: The byte-value used to mark the end of a transmitted packet in the byte-stream.
+            framing_processor: The inner jitclass instance of the framing codec. Provides the byte-value used to mark
+                the end of the encoded payload and the maximum size of the encoded payload.
             max_payload_size: The maximum size of the payload, in bytes, that can be received.
             min_payload_size: The minimum size of the payload, in bytes, that can be received.
-            postamble_size: The number of bytes needed to store the CRC checksum.
+            postamble_size: The number of bytes needed to store the CRC checksum and the forward error correction
+                parity bytes.
             start_found: Iterative argument. When this method is called two or more times, this value can be provided
                 to the method to skip resolving the start byte (detecting packet presence).
             parsed_byte_count: Iterative parameter. When this method is called multiple times, this value communicates
                 how many bytes out of the expected byte number have been parsed by the previous method runtime.
             parsed_bytes: Iterative parameter. This object is initialized to the expected packet size once it is parsed.
                 Multiple method runtimes may be necessary to fully fill the object with parsed data bytes.
+            check_delimiter: Determines whether to verify the position of the delimiter byte inside the encoded
+                payload. This is disabled when forward error correction is enabled, as a corrupted delimiter byte can
+                be corrected after the packet is parsed.
 
         Returns:
             A tuple of four elements. The first element is an integer status code that describes the runtime. The
@@ -1125,6 +5883,9 @@ class TransportLayer:
             bytes' object that stores any unprocessed bytes that remain after method runtime. The fourth element
             is the uint8 array that stores some or all of the packet's bytes.
         """
+        delimiter_byte = framing_processor.delimiter
+        fixed_size = framing_processor.fixed_size
+
         # Converts the input 'bytes' object to a numpy array to optimize further buffer manipulations
         total_bytes = unparsed_bytes.size  # Calculates the total number of bytes available for parsing
         processed_bytes = 0  # Tracks how many input bytes are processed during method runtime
@@ -1181,11 +5942,11 @@ class TransportLayer:
                     parsed_bytes,
                 )
 
-            # If payload size passed verification, calculates the number of bytes occupied by the COBS-encoded payload
-            # and the CRC postamble. Specifically, uses the payload_size and increments it with +2 to account for the
+            # If payload size passed verification, calculates the maximum number of bytes occupied by the encoded
+            # payload and the CRC postamble. For COBS, this adds 2 bytes to the payload_size to account for the
             # overhead and delimiter bytes introduced by COBS-encoding the packet. Also adds the size of the CRC
             # postamble.
-            remaining_size = int(payload_size) + 2 + int(postamble_size)
+            remaining_size = framing_processor.maximum_encoded_size(int(payload_size)) + int(postamble_size)
 
             # Uses the calculated size to pre-initialize the parsed_bytes array to accommodate the encoded payload and
             # the CRC postamble. Subsequently, the size of the array will be used to infer the size of the encoded
@@ -1224,10 +5985,17 @@ class TransportLayer:
                 parsed_byte_count += 1  # Unlike processed_bytes, this tracker is shared by multiple method calls.
                 remaining_packet_bytes -= 1  # Decrements remaining packet bytes counter with each processed byte
 
+                # If the codec is not fixed-size, the first delimiter byte marks the end of the encoded payload. Trims
+                # the parsed_bytes array to the actual size of the packet and advances to the CRC postamble parsing
+                # stage.
+                if not fixed_size and unparsed_bytes[i] == delimiter_byte:
+                    parsed_bytes = parsed_bytes[: parsed_byte_count + int(postamble_size)]
+                    break
+
                 # If the evaluated byte matches the delimiter byte value and this is not the last byte of the encoded
                 # payload, the packet is likely corrupted. Returns with error code 104: Delimiter byte encountered too
                 # early.
-                if unparsed_bytes[i] == delimiter_byte and remaining_packet_bytes != 0:
+                if check_delimiter and unparsed_bytes[i] == delimiter_byte and remaining_packet_bytes != 0:
                     remaining_bytes = unparsed_bytes[processed_bytes:].copy()  # Returns any remaining unprocessed bytes
                     return (
                         TransportLayerStatus.DELIMITER_FOUND_TOO_EARLY.value,
@@ -1238,7 +6006,8 @@ class TransportLayer:
 
                 # If the evaluated byte is a delimiter byte value and this is the last byte of the encoded payload, the
                 # payload is fully parsed. Gracefully breaks the loop and advances to the CRC postamble parsing stage.
-                if unparsed_bytes[i] == delimiter_byte and remaining_packet_bytes == 0:
+                # If the delimiter is not checked, the payload is fully parsed once all of its bytes are processed.
+                if remaining_packet_bytes == 0 and (unparsed_bytes[i] == delimiter_byte or not check_delimiter):
                     break
 
                 # If the last evaluated payload byte is not a delimiter byte value, this also indicates that the
@@ -1297,7 +6066,7 @@ class TransportLayer:
     def _process_packet(
         reception_buffer: NDArray[np.uint8],
         packet_size: int,
-        cobs_processor: _COBSProcessor,
+        framing_processor: _FramingProcessor,
         crc_processor: _CRCProcessor,
     ) -> int:
         """Validates the parsed data packet by verifying its integrity, decodes the COBS-encoded payload, and saves it
@@ -1310,7 +6079,7 @@ class TransportLayer:
         Args:
             reception_buffer: The buffer that stores the packet to be processed.
             packet_size: The size of the packet ot be processed, in bytes.
-            cobs_processor: The inner _COBSProcessor jitclass instance.
+            framing_processor: The inner jitclass instance of the framing codec.
             crc_processor: The inner _CRCProcessor jitclass instance.
 
         Returns:
@@ -1329,8 +6098,8 @@ class TransportLayer:
         # Removes the CRC bytes from the end of the packet, as they are no longer necessary after the CRC verification
         packet = packet[: packet.size - int(crc_processor.crc_byte_length)]
 
-        # Decodes the COBS-encoded payload from the packet
-        payload = cobs_processor.decode_payload(packet=packet)
+        # Decodes the encoded payload from the packet
+        payload = framing_processor.decode_payload(packet)
         if payload.size == 0:
             return 0  # Aborts with an error
 
@@ -1339,3 +6108,184 @@ class TransportLayer:
         # stage is reached
         reception_buffer[: payload.size] = payload
         return payload.size
+
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _verify_packet(
+        reception_buffer: NDArray[np.uint8],
+        packet_size: int,
+        framing_processor: _FramingProcessor,
+        crc_processor: _CRCProcessor,
+    ) -> tuple[int, int]:
+        """Validates the parsed data packet by verifying its integrity and extracts the first byte of its payload
+        without decoding the payload.
+
+        Notes:
+            Extracting the first payload byte during verification allows routing the packet without calling another
+            JIT-compiled function.
+
+        Args:
+            reception_buffer: The buffer that stores the packet to be verified.
+            packet_size: The size of the packet to be verified, in bytes.
+            framing_processor: The inner jitclass instance of the framing codec.
+            crc_processor: The inner _CRCProcessor jitclass instance.
+
+        Returns:
+            A tuple of two elements. The first element is the size of the encoded payload (the packet without the CRC
+            checksum) if the packet is intact or 0 if the packet is corrupted. The second element is the value of the
+            first payload byte or -1 if the packet is corrupted or does not store a correctly encoded payload.
+        """
+        if not crc_processor.calculate_checksum(buffer=reception_buffer[:packet_size], check=True):
+            return 0, -1
+        encoded_size = packet_size - int(crc_processor.crc_byte_length)
+        return encoded_size, framing_processor.peek_byte(reception_buffer[:encoded_size])
+
+    @staticmethod
+    @njit(nogil=True, cache=True)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _decode_packet(
+        reception_buffer: NDArray[np.uint8],
+        encoded_size: int,
+        framing_processor: _FramingProcessor,
+    ) -> int:
+        """Decodes the verified encoded payload stored in the reception buffer and saves it back to the buffer.
+
+        Args:
+            reception_buffer: The buffer that stores the encoded payload.
+            encoded_size: The size of the encoded payload, in bytes.
+            framing_processor: The inner jitclass instance of the framing codec.
+
+        Returns:
+            The size of the decoded payload if the method succeeds or 0 if the payload is not correctly encoded.
+        """
+        payload = framing_processor.decode_payload(reception_buffer[:encoded_size])
+        reception_buffer[: payload.size] = payload
+        return payload.size
+
+    @staticmethod
+    @njit(nogil=True, cache=False)  # type: ignore[untyped-decorator] # pragma: no cover
+    def _receive_packet_nogil(
+        descriptor: int,
+        stream_buffer: NDArray[np.uint8],
+        stream_size: int,
+        reception_buffer: NDArray[np.uint8],
+        start_byte: np.uint8,
+        max_payload_size: np.uint8,
+        min_payload_size: np.uint8,
+        postamble_size: np.uint8,
+        minimum_packet_size: int,
+        framing_processor: _FramingProcessor,
+        crc_processor: _CRCProcessor,
+        timeout: int,
+    ) -> tuple[int, int, int, int, int, int]:
+        """Receives, parses, validates, and decodes the next packet from the serial port's file descriptor.
+
+        Notes:
+            This method implements the full packet reception sequence in nopython mode and does not hold the GIL
+            during runtime. It reads the serial port directly via the read() syscall and waits for the packet's bytes
+            via the poll() syscall, so it only works for non-blocking file descriptors on Linux and macOS systems.
+
+            Caching is disabled for this method, as Numba does not support caching functions that call ctypes
+            functions.
+
+        Args:
+            descriptor: The file descriptor of the serial port.
+            stream_buffer: The buffer that stores the unconsumed serial stream bytes at its beginning.
+            stream_size: The number of unconsumed bytes stored in the stream buffer.
+            reception_buffer: The buffer used to store the decoded payload.
+            start_byte: The byte-value used to mark the beginning of a transmitted packet in the byte-stream.
+            max_payload_size: The maximum size of the payload, in bytes, that can be received.
+            min_payload_size: The minimum size of the payload, in bytes, that can be received.
+            postamble_size: The number of bytes needed to store the CRC checksum.
+            minimum_packet_size: The minimum number of bytes that can represent a valid packet.
+            framing_processor: The inner jitclass instance of the framing codec.
+            crc_processor: The inner _CRCProcessor jitclass instance.
+            timeout: The maximum number of milliseconds that can pass between receiving any two consecutive bytes of
+                the packet.
+
+        Returns:
+            A tuple of six elements. The first element is the TransportLayerStatus code that describes the runtime.
+            The second element is the number of unconsumed bytes left in the stream buffer. The third element is the
+            number of packet's bytes parsed during runtime. The fourth element is the size of the parsed packet. The
+            fifth element is the value of the last parsed packet byte. The sixth element is the size of the decoded
+            payload or 0 if the packet fails the integrity verification. If the serial port was hung up, the status is
+            PORT_DISCONNECTED.
+        """
+        # Statically allocates the pollfd structure used to wait for the packet's bytes: int fd, short events, short
+        # revents.
+        poll_descriptor = np.zeros(_POLLFD_SIZE, dtype=np.uint8)
+        poll_descriptor.view(np.int32)[0] = descriptor
+        poll_descriptor.view(np.int16)[2] = _POLLIN
+        disconnected = TransportLayerStatus.PORT_DISCONNECTED.value
+
+        # If the stream buffer does not contain enough bytes to represent a packet, reads all bytes available from the
+        # serial port. Does not wait for the bytes to arrive, as the start of the next packet is not timed.
+        if stream_size < minimum_packet_size:
+            count = _read(descriptor, stream_buffer.ctypes.data + stream_size, stream_buffer.size - stream_size)
+
+            # Since the serial port is configured to return immediately, a read of a port without new bytes either
+            # fails or returns no bytes, the same as a read of a hung-up port. Therefore, if the read does not return
+            # any bytes, checks the port for the hang-up event to detect the Microcontroller's disconnection.
+            if count <= 0:
+                if _poll(poll_descriptor.ctypes.data, 1, 0) > 0 and poll_descriptor.view(np.int16)[3] & _POLL_FAILURE:
+                    return disconnected, stream_size, 0, 0, 0, 0
+                count = 0
+            stream_size += count
+
+            # If the stream does not contain enough bytes to justify parsing the packet, ends runtime with the
+            # 'no bytes to read' status.
+            if stream_size < minimum_packet_size:
+                return TransportLayerStatus.NO_BYTES_TO_READ.value, stream_size, 0, 0, 0, 0
+
+        status = TransportLayerStatus.NO_BYTES_TO_READ.value
+        start_found = False
+        parsed_bytes_count = 0
+        parsed_bytes = np.empty(0, dtype=np.uint8)
+        while True:
+            status, parsed_bytes_count, remaining_bytes, parsed_bytes = _parse_packet(
+                stream_buffer[:stream_size],
+                start_byte,
+                framing_processor,
+                max_payload_size,
+                min_payload_size,
+                postamble_size,
+                start_found,
+                parsed_bytes_count,
+                parsed_bytes,
+            )
+
+            # Moves the bytes left over after parsing to the beginning of the stream buffer.
+            stream_size = remaining_bytes.size
+            stream_buffer[:stream_size] = remaining_bytes
+
+            # Packet parsed. Validates and decodes the packet inside the reception buffer.
+            if status == TransportLayerStatus.PACKET_PARSED.value:
+                reception_buffer[: parsed_bytes.size] = parsed_bytes
+                payload_size = _process_packet(reception_buffer, parsed_bytes.size, framing_processor, crc_processor)
+                return status, stream_size, parsed_bytes_count, parsed_bytes.size, 0, payload_size
+
+            # Any status other than partial success is terminal.
+            if status > TransportLayerStatus.NOT_ENOUGH_CRC_BYTES.value:
+                last_byte = 0
+                if 0 < parsed_bytes_count <= parsed_bytes.size:
+                    last_byte = int(parsed_bytes[parsed_bytes_count - 1])
+                return status, stream_size, parsed_bytes_count, parsed_bytes.size, last_byte, 0
+
+            # Partial success statuses are only returned after the start byte is found and after consuming all
+            # stream bytes. Waits for the serial port to receive more bytes. If no bytes arrive in time, ends runtime
+            # with the partial success status, which the caller interprets as the reception timeout. If the port
+            # reports the hang-up event, ends runtime with the disconnection status.
+            start_found = True
+            if _poll(poll_descriptor.ctypes.data, 1, timeout) <= 0:
+                return status, stream_size, parsed_bytes_count, parsed_bytes.size, 0, 0
+            if poll_descriptor.view(np.int16)[3] & _POLL_FAILURE:
+                return disconnected, stream_size, parsed_bytes_count, parsed_bytes.size, 0, 0
+            count = _read(descriptor, stream_buffer.ctypes.data, stream_buffer.size)
+            if count <= 0:
+                return status, stream_size, parsed_bytes_count, parsed_bytes.size, 0, 0
+            stream_size = count
+
+
+# Exposes the packet parsing and processing methods as module-level functions. This allows the GIL-free reception
+# engine to call them from nopython code, as Numba cannot resolve the static methods of a Python class.
+_parse_packet = TransportLayer._parse_packet
+_process_packet = TransportLayer._process_packet
@@ -1,29 +1,87 @@
-from enum import IntEnum
+from enum import IntEnum, IntFlag, StrEnum
+import select
 from typing import Any
+from collections import deque
+from collections.abc import Callable, Iterable, Iterator
+from threading import Lock, Event, RLock, Thread
+from dataclasses import dataclass
 
 import numpy as np
 from serial import Serial
 from _typeshed import Incomplete
 from numpy.typing import NDArray as NDArray
+from ataraxis_time import PrecisionTimer
 from serial.tools.list_ports_common import ListPortInfo
 
 from .helper_modules import (
+    CRCPreset as CRCPreset,
     SerialMock as SerialMock,
+    LZProcessor as LZProcessor,
     CRCProcessor as CRCProcessor,
     COBSProcessor as COBSProcessor,
+    COBSRProcessor as COBSRProcessor,
     _CRCProcessor as _CRCProcessor,
     _COBSProcessor as _COBSProcessor,
+    _COBSRProcessor as _COBSRProcessor,
+    ReedSolomonProcessor as ReedSolomonProcessor,
+    ByteStuffingProcessor as ByteStuffingProcessor,
+    _ByteStuffingProcessor as _ByteStuffingProcessor,
 )
 
 _ZERO: Incomplete
 _POLYNOMIAL: Incomplete
 _EMPTY_ARRAY: Incomplete
+_STREAM_BUFFER_SIZE: int
+_MAXIMUM_READ_SIZE: int
+_POLLIN: int
+_POLL_FAILURE: int
+_POLLFD_SIZE: int
+_MCL_CURRENT: int
+_LATENCY_BUFFER_SIZE: int
+_LATENCY_HISTOGRAM_BINS: int
+_MAXIMUM_BIT_WIDTH: int
+_MAXIMUM_VARINT_SIZE: int
+_RAW_PAYLOAD: int
+_COMPRESSED_PAYLOAD: int
+_KEY_FRAME: int
+_DELTA_FRAME: int
+_HANDSHAKE_CODE: int
+_HANDSHAKE_VERSION: int
+_HANDSHAKE_BUFFER_SIZE: int
+_HANDSHAKE_REQUEST: int
+_HANDSHAKE_CAPABILITIES: int
+_HANDSHAKE_SELECTION: int
+_HANDSHAKE_ACKNOWLEDGMENT: int
+_HANDSHAKE_ECHO_REQUEST: int
+_HANDSHAKE_ECHO_RESPONSE: int
+_CAPABILITIES_SIZE: int
+_HANDSHAKE_RESEND_INTERVAL: int
+_ECHO_HEADER_SIZE: int
+_BAUDRATE_PROBE_COUNT: int
+_BAUDRATE_PROBE_TIMEOUT: int
+_RECONNECTION_BACKOFF: int
+_MAXIMUM_RECONNECTION_BACKOFF: int
+_SYSFS_TTY_ROOT: str
+_SYSFS_KERNEL_ROOT: str
+_PORT_CACHE: dict[str, tuple[str, tuple[ListPortInfo, ...]]]
+_PORT_CACHE_LOCK: Lock
+_SESSION_FEATURE_COUNTS: dict[str, int]
+_SESSION_FEATURE_LOCK: Lock
+_LIBC: Incomplete
+_read: Incomplete
+_poll: Incomplete
+_mlockall: Incomplete
+_munlockall: Incomplete
+_tcdrain: Incomplete
 type CRCType = np.uint8 | np.uint16 | np.uint32
+type FramingProcessor = COBSProcessor | COBSRProcessor | ByteStuffingProcessor
+type _FramingProcessor = _COBSProcessor | _COBSRProcessor | _ByteStuffingProcessor
 
 class TransportLayerStatus(IntEnum):
     INSUFFICIENT_BUFFER_SPACE_ERROR = -1
-    MULTIDIMENSIONAL_ARRAY_ERROR = -2
     EMPTY_ARRAY_ERROR = -3
+    BIT_FIELD_OVERFLOW_ERROR = -4
+    MALFORMED_VARINT_ERROR = -5
     PACKET_SIZE_UNKNOWN = 0
     PACKET_PARSED = 1
     NOT_ENOUGH_PACKET_BYTES = 2
@@ -32,9 +90,305 @@ class TransportLayerStatus(IntEnum):
     PAYLOAD_SIZE_MISMATCH = 5
     DELIMITER_FOUND_TOO_EARLY = 6
     DELIMITER_NOT_FOUND = 7
+    PORT_DISCONNECTED = 8
 
-def list_available_ports() -> tuple[ListPortInfo, ...]: ...
+class FramingCodec(StrEnum):
+    COBS = "cobs"
+    COBSR = "cobs_r"
+    SLIP = "slip"
+    HDLC = "hdlc"
+
+class MicrocontrollerFeature(IntFlag):
+    COMPRESSION = 1
+    DELTA_TRANSMISSION = 2
+    FORWARD_ERROR_CORRECTION = 4
+    EXTENDED_FRAMES = 8
+    BATCHING = 16
+    ACKNOWLEDGMENTS = 32
+
+_CODEC_PREFERENCE: tuple[FramingCodec, ...]
+_NEGOTIATED_ARGUMENTS: frozenset[str]
+
+def list_available_ports(
+    vid: int | None = None,
+    pid: int | None = None,
+    serial_number: str | None = None,
+    manufacturer: str | None = None,
+    *,
+    use_cache: bool = False,
+) -> tuple[ListPortInfo, ...]: ...
+def find_port(
+    vid: int | None = None,
+    pid: int | None = None,
+    serial_number: str | None = None,
+    manufacturer: str | None = None,
+    *,
+    use_cache: bool = False,
+) -> str | None: ...
+def _port_matches(
+    info: ListPortInfo,
+    vid: int | None = None,
+    pid: int | None = None,
+    serial_number: str | None = None,
+    manufacturer: str | None = None,
+) -> bool: ...
+def _read_sysfs_attribute(directory: str, name: str) -> str | None: ...
+def _scan_sysfs_ports(
+    root: str,
+    vid: int | None = None,
+    pid: int | None = None,
+    serial_number: str | None = None,
+    manufacturer: str | None = None,
+) -> tuple[ListPortInfo, ...]: ...
+def _resolve_sysfs_device(root: str, entry_path: str, is_symlink: bool) -> tuple[str, str, str | None]: ...
 def print_available_ports() -> None: ...
+def _find_serial_number(port: str) -> str | None: ...
+
+class _TransmissionPath:
+    buffer: NDArray[np.uint8]
+    bytes_in_buffer: int
+    packet_count: int
+    delta_reference: NDArray[np.uint8]
+    delta_reference_size: int
+    delta_sequence: int
+    delta_frame_count: int
+    timer: PrecisionTimer
+    lock: RLock
+    ring: NDArray[np.uint8]
+    ring_start: int
+    ring_count: int
+    high_watermark: int
+    low_watermark: int
+    on_high: Callable[[], None] | None
+    on_low: Callable[[], None] | None
+    throttled: bool
+    tracker: _TransmissionTracker | None
+    connection: int
+    disconnection: tuple[OSError, int] | None
+    def __init__(self, buffer_size: int, ring_size: int = 0) -> None: ...
+    def __repr__(self) -> str: ...
+    def push_ring(self, data: NDArray[np.uint8]) -> None: ...
+    def pending_segment(self) -> NDArray[np.uint8]: ...
+    def consume_ring(self, count: int) -> None: ...
+
+class _ReceptionPath:
+    slots: tuple[NDArray[np.uint8], ...]
+    slot_index: int
+    buffer: NDArray[np.uint8]
+    held_slots: set[int]
+    free_slots: list[int]
+    slot_lock: Lock
+    bytes_in_buffer: int
+    encoded_size: int
+    first_byte: int
+    consumed_bytes: int
+    stream_buffer: NDArray[np.uint8]
+    stream_size: int
+    read_size: int
+    read_saturated: bool
+    port_calls: int
+    packet_count: int
+    delta_reference: NDArray[np.uint8]
+    delta_reference_size: int
+    delta_sequence: int
+    connection: int
+    timer: PrecisionTimer
+    wait_timer: PrecisionTimer
+    lock: RLock
+    def __init__(self, buffer_size: int, stream_buffer_size: int = ..., slot_count: int = 1) -> None: ...
+    def __repr__(self) -> str: ...
+    def hold_slot(self) -> bool: ...
+    def release_slot(self, index: int) -> None: ...
+    def rotate_slot(self) -> bool: ...
+    def append_stream_bytes(self, data: bytes) -> int: ...
+
+class HeldPayload:
+    _data: NDArray[np.uint8]
+    _reception_path: _ReceptionPath
+    _slot_index: int
+    _released: bool
+    def __init__(self, data: NDArray[np.uint8], reception_path: _ReceptionPath, slot_index: int) -> None: ...
+    def __repr__(self) -> str: ...
+    def __enter__(self) -> HeldPayload: ...
+    def __exit__(self, *args: object) -> None: ...
+    @property
+    def data(self) -> NDArray[np.uint8]: ...
+    @property
+    def released(self) -> bool: ...
+    def release(self) -> None: ...
+
+@dataclass(frozen=True)
+class WaitStrategy:
+    spin_duration: int = ...
+    yield_duration: int = ...
+    poll_interval: int = ...
+    @classmethod
+    def spin(cls) -> WaitStrategy: ...
+    @classmethod
+    def hybrid(cls, spin_duration: int = 50, yield_duration: int = 200, poll_interval: int = 1000) -> WaitStrategy: ...
+    @classmethod
+    def sleep(cls, poll_interval: int = 1000) -> WaitStrategy: ...
+
+class BitField:
+    __slots__: Incomplete
+    _accepted_numpy_types: tuple[type[np.bool], type[np.uint8], type[np.uint16], type[np.uint32], type[np.uint64]]
+    values: NDArray[Any]
+    widths: NDArray[np.uint8]
+    def __init__(self, values: NDArray[Any], widths: int | tuple[int, ...] | NDArray[np.uint8] = 1) -> None: ...
+    def __repr__(self) -> str: ...
+    @property
+    def nbytes(self) -> int: ...
+
+def _zigzag_encode(value: np.uint64) -> np.uint64: ...
+def _zigzag_decode(value: np.uint64) -> np.uint64: ...
+def _varint_sizes(bits: NDArray[np.uint64], signed: bool, delta: bool) -> NDArray[np.uint8]: ...
+
+class VarintArray:
+    __slots__: Incomplete
+    _accepted_numpy_types: tuple[
+        type[np.uint8],
+        type[np.uint16],
+        type[np.uint32],
+        type[np.uint64],
+        type[np.int8],
+        type[np.int16],
+        type[np.int32],
+        type[np.int64],
+    ]
+    values: NDArray[Any]
+    delta: bool
+    def __init__(self, values: NDArray[Any], *, delta: bool = False) -> None: ...
+    def __repr__(self) -> str: ...
+    @property
+    def signed(self) -> bool: ...
+    @property
+    def bits(self) -> NDArray[np.uint64]: ...
+    @property
+    def nbytes(self) -> int: ...
+    def from_bits(self, bits: NDArray[np.uint64]) -> VarintArray: ...
+
+_ARRAY_DTYPE: Incomplete
+_ARRAY_SHAPE: Incomplete
+
+class MessageLayout:
+    __slots__: Incomplete
+    nbytes: int
+    object_types: tuple[type[Any], ...]
+    field_types: tuple[type[Any], ...]
+    array_getter: Callable[[tuple[Any, ...]], tuple[Any, ...]] | None
+    array_dtypes: tuple[np.dtype[Any], ...]
+    array_shapes: tuple[tuple[int, ...], ...]
+    specifications: tuple[tuple[np.dtype[Any], tuple[int, ...], int, bool], ...]
+    getters: tuple[tuple[Callable[[Any], Any], int] | None, ...]
+    setters: tuple[tuple[tuple[Callable[[Any], Any] | None, str], ...] | None, ...]
+    has_dataclasses: bool
+    def __init__(self, *prototypes: Any) -> None: ...
+    def __repr__(self) -> str: ...
+    @staticmethod
+    def _resolve_paths(data_object: Any, prefix: str) -> list[str]: ...
+    def flatten(self, data_objects: tuple[Any, ...], operation: str) -> tuple[Any, ...]: ...
+    def unpack(
+        self, buffer: NDArray[np.uint8], start_index: int, data_objects: tuple[Any, ...], objects: tuple[Any, ...]
+    ) -> tuple[Any, ...]: ...
+
+@dataclass(frozen=True)
+class RealTimeReport:
+    cpu_core: int | None
+    fifo_priority: int | None
+    memory_locked: bool
+    gc_disabled: bool
+    packet_count: int
+    median_latency: float
+    p99_latency: float
+    p999_latency: float
+    maximum_latency: float
+
+@dataclass(frozen=True)
+class TransmissionReport:
+    packet_count: int
+    pending_count: int
+    failed_count: int
+    median_latency: float
+    p99_latency: float
+    p999_latency: float
+    maximum_latency: float
+    histogram: tuple[int, ...]
+    timestamps: NDArray[np.uint64]
+
+@dataclass(frozen=True)
+class MicrocontrollerCapabilities:
+    protocol_version: int
+    buffer_size: int
+    crc_byte_length: int
+    polynomial: int
+    initial_crc_value: int
+    final_crc_xor_value: int
+    framing_codecs: tuple[FramingCodec, ...]
+    features: MicrocontrollerFeature
+
+@dataclass(frozen=True)
+class BaudrateMeasurement:
+    baudrate: int
+    probe_count: int
+    error_count: int
+    error_rate: float
+    throughput: float
+
+@dataclass(frozen=True)
+class BaudrateProbeReport:
+    baudrate: int | None
+    measurements: tuple[BaudrateMeasurement, ...]
+
+class _RealTimeSession:
+    cpu_core: int | None
+    fifo_priority: int | None
+    memory_locked: bool
+    gc_disabled: bool
+    previous_affinity: set[int] | None
+    previous_policy: tuple[int, int] | None
+    latencies: NDArray[np.uint64]
+    packet_count: int
+    timer: PrecisionTimer
+    def __init__(self, latency_buffer_size: int = ...) -> None: ...
+    def __repr__(self) -> str: ...
+    def record(self, latency: int) -> None: ...
+    def report(self) -> RealTimeReport: ...
+
+class _TransmissionTracker:
+    timestamps: NDArray[np.uint64]
+    packet_count: int
+    failed_count: int
+    pending: deque[tuple[int, int, int]]
+    queued_bytes: int
+    wake: Event
+    stop: Event
+    thread: Thread | None
+    def __init__(self, latency_buffer_size: int = ...) -> None: ...
+    def __repr__(self) -> str: ...
+    def enqueue(self, packet_size: int) -> None: ...
+    def complete(self, drained_bytes: int) -> None: ...
+    def fail(self, handed_off_bytes: int) -> None: ...
+    def report(self) -> TransmissionReport: ...
+
+@dataclass(frozen=True)
+class _PacketPipeline:
+    construct_packet: Any
+    parse_packet: Any
+    process_packet: Any
+    verify_packet: Any
+
+_PIPELINE_CACHE: dict[tuple[int, ...], _PacketPipeline]
+_PIPELINE_LOCK: Lock
+
+def _build_packet_pipeline(
+    start_byte: int,
+    crc_processor: CRCProcessor,
+    max_payload_size: int,
+    min_payload_size: int,
+    postamble_size: int,
+    *,
+    check_delimiter: bool,
+) -> _PacketPipeline: ...
 
 class TransportLayer:
     _accepted_numpy_scalars: tuple[
@@ -50,25 +404,42 @@ class TransportLayer:
         type[np.float64],
         type[np.bool],
     ]
+    _accepted_scalar_types: frozenset[type[Any]]
+    _accepted_dtypes: frozenset[np.dtype[Any]]
     _opened: bool
+    _port_name: str
+    _baudrate: int
+    _serial_number: str | None
+    _port_lock: Lock
+    _connected: bool
+    _reconnections: int
+    _reconnection_timeout: int
+    _initial_backoff: int
+    _maximum_backoff: int
     _port: SerialMock | Serial
+    _poller: select.poll | None
     _crc_processor: Incomplete
-    _cobs_processor: Incomplete
-    _timer: Incomplete
+    _framing_processor: FramingProcessor
     _start_byte: np.uint8
     _delimiter_byte: np.uint8
     _timeout: int
     _postamble_size: np.uint8
+    _fec_processor: ReedSolomonProcessor | None
+    _lz_processor: LZProcessor | None
+    _delta_keyframe_interval: int
     _max_tx_payload_size: np.uint8
     _max_rx_payload_size: np.uint8
     _min_rx_payload_size: np.uint8
-    _transmission_buffer: NDArray[np.uint8]
-    _reception_buffer: NDArray[np.uint8]
+    _tx: _TransmissionPath
+    _rx: _ReceptionPath
     _minimum_packet_size: int
-    _bytes_in_transmission_buffer: int
-    _bytes_in_reception_buffer: int
-    _consumed_bytes: int
-    _leftover_bytes: bytes
+    _gil_free_reception: bool
+    _lazy_decoding: bool
+    _max_packet_size: int
+    _real_time_session: _RealTimeSession | None
+    _wait_strategy: WaitStrategy
+    _pipeline: _PacketPipeline | None
+    _capabilities: MicrocontrollerCapabilities | None
     def __init__(
         self,
         port: str,
@@ -79,12 +450,68 @@ class TransportLayer:
         final_crc_xor_value: CRCType = ...,
         *,
         test_mode: bool = False,
+        gil_free_reception: bool = False,
+        wait_strategy: WaitStrategy | None = None,
+        fec_parity_size: int = 0,
+        compression: bool = False,
+        delta_keyframe_interval: int = 0,
+        framing_codec: FramingCodec | str = ...,
+        specialized_pipeline: bool = False,
+        crc_preset: CRCPreset | str | None = None,
+        reception_slots: int = 1,
+        lazy_decoding: bool = False,
+        transmission_ring_size: int = 0,
     ) -> None: ...
+    def _configure(
+        self,
+        microcontroller_serial_buffer_size: int,
+        polynomial: CRCType = ...,
+        initial_crc_value: CRCType = ...,
+        final_crc_xor_value: CRCType = ...,
+        *,
+        test_mode: bool = False,
+        gil_free_reception: bool = False,
+        wait_strategy: WaitStrategy | None = None,
+        fec_parity_size: int = 0,
+        compression: bool = False,
+        delta_keyframe_interval: int = 0,
+        framing_codec: FramingCodec | str = ...,
+        specialized_pipeline: bool = False,
+        crc_preset: CRCPreset | str | None = None,
+        reception_slots: int = 1,
+        lazy_decoding: bool = False,
+        transmission_ring_size: int = 0,
+    ) -> None: ...
+    @classmethod
+    def negotiate(
+        cls,
+        port: str,
+        baudrate: int,
+        *,
+        timeout: int = 1000000,
+        compression: bool = False,
+        delta_keyframe_interval: int = 0,
+        fec_parity_size: int = 0,
+        **kwargs: Any,
+    ) -> TransportLayer: ...
+    def _request_capabilities(self, timeout: int) -> MicrocontrollerCapabilities: ...
+    def _exchange_handshake_message(
+        self, payload: NDArray[np.uint8], response_type: int, timeout: int
+    ) -> NDArray[np.uint8]: ...
+    def probe_baudrate(
+        self, candidates: Iterable[int], probe_count: int = ..., probe_size: int = 0, timeout: int = ...
+    ) -> BaudrateProbeReport: ...
+    def _exchange_echo_probe(self, probe: NDArray[np.uint8], timeout: int) -> bool: ...
+    def _set_baudrate(self, baudrate: int, timeout: int) -> None: ...
     def __del__(self) -> None: ...
     def __repr__(self) -> str: ...
     @property
     def available(self) -> bool: ...
     @property
+    def wait_strategy(self) -> WaitStrategy: ...
+    @property
+    def capabilities(self) -> MicrocontrollerCapabilities | None: ...
+    @property
     def transmission_buffer(self) -> NDArray[np.uint8]: ...
     @property
     def reception_buffer(self) -> NDArray[np.uint8]: ...
@@ -92,46 +519,184 @@ class TransportLayer:
     def bytes_in_transmission_buffer(self) -> int: ...
     @property
     def bytes_in_reception_buffer(self) -> int: ...
+    @property
+    def free_reception_slots(self) -> int: ...
+    @property
+    def transmitted_packets(self) -> int: ...
+    @property
+    def pending_transmission_bytes(self) -> int: ...
+    @property
+    def transmission_backlog(self) -> int: ...
+    @property
+    def transmission_throttled(self) -> bool: ...
+    @property
+    def received_packets(self) -> int: ...
+    @property
+    def reception_port_calls(self) -> int: ...
+    @property
+    def port_calls_per_packet(self) -> float: ...
+    @property
+    def connected(self) -> bool: ...
+    @property
+    def reconnections(self) -> int: ...
+    def start_real_time_session(
+        self,
+        cpu_core: int | None = None,
+        fifo_priority: int | None = None,
+        *,
+        lock_memory: bool = True,
+        disable_gc: bool = True,
+    ) -> None: ...
+    def stop_real_time_session(self) -> RealTimeReport: ...
+    def start_transmission_tracking(self) -> None: ...
+    def stop_transmission_tracking(self) -> TransmissionReport: ...
+    def _watch_transmission(self, tracker: _TransmissionTracker) -> None: ...
+    def _complete_drained_packets(self, tracker: _TransmissionTracker) -> None: ...
+    def set_reconnection_policy(self, timeout: int, initial_backoff: int = ..., maximum_backoff: int = ...) -> None: ...
+    def reconnect(self, port: str | None = None, timeout: int = 0) -> bool: ...
+    def _reconnect(self, port: str | None, timeout: int) -> bool: ...
+    def _reopen_port(self, port: str | None) -> bool: ...
+    def _register_poller(self) -> select.poll | None: ...
+    def _locate_port(self) -> str | None: ...
+    def _resolve_disconnection(self) -> None: ...
+    def _handle_disconnection(self, error: OSError, connection: int) -> None: ...
     def reset_transmission_buffer(self) -> None: ...
     def reset_reception_buffer(self) -> None: ...
+    def peek_payload(self) -> int: ...
+    def hold_payload(self) -> HeldPayload: ...
     def write_data(self, data_object: Any) -> None: ...
+    def _write_data(self, data_object: Any) -> None: ...
+    def write_many(self, *data_objects: Any, layout: MessageLayout | None = None) -> None: ...
+    def _flatten_objects(self, data_objects: tuple[Any, ...], operation: str) -> tuple[Any, ...]: ...
     @staticmethod
     def _write_scalar_data(target_buffer: NDArray[np.uint8], scalar_object: Any, start_index: int) -> int: ...
     @staticmethod
     def _write_array_data(target_buffer: NDArray[np.uint8], array_object: NDArray[Any], start_index: int) -> int: ...
+    @staticmethod
+    def _write_object_set(target_buffer: NDArray[np.uint8], start_index: int, *data_objects: Any) -> int: ...
+    @staticmethod
+    def _write_bit_field_data(
+        target_buffer: NDArray[np.uint8], values: NDArray[np.uint64], widths: NDArray[np.uint8], start_index: int
+    ) -> int: ...
+    @staticmethod
+    def _write_varint_data(
+        target_buffer: NDArray[np.uint8], bits: NDArray[np.uint64], signed: bool, delta: bool, start_index: int
+    ) -> int: ...
     def read_data(self, data_object: Any) -> Any: ...
+    def _read_data(self, data_object: Any) -> Any: ...
+    def read_many(self, *data_objects: Any, layout: MessageLayout | None = None) -> tuple[Any, ...]: ...
+    def _restore_objects(self, data_objects: tuple[Any, ...], arrays: Iterator[NDArray[Any]]) -> tuple[Any, ...]: ...
     @staticmethod
     def _read_array_data(
         source_buffer: NDArray[np.uint8], array_object: NDArray[Any], start_index: int, payload_size: int
-    ) -> tuple[NDArray[Any], int]: ...
+    ) -> int: ...
+    @staticmethod
+    def _read_array_set(
+        source_buffer: NDArray[np.uint8], start_index: int, payload_size: int, *arrays: NDArray[Any]
+    ) -> int: ...
+    @staticmethod
+    def _read_bit_field_data(
+        source_buffer: NDArray[np.uint8], widths: NDArray[np.uint8], start_index: int, payload_size: int
+    ) -> tuple[NDArray[np.uint64], int]: ...
+    @staticmethod
+    def _read_varint_data(
+        source_buffer: NDArray[np.uint8], count: int, signed: bool, delta: bool, start_index: int, payload_size: int
+    ) -> tuple[NDArray[np.uint64], int]: ...
     def send_data(self) -> None: ...
+    def _send_data(self) -> None: ...
+    def _transmit(self, data: NDArray[np.uint8]) -> None: ...
+    def _reserve_ring(self, size: int) -> None: ...
+    def _flush_ring(self) -> None: ...
+    def _write_port(self, data: NDArray[np.uint8]) -> int: ...
+    def _update_backpressure(self) -> None: ...
+    def flush_transmission(self, timeout: int = 0) -> bool: ...
+    def set_transmission_watermarks(
+        self,
+        high_watermark: int,
+        low_watermark: int,
+        on_high: Callable[[], None] | None = None,
+        on_low: Callable[[], None] | None = None,
+    ) -> None: ...
+    def _build_packet(self, payload_buffer: NDArray[np.uint8], payload_size: int) -> NDArray[np.uint8]: ...
+    def send_records(self, records: Any) -> int: ...
+    def _serialize_records(self, records: Any) -> NDArray[np.uint8]: ...
+    def _accepted_record(self, dtype: np.dtype[Any]) -> bool: ...
     @staticmethod
     def _construct_packet(
         payload_buffer: NDArray[np.uint8],
-        cobs_processor: _COBSProcessor,
+        framing_processor: _FramingProcessor,
         crc_processor: _CRCProcessor,
         payload_size: int,
         start_byte: np.uint8,
     ) -> NDArray[np.uint8]: ...
-    def receive_data(self) -> bool: ...
+    def receive_data(self, timeout: int = 0) -> bool: ...
+    def _receive_data(self) -> bool: ...
+    def _decode_pending_payload(self) -> None: ...
+    def _decompress_payload(self, payload_size: int) -> int: ...
+    def _encode_delta_frame(self, payload: NDArray[np.uint8]) -> NDArray[np.uint8]: ...
+    @staticmethod
+    def _encode_delta(
+        reference: NDArray[np.uint8], reference_size: int, payload: NDArray[np.uint8], target_buffer: NDArray[np.uint8]
+    ) -> int: ...
+    def _decode_delta_frame(self, payload_size: int) -> int: ...
+    @staticmethod
+    def _apply_delta(reference: NDArray[np.uint8], patches: NDArray[np.uint8], payload_size: int) -> int: ...
     def _receive_packet(self) -> bool: ...
+    def _receive_packet_gil_free(self) -> tuple[bool, int]: ...
+    def _reception_error_message(
+        self, status: int, parsed_bytes_count: int, packet_size: int, last_byte: int
+    ) -> str: ...
+    def _wait(self, waited: int, remaining: int) -> None: ...
     def _bytes_available(self, required_bytes_count: int = 1, timeout: int = 0) -> bool: ...
+    def _read_stream_bytes(self, size: int) -> int: ...
     @staticmethod
     def _parse_packet(
         unparsed_bytes: NDArray[np.uint8],
         start_byte: np.uint8,
-        delimiter_byte: np.uint8,
+        framing_processor: _FramingProcessor,
         max_payload_size: np.uint8,
         min_payload_size: np.uint8,
         postamble_size: np.uint8,
         start_found: bool = False,
         parsed_byte_count: int = 0,
         parsed_bytes: NDArray[np.uint8] = ...,
+        check_delimiter: bool = True,
     ) -> tuple[int, int, NDArray[np.uint8], NDArray[np.uint8]]: ...
     @staticmethod
     def _process_packet(
         reception_buffer: NDArray[np.uint8],
         packet_size: int,
-        cobs_processor: _COBSProcessor,
+        framing_processor: _FramingProcessor,
         crc_processor: _CRCProcessor,
     ) -> int: ...
+    @staticmethod
+    def _verify_packet(
+        reception_buffer: NDArray[np.uint8],
+        packet_size: int,
+        framing_processor: _FramingProcessor,
+        crc_processor: _CRCProcessor,
+    ) -> tuple[int, int]: ...
+    @staticmethod
+    def _decode_packet(
+        reception_buffer: NDArray[np.uint8],
+        encoded_size: int,
+        framing_processor: _FramingProcessor,
+    ) -> int: ...
+    @staticmethod
+    def _receive_packet_nogil(
+        descriptor: int,
+        stream_buffer: NDArray[np.uint8],
+        stream_size: int,
+        reception_buffer: NDArray[np.uint8],
+        start_byte: np.uint8,
+        max_payload_size: np.uint8,
+        min_payload_size: np.uint8,
+        postamble_size: np.uint8,
+        minimum_packet_size: int,
+        framing_processor: _FramingProcessor,
+        crc_processor: _CRCProcessor,
+        timeout: int,
+    ) -> tuple[int, int, int, int, int, int]: ...
+
+_parse_packet: Incomplete
+_process_packet: Incomplete
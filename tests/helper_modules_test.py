@@ -4,7 +4,15 @@ import numpy as np
 import pytest
 from ataraxis_base_utilities import error_format
 
-from ataraxis_transport_layer_pc import CRCProcessor, COBSProcessor
+from ataraxis_transport_layer_pc import (
+    CRCPreset,
+    LZProcessor,
+    CRCProcessor,
+    COBSProcessor,
+    COBSRProcessor,
+    ReedSolomonProcessor,
+    ByteStuffingProcessor,
+)
 from ataraxis_transport_layer_pc.helper_modules import SerialMock
 
 
@@ -46,6 +54,9 @@ def test_cobs_processor_encode_decode(input_buffer, encoded_buffer) -> None:
     decoded_payload = processor.decode_payload(encoded_packet)
     assert decoded_payload.tolist() == input_buffer.tolist()
 
+    # Tests extracting the first payload byte without decoding the packet
+    assert processor.peek_byte(encoded_packet) == input_buffer[0]
+
 
 def test_cobs_processor_repr() -> None:
     """Verifies the __repr__ method of the COBSProcessor class."""
@@ -115,6 +126,108 @@ def test_cobs_processor_decode_errors():
     with pytest.raises(ValueError, match=error_format(message)):
         _ = processor.decode_payload(corrupted_packet)
 
+    # Tests that packets that are too short to store a payload or start with a delimiter do not have a first payload
+    # byte.
+    for invalid_packet in ([2, 1], [0, 1, 0]):
+        assert processor.peek_byte(np.array(invalid_packet, dtype=np.uint8)) == -1
+
+
+@pytest.mark.parametrize(
+    "input_buffer,encoded_buffer",
+    [
+        # The last byte is not greater than the final length code, so the packet is not reduced
+        ([1, 2, 3, 4, 5], [6, 1, 2, 3, 4, 5, 0]),
+        # The last byte replaces the overhead byte
+        ([1, 2, 3, 4, 50], [50, 1, 2, 3, 4, 0]),
+        # The last byte replaces the length code of the final block
+        ([1, 2, 0, 4, 50], [3, 1, 2, 50, 4, 0]),
+        # The payload ends with a delimiter, so the packet is not reduced
+        ([1, 2, 0], [3, 1, 2, 1, 0]),
+        # Minimal payload size
+        ([7], [7, 0]),
+    ],
+)
+def test_cobsr_processor_encode_decode(input_buffer, encoded_buffer) -> None:
+    """Verifies the functioning of the COBSRProcessor's encode_payload() and decode_payload() methods."""
+    processor = COBSRProcessor()
+    payload = np.array(input_buffer, dtype=np.uint8)
+
+    encoded_packet = processor.encode_payload(payload)
+    assert encoded_packet.tolist() == encoded_buffer
+
+    decoded_payload = processor.decode_payload(encoded_packet)
+    assert decoded_payload.tolist() == input_buffer
+    assert processor.peek_byte(encoded_packet) == input_buffer[0]
+
+
+def test_cobsr_processor_errors() -> None:
+    """Verifies the __repr__ method and the error-handling behavior of the COBSRProcessor class."""
+    processor = COBSRProcessor()
+    assert repr(processor) == "COBSRProcessor(maximum_payload_size=254, minimum_payload_size=1, delimiter=0)"
+
+    message = (
+        "Failed to decode the payload using the COBS/R scheme. The packet is not terminated by the delimiter or "
+        "contains an unencoded delimiter. Packet is likely corrupted."
+    )
+    # An unencoded delimiter in place of a length code and a packet without the terminating delimiter.
+    for corrupted_packet in ([2, 1, 0, 3, 0], [6, 1, 2, 3, 4, 5]):
+        with pytest.raises(ValueError, match=error_format(message)):
+            processor.decode_payload(np.array(corrupted_packet, dtype=np.uint8))
+
+    # Packets that are too short to store a payload or start with a delimiter do not have a first payload byte.
+    for invalid_packet in ([0], [1, 0], [0, 5, 0]):
+        assert processor.peek_byte(np.array(invalid_packet, dtype=np.uint8)) == -1
+
+
+@pytest.mark.parametrize(
+    "scheme,input_buffer,encoded_buffer",
+    [
+        ("slip", [1, 2, 3], [1, 2, 3, 0xC0]),
+        ("slip", [1, 0xC0, 0xDB, 2], [1, 0xDB, 0xDC, 0xDB, 0xDD, 2, 0xC0]),
+        ("hdlc", [1, 2, 3], [1, 2, 3, 0x7E]),
+        ("hdlc", [1, 0x7E, 0x7D, 2], [1, 0x7D, 0x5E, 0x7D, 0x5D, 2, 0x7E]),
+    ],
+)
+def test_byte_stuffing_processor_encode_decode(scheme, input_buffer, encoded_buffer) -> None:
+    """Verifies the functioning of the ByteStuffingProcessor's encode_payload() and decode_payload() methods."""
+    processor = ByteStuffingProcessor(scheme=scheme)
+    assert processor.scheme == scheme
+    payload = np.array(input_buffer, dtype=np.uint8)
+
+    encoded_packet = processor.encode_payload(payload)
+    assert encoded_packet.tolist() == encoded_buffer
+
+    decoded_payload = processor.decode_payload(encoded_packet)
+    assert decoded_payload.tolist() == input_buffer
+    assert processor.peek_byte(encoded_packet) == input_buffer[0]
+
+
+def test_byte_stuffing_processor_errors() -> None:
+    """Verifies the __repr__ method and the error-handling behavior of the ByteStuffingProcessor class."""
+    message = (
+        "Unable to initialize ByteStuffingProcessor class. Expected one of the supported schemes (slip, hdlc) for "
+        "'scheme' argument, but encountered ppp of type str."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        ByteStuffingProcessor(scheme="ppp")
+
+    processor = ByteStuffingProcessor()
+    assert repr(processor) == "ByteStuffingProcessor(scheme=slip, delimiter=192, escape=219)"
+
+    message = (
+        "Failed to decode the payload using the SLIP scheme. The packet is not terminated by the delimiter or contains "
+        "an unencoded delimiter or an invalid escape sequence. Packet is likely corrupted."
+    )
+    # A packet without the terminating delimiter, an unencoded delimiter, an invalid escape sequence, and an
+    # unterminated escape sequence.
+    for corrupted_packet in ([1, 2], [1, 0xC0, 2, 0xC0], [1, 0xDB, 5, 0xC0], [1, 0xDB, 0xC0]):
+        with pytest.raises(ValueError, match=error_format(message)):
+            processor.decode_payload(np.array(corrupted_packet, dtype=np.uint8))
+
+    # Packets that start with the delimiter or an invalid escape sequence do not have a first payload byte.
+    for invalid_packet in ([0xC0], [0xDB, 5, 0xC0], [0xDB, 0xC0]):
+        assert processor.peek_byte(np.array(invalid_packet, dtype=np.uint8)) == -1
+
 
 def test_crc_processor_generate_table_crc_8():
     """Verifies the functioning of the CRCProcessor class generate_crc_table() method for CRC8 polynomials."""
@@ -1051,6 +1164,181 @@ def test_crc_processor_errors():
         crc_processor.calculate_checksum(buffer_with_checksum, check=True)
 
 
+@pytest.mark.parametrize(
+    "preset, check_value",
+    [
+        (CRCPreset.CRC_8_SMBUS, 0xF4),
+        (CRCPreset.CRC_8_AUTOSAR, 0xDF),
+        (CRCPreset.CRC_8_I_432_1, 0xA1),
+        (CRCPreset.CRC_8_NRSC_5, 0xF7),
+        (CRCPreset.CRC_16_IBM_3740, 0x29B1),
+        (CRCPreset.CRC_16_XMODEM, 0x31C3),
+        (CRCPreset.CRC_16_GENIBUS, 0xD64E),
+        (CRCPreset.CRC_16_UMTS, 0xFEE8),
+        (CRCPreset.CRC_16_CDMA2000, 0x4C06),
+        (CRCPreset.CRC_32_BZIP2, 0xFC891918),
+        (CRCPreset.CRC_32_MPEG_2, 0x0376E6E7),
+        (CRCPreset.CRC_32_CKSUM, 0x765E7680),
+        (CRCPreset.CRC_32_XFER, 0xBD0BE338),
+        (CRCPreset.CRC_32_AIXM, 0x3010BF7F),
+    ],
+)
+def test_crc_processor_presets(preset: CRCPreset, check_value: int) -> None:
+    """Verifies that each CRC preset produces the check value of its CRC RevEng catalogue entry and that the
+    checksums of all presets pass the verification.
+    """
+    crc_processor = CRCProcessor.from_preset(preset)
+    assert crc_processor is CRCProcessor.from_preset(preset.value)
+
+    # The check value is the checksum of the ASCII string '123456789'.
+    size = int(crc_processor.crc_byte_length)
+    buffer = np.zeros(9 + size, dtype=np.uint8)
+    buffer[:9] = np.frombuffer(b"123456789", dtype=np.uint8)
+    crc_processor.calculate_checksum(buffer, check=False)
+    assert np.array_equal(buffer[9:], np.frombuffer(check_value.to_bytes(size, byteorder="big"), dtype=np.uint8))
+    assert crc_processor.calculate_checksum(buffer, check=True) == 1
+
+
+def test_crc_processor_sharing() -> None:
+    """Verifies that the CRCProcessor instances with the same CRC parameters are interned and that all instances with
+    the same CRC width share the compiled jitclass.
+    """
+    processor = CRCProcessor.shared(np.uint16(0x1021), np.uint16(0xFFFF), np.uint16(0x0000))
+    assert processor is CRCProcessor.shared(np.uint16(0x1021), np.uint16(0xFFFF), np.uint16(0x0000))
+    assert processor is CRCProcessor.from_preset(CRCPreset.CRC_16_IBM_3740)
+
+    # Directly initialized instances are not interned, but reuse the jitclass compiled for their CRC width.
+    other = CRCProcessor(np.uint16(0x8005), np.uint16(0x0000), np.uint16(0x0000))
+    assert other is not CRCProcessor.from_preset(CRCPreset.CRC_16_UMTS)
+    assert type(other.processor) is type(processor.processor)
+    assert type(other.processor) is not type(CRCProcessor.from_preset(CRCPreset.CRC_8_SMBUS).processor)
+
+    message = (
+        f"Unable to resolve the CRC preset. Expected a CRCPreset member or one of its values "
+        f"({', '.join(CRCPreset)}) for 'preset' argument, but encountered crc-64 of type str."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        CRCProcessor.from_preset("crc-64")
+
+
+def test_reed_solomon_processor_encode() -> None:
+    """Verifies the parity bytes generated by the ReedSolomonProcessor class against a reference codeword."""
+    processor = ReedSolomonProcessor(parity_size=10)
+    assert repr(processor) == "ReedSolomonProcessor(parity_size=10)"
+    assert processor.parity_size == 10
+
+    data = np.frombuffer(b"hello world", dtype=np.uint8)
+    parity = processor.encode(data)
+    assert parity.tolist() == [0xED, 0x25, 0x54, 0xC4, 0xFD, 0xFD, 0x89, 0xF3, 0xA8, 0xAA]
+
+    # Intact codewords are not modified.
+    codeword = np.concatenate((data, parity))
+    assert processor.decode(codeword) == 0
+    assert codeword[: data.size].tobytes() == b"hello world"
+
+
+@pytest.mark.parametrize("parity_size", [2, 4, 8, 16])
+def test_reed_solomon_processor_decode(parity_size) -> None:
+    """Verifies that the ReedSolomonProcessor class corrects up to parity_size // 2 corrupted bytes at any position
+    of the codeword.
+    """
+    processor = ReedSolomonProcessor(parity_size=parity_size)
+    generator = np.random.default_rng(seed=parity_size)
+
+    for data_size in (1, 32, 255 - parity_size):
+        data = generator.integers(0, 256, size=data_size, dtype=np.uint8)
+        codeword = np.concatenate((data, processor.encode(data)))
+
+        # Corrupts the maximum correctable number of bytes, including the parity bytes.
+        corrupted = codeword.copy()
+        positions = generator.choice(codeword.size, size=min(parity_size // 2, codeword.size), replace=False)
+        corrupted[positions] ^= generator.integers(1, 256, size=positions.size, dtype=np.uint8)
+
+        assert processor.decode(corrupted) == positions.size
+        assert np.array_equal(corrupted, codeword)
+
+
+def test_reed_solomon_processor_errors() -> None:
+    """Verifies the error-handling behavior of the ReedSolomonProcessor class."""
+    for parity_size in (0, 65, 4.0):
+        message = (
+            f"Unable to initialize ReedSolomonProcessor class. Expected an integer value between 1 and 64 for "
+            f"'parity_size' argument, but encountered {parity_size} of type {type(parity_size).__name__}."
+        )
+        with pytest.raises(ValueError, match=error_format(message)):
+            # noinspection PyTypeChecker
+            ReedSolomonProcessor(parity_size=parity_size)
+
+    # Corrupts more bytes than the parity bytes can correct. The decoder has to either detect the failure or miscorrect
+    # the codeword, and the failed codewords have to be left unchanged.
+    processor = ReedSolomonProcessor(parity_size=4)
+    data = np.arange(1, 33, dtype=np.uint8)
+    codeword = np.concatenate((data, processor.encode(data)))
+    corrupted = codeword.copy()
+    corrupted[[0, 10, 20, 30, 35]] ^= np.uint8(0xFF)
+    message = (
+        "Reed-Solomon decoding: Failed. The codeword contains more corrupted bytes than 4 parity bytes can correct."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        processor.decode(corrupted)
+    assert corrupted[0] == codeword[0] ^ 0xFF
+
+
+def test_lz_processor() -> None:
+    """Verifies the compression and decompression methods of the LZProcessor class."""
+    processor = LZProcessor()
+    assert repr(processor) == "LZProcessor(maximum_size=254)"
+
+    # A repeated 4-byte value is stored as a 4-byte literal block followed by a single match with offset 4.
+    data = np.tile(np.array([1, 2, 3, 4], dtype=np.uint8), 4)
+    compressed = processor.compress(data)
+    assert compressed.tolist() == [3, 1, 2, 3, 4, 125 + 12, 4]
+    assert processor.decompress(compressed).tolist() == data.tolist()
+
+    # A run of identical bytes is stored as a 1-byte literal block followed by matches with offset 1, each copying at
+    # most 130 bytes.
+    data = np.zeros(200, dtype=np.uint8)
+    compressed = processor.compress(data)
+    assert compressed.tolist() == [0, 0, 125 + 130, 1, 125 + 69, 1]
+    assert processor.decompress(compressed).tolist() == data.tolist()
+
+    # Incompressible data grows by one byte per 128 bytes.
+    data = np.arange(254, dtype=np.uint8)
+    assert processor.compress(data).size == 256
+    assert processor.decompress(processor.compress(data)).tolist() == data.tolist()
+
+    # Verifies the round trip for mixed data.
+    generator = np.random.default_rng(seed=0)
+    for _ in range(20):
+        data = generator.integers(0, 4, size=254, dtype=np.uint8)
+        assert processor.decompress(processor.compress(data)).tolist() == data.tolist()
+
+
+def test_lz_processor_errors() -> None:
+    """Verifies the error-handling behavior of the LZProcessor class decompress() method."""
+    processor = LZProcessor(maximum_size=16)
+    message = (
+        "Failed to decompress the data using the LZ scheme. The data is malformed or decompresses into more than 16 "
+        "bytes."
+    )
+
+    # A literal block that is longer than the remaining data.
+    with pytest.raises(ValueError, match=error_format(message)):
+        processor.decompress(np.array([5, 1, 2], dtype=np.uint8))
+
+    # A match block without the offset byte.
+    with pytest.raises(ValueError, match=error_format(message)):
+        processor.decompress(np.array([0, 1, 128], dtype=np.uint8))
+
+    # A match block that references the data before the beginning of the decompressed data.
+    with pytest.raises(ValueError, match=error_format(message)):
+        processor.decompress(np.array([0, 1, 128, 2], dtype=np.uint8))
+
+    # A match block that exceeds the maximum decompressed size.
+    with pytest.raises(ValueError, match=error_format(message)):
+        processor.decompress(np.array([0, 1, 255, 1], dtype=np.uint8))
+
+
 def test_serial_mock():
     """Verifies the functioning and error-handling behavior of all SerialMock class methods."""
     # Creates an instance of SerialMock to test
@@ -1071,9 +1359,17 @@ def test_serial_mock():
 
     # Tests write() method
     mock_serial.open()
-    mock_serial.write(b"Hello")
+    assert mock_serial.write(b"Hello") == 5
     assert mock_serial.tx_buffer == b"Hello"
 
+    # Tests write() method with a bounded tx_buffer, which only accepts the bytes that fit into the buffer
+    mock_serial.tx_capacity = 7
+    assert mock_serial.write(b"World") == 2
+    assert mock_serial.tx_buffer == b"HelloWo"
+    assert mock_serial.write(b"!") == 0
+    mock_serial.tx_capacity = None
+    mock_serial.tx_buffer = b"Hello"
+
     # Tests write() method with non-bytes data (expecting TypeError)
     with pytest.raises(TypeError):
         # noinspection PyTypeChecker
@@ -1085,6 +1381,10 @@ def test_serial_mock():
     assert data == b"Wor"
     assert mock_serial.rx_buffer == b"ld"
 
+    # Tests feed() method
+    mock_serial.feed(b"!")
+    assert mock_serial.rx_buffer == b"ld!"
+
     # Tests reset_input_buffer() method
     mock_serial.reset_input_buffer()
     assert mock_serial.rx_buffer == b""
@@ -4,15 +4,49 @@ read_data(), send_data(), and receive_data(). You can also use this file if you
 class methods.
 """
 
+import gc
+import os
+import sys
+import contextlib
+from time import sleep, perf_counter
 from typing import Any
-from dataclasses import dataclass
+from threading import Thread
+from dataclasses import replace, dataclass
 
 import numpy as np
 import pytest
 from numpy.typing import NDArray
 from ataraxis_base_utilities import error_format
 
-from ataraxis_transport_layer_pc import TransportLayer
+from ataraxis_transport_layer_pc import (
+    BitField,
+    CRCPreset,
+    VarintArray,
+    FramingCodec,
+    WaitStrategy,
+    MessageLayout,
+    TransportLayer,
+    TransportLayerStatus,
+    MicrocontrollerFeature,
+    find_port,
+    list_available_ports,
+)
+from ataraxis_transport_layer_pc.transport_layer import _find_serial_number
+
+
+@dataclass
+class SampleBitFieldClass:
+    """A simple dataclass used to test the serialization of BitField attributes by the TransportLayer class.
+
+    Attributes:
+        channels: The bit-packed boolean array that represents the states of digital input channels.
+        status: The sub-byte fields of a status register.
+        counter: Any numpy scalar value written after the bit fields.
+    """
+
+    channels: BitField
+    status: BitField
+    counter: np.uint16
 
 
 @dataclass
@@ -30,6 +64,20 @@ class SampleDataClass:
     uint_array: np.ndarray
 
 
+@dataclass
+class SampleNestedDataClass:
+    """A dataclass that stores another dataclass. Used to test the serialization of nested dataclasses by the
+    MessageLayout class.
+
+    Attributes:
+        header: Any numpy scalar value stored before the nested dataclass.
+        sample: The nested dataclass.
+    """
+
+    header: np.uint16
+    sample: SampleDataClass
+
+
 @pytest.fixture()
 def protocol() -> TransportLayer:
     """Returns a TransportLayer instance with test mode enabled.
@@ -95,6 +143,122 @@ def test_init_errors() -> None:
         # noinspection PyTypeChecker
         TransportLayer(port="COM7", microcontroller_serial_buffer_size=None, baudrate=1000000)
 
+    # GIL-free reception engine requested for the mocked serial port
+    message = (
+        f"Unable to initialize TransportLayer class. The GIL-free reception engine requires a real serial "
+        f"port on a Linux or macOS system, but test_mode is {True} and the platform is {sys.platform}."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer(
+            port="COM7",
+            microcontroller_serial_buffer_size=64,
+            baudrate=1000000,
+            test_mode=True,
+            gil_free_reception=True,
+        )
+
+    # Invalid wait_strategy argument
+    message = (
+        f"Unable to initialize TransportLayer class. Expected a WaitStrategy instance or None for 'wait_strategy' "
+        f"argument, but encountered {'spin'} of type {str.__name__}."
+    )
+    with pytest.raises(TypeError, match=error_format(message)):
+        # noinspection PyTypeChecker
+        TransportLayer(
+            port="COM7", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True, wait_strategy="spin"
+        )
+
+    # Invalid fec_parity_size argument
+    message = (
+        f"Unable to initialize ReedSolomonProcessor class. Expected an integer value between 1 and 64 for "
+        f"'parity_size' argument, but encountered {-2} of type {int.__name__}."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer(
+            port="COM7", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True, fec_parity_size=-2
+        )
+
+    # Forward error correction requested together with the GIL-free reception engine. The error is raised before the
+    # instance attempts to connect to the (non-existent) port.
+    if sys.platform != "win32":
+        message = (
+            f"Unable to initialize TransportLayer class. Forward error correction cannot be used together with "
+            f"the GIL-free reception engine, but fec_parity_size is {8} and gil_free_reception is {True}."
+        )
+        with pytest.raises(ValueError, match=error_format(message)):
+            TransportLayer(
+                port="/dev/ttyNONE",
+                microcontroller_serial_buffer_size=64,
+                baudrate=1000000,
+                gil_free_reception=True,
+                fec_parity_size=8,
+            )
+
+    # Invalid delta_keyframe_interval argument
+    message = (
+        f"Unable to initialize TransportLayer class. Expected a non-negative integer value for "
+        f"'delta_keyframe_interval' argument, but encountered {-1} of type {int.__name__}."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer(
+            port="COM7",
+            microcontroller_serial_buffer_size=64,
+            baudrate=1000000,
+            test_mode=True,
+            delta_keyframe_interval=-1,
+        )
+
+    # Invalid framing_codec argument
+    message = (
+        f"Unable to initialize TransportLayer class. Expected a FramingCodec member or one of its values "
+        f"(cobs, cobs_r, slip, hdlc) for 'framing_codec' argument, but encountered ppp of type str."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer(
+            port="COM7", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True, framing_codec="ppp"
+        )
+
+    # Forward error correction requested together with a variable-size framing codec
+    message = (
+        f"Unable to initialize TransportLayer class. Forward error correction can only be used together with the "
+        f"COBS framing codec, but fec_parity_size is {8} and framing_codec is slip."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer(
+            port="COM7",
+            microcontroller_serial_buffer_size=64,
+            baudrate=1000000,
+            test_mode=True,
+            fec_parity_size=8,
+            framing_codec=FramingCodec.SLIP,
+        )
+
+    # Invalid reception_slots argument
+    message = (
+        f"Unable to initialize TransportLayer class. Expected a positive integer value for 'reception_slots' "
+        f"argument, but encountered {0} of type {int.__name__}."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer(
+            port="COM7", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True, reception_slots=0
+        )
+
+    # Lazy decoding combined with compression
+    message = (
+        f"Unable to initialize TransportLayer class. Lazy decoding cannot be used together with compression, delta "
+        f"transmission, or the GIL-free reception engine, but compression is {True}, delta_keyframe_interval is {0}, "
+        f"and gil_free_reception is {False}."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer(
+            port="COM7",
+            microcontroller_serial_buffer_size=64,
+            baudrate=1000000,
+            test_mode=True,
+            compression=True,
+            lazy_decoding=True,
+        )
+
 
 @pytest.mark.parametrize(
     "data, expected_buffer",
@@ -323,7 +487,7 @@ def test_receive_bytes_available(protocol) -> None:
     preamble = np.array([129, 10], dtype=np.uint8)
 
     # Encodes with COBS
-    packet = protocol._cobs_processor.encode_payload(test_payload)
+    packet = protocol._framing_processor.encode_payload(test_payload)
 
     # Adds CRC checksum
     packet_with_crc = np.empty(len(packet) + protocol._crc_processor.crc_byte_length, dtype=np.uint8)
@@ -337,25 +501,41 @@ def test_receive_bytes_available(protocol) -> None:
     chunk_1 = test_data[:8]
     chunk_2 = test_data[8:16]
 
-    # Verifies that TransportLayer correctly combines data 'leftover' from previous data reception with new data that
-    # became available before the most recent read_data call().
-    protocol._leftover_bytes = chunk_1.tobytes()
+    # Verifies that TransportLayer correctly combines the stream bytes left over from previous data reception with new
+    # data that became available before the most recent read_data call().
+    protocol._rx.append_stream_bytes(chunk_1.tobytes())
     protocol._port.rx_buffer = chunk_2.tobytes()
     protocol.receive_data()
 
-    # Verifies that TransportLayer can receive the data entirely from 'leftover' bytes.
-    protocol._leftover_bytes = test_data.tobytes()
+    # Verifies that TransportLayer can receive the data entirely from the stream buffer bytes.
+    protocol._rx.append_stream_bytes(test_data.tobytes())
     protocol.receive_data()
 
     # Also verifies that receive_data() correctly returns without errors if no bytes are available for reception
     assert not protocol.receive_data()
 
+    # Verifies that TransportLayer can receive a packet whose bytes arrive in multiple chunks while the packet is being
+    # parsed. The second chunk is delivered by a separate thread once the first chunk is consumed. The chunk is
+    # delivered through the feed() method, which is safe to use while the other thread reads the port.
+    def deliver_chunk() -> None:
+        """Simulates the serial port receiving the second chunk of the packet."""
+        while protocol._port.in_waiting:
+            sleep(0)
+        protocol._port.feed(chunk_2.tobytes())
+
+    protocol._port.rx_buffer = chunk_1.tobytes()
+    delivery = Thread(target=deliver_chunk)
+    delivery.start()
+    assert protocol.receive_data()
+    delivery.join()
+    assert np.array_equal(protocol.read_data(np.zeros_like(test_payload)), test_payload)
+
 
 def test_read_data_errors(protocol) -> None:
     """Verifies the error handling behavior of TransportLayer read_data() method"""
     # Sets the received bytes tracker to 5. The instance interprets this as meaning that it has 5 bytes available for
     # reading inside the reception buffer. This is necessary to trigger the error cases below.
-    protocol._bytes_in_reception_buffer = 5
+    protocol._rx.bytes_in_buffer = 5
 
     # Unsupported prototype
     unsupported_data_object = "unsupported_type"
@@ -379,24 +559,13 @@ def test_read_data_errors(protocol) -> None:
         # noinspection PyTypeChecker
         protocol.read_data(empty_array)
 
-    # Multidimensional NdArray input.
-    multidimensional_array = np.empty([2, 2], dtype=np.uint8)
-    message = (
-        f"Failed to read the data from the reception buffer. Encountered a multidimensional numpy array with "
-        f"{multidimensional_array.ndim} dimensions as input data_object. At this time, only "
-        f"one-dimensional (flat) arrays are supported."
-    )
-    with pytest.raises(ValueError, match=error_format(message)):
-        # noinspection PyTypeChecker
-        protocol.read_data(multidimensional_array)
-
     # Prototype needs more data than available for reading
     large_array = np.empty(shape=300, dtype=np.uint8)
     message = (
         f"Failed to read the data from the reception buffer. The reception buffer does not have enough "
         f"unconsumed bytes to recreate the object. Specifically, the object requires {large_array.nbytes} "
-        f"bytes, but the available payload size is {protocol.bytes_in_reception_buffer - protocol._consumed_bytes} "
-        f"bytes."
+        f"bytes, but the available payload size is "
+        f"{protocol.bytes_in_reception_buffer - protocol._rx.consumed_bytes} bytes."
     )
     with pytest.raises(ValueError, match=error_format(message)):
         # noinspection PyTypeChecker
@@ -432,16 +601,6 @@ def test_write_data_errors(protocol) -> None:
         # noinspection PyTypeChecker
         protocol.write_data(test_dataclass)
 
-    # Multidimensional NdArray input.
-    message = (
-        "Failed to write the data to the transmission buffer. Encountered a multidimensional numpy array with 2 "
-        "dimensions as input data_object. At this time, only one-dimensional (flat) arrays are supported."
-    )
-    invalid_array: np.ndarray = np.zeros((2, 2), dtype=np.uint8)
-    with pytest.raises(ValueError, match=error_format(message)):
-        # noinspection PyTypeChecker
-        protocol.write_data(invalid_array)
-
     # An object whose size exceeds the available transmission buffer space.
     large_data = np.empty(300, dtype=np.uint8)
     # 1 below is due to a partial success of the dataclass writing (uint8 scalar is written). During real-world usage,
@@ -450,13 +609,559 @@ def test_write_data_errors(protocol) -> None:
         f"Failed to write the data to the transmission buffer. The transmission buffer does not have enough "
         f"space to write the data starting at the index {1}. Specifically, given the data size of "
         f"{large_data.nbytes} bytes, the required buffer size is {1 + large_data.nbytes} bytes, but the available "
-        f"size is {protocol._transmission_buffer.size} bytes."
+        f"size is {protocol._tx.buffer.size} bytes."
     )
     with pytest.raises(ValueError, match=error_format(message)):
         # noinspection PyTypeChecker
         protocol.write_data(large_data)
 
 
+def test_multidimensional_array_transmission_cycle(protocol) -> None:
+    """Verifies that the TransportLayer class writes and reads multidimensional and non-contiguous arrays in the C
+    (row-major) order without requiring contiguous copies.
+    """
+    image = np.arange(24, dtype=np.uint16).reshape(4, 6)
+    arrays = [
+        image,  # C-contiguous
+        image[1:3, ::2],  # Strided patch
+        image.T,  # Transposed (Fortran-contiguous)
+        np.arange(8, dtype=np.float32)[::-3],  # Reversed and strided
+        np.array(5, dtype=np.int32),  # Zero-dimensional
+    ]
+    for array in arrays:
+        protocol.write_data(array)
+    expected = b"".join(np.ascontiguousarray(array).tobytes() for array in arrays)
+    assert protocol.transmission_buffer[: protocol.bytes_in_transmission_buffer].tobytes() == expected
+
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+
+    # Writeable prototypes are filled in place, regardless of their memory layout.
+    prototype = np.zeros((4, 6), dtype=np.uint16)
+    assert protocol.read_data(prototype) is prototype
+    assert np.array_equal(prototype, image)
+    storage = np.zeros((2, 6), dtype=np.uint16)
+    prototype = storage[:, ::2]
+    assert protocol.read_data(prototype) is prototype
+    assert np.array_equal(storage[:, ::2], image[1:3, ::2])
+    assert np.array_equal(protocol.read_data(np.zeros((6, 4), dtype=np.uint16, order="F")), image.T)
+
+    # Read-only prototypes are not modified, so their data is read into a new array.
+    prototype = np.zeros(3, dtype=np.float32)
+    prototype.flags.writeable = False
+    received = protocol.read_data(prototype)
+    assert received is not prototype
+    assert np.array_equal(received, np.arange(8, dtype=np.float32)[::-3])
+    assert not prototype.any()
+    assert protocol.read_data(np.zeros((), dtype=np.int32)) == 5
+
+
+def test_scatter_gather_transmission_cycle(protocol) -> None:
+    """Verifies that the write_many() and read_many() methods produce the same payload as the equivalent sequences of
+    write_data() and read_data() calls.
+    """
+    image = np.arange(12, dtype=np.int16).reshape(3, 4)
+    test_dataclass = SampleDataClass(uint_value=np.uint32(7), uint_array=np.array([1, 2, 3], dtype=np.uint8))
+    objects = (
+        np.uint8(5),
+        np.float64(1.5),
+        image[:, ::2],  # Non-contiguous
+        test_dataclass,
+        np.bool_(True),
+        np.array([-1, 2], dtype=np.int64),
+    )
+    for data_object in objects:
+        protocol.write_data(data_object)
+    expected = protocol.transmission_buffer[: protocol.bytes_in_transmission_buffer].tobytes()
+    protocol.reset_transmission_buffer()
+
+    protocol.write_many(*objects)
+    assert protocol.transmission_buffer[: protocol.bytes_in_transmission_buffer].tobytes() == expected
+    protocol.write_many()  # Writing no objects does not modify the buffer.
+    assert protocol.bytes_in_transmission_buffer == len(expected)
+
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+
+    # Writeable prototypes and dataclasses are filled in place. Scalars are returned as numpy scalars.
+    patch = np.zeros((3, 2), dtype=np.int16)
+    read_dataclass = SampleDataClass(uint_value=np.uint32(0), uint_array=np.zeros(3, dtype=np.uint8))
+    read_only = np.zeros(2, dtype=np.int64)
+    read_only.flags.writeable = False
+    received = protocol.read_many(np.uint8(0), np.float64(0), patch, read_dataclass, np.bool_(False), read_only)
+    assert received[0] == 5 and isinstance(received[0], np.uint8)
+    assert received[1] == 1.5 and isinstance(received[1], np.float64)
+    assert received[2] is patch
+    assert np.array_equal(patch, image[:, ::2])
+    assert received[3] is read_dataclass
+    assert read_dataclass.uint_value == 7 and isinstance(read_dataclass.uint_value, np.uint32)
+    assert np.array_equal(read_dataclass.uint_array, [1, 2, 3])
+    assert received[4]
+    assert received[5] is not read_only
+    assert np.array_equal(received[5], [-1, 2])
+    assert protocol.read_many() == ()
+    assert protocol._rx.consumed_bytes == len(expected)
+
+
+def test_scatter_gather_errors(protocol) -> None:
+    """Verifies the error handling behavior of the TransportLayer write_many() and read_many() methods and that failed
+    calls do not modify the buffers.
+    """
+    bit_field = BitField(values=np.array([1, 0], dtype=np.uint8))
+    for operation, direction, buffer_name, method in (
+        ("write", "to", "transmission", protocol.write_many),
+        ("read", "from", "reception", protocol.read_many),
+    ):
+        message = (
+            f"Failed to {operation} the data {direction} the {buffer_name} buffer. Encountered an unsupported input "
+            f"data_object type ({type(bit_field).__name__}). The {operation}_many() method only supports the "
+            f"following numpy scalar or array types: {protocol._accepted_numpy_scalars}, and dataclasses with all "
+            f"attributes set to supported numpy scalar or array types. Use the {operation}_data() method to "
+            f"{operation} BitField and VarintArray objects."
+        )
+        with pytest.raises(TypeError, match=error_format(message)):
+            method(np.uint8(1), bit_field)
+
+    # Empty arrays and oversized writes are detected before any data is written.
+    message = (
+        "Failed to write the data to the transmission buffer. Encountered an empty (size 0) numpy array as input "
+        "data_object. Writing empty arrays is not supported."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.write_many(np.uint8(1), np.empty(0, dtype=np.uint8))
+    large_data = np.empty(protocol._tx.buffer.size, dtype=np.uint8)
+    message = (
+        f"Failed to write the data to the transmission buffer. The transmission buffer does not have enough space to "
+        f"write the data starting at the index {0}. Specifically, given the data size of {large_data.nbytes + 2} "
+        f"bytes, the required buffer size is {large_data.nbytes + 2} bytes, but the available size is "
+        f"{protocol._tx.buffer.size} bytes."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.write_many(np.uint16(1), large_data)
+    assert protocol.bytes_in_transmission_buffer == 0
+
+    # Reads that exceed the received payload do not consume any bytes.
+    protocol.write_many(np.uint32(1), np.uint8(2))
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+    message = (
+        f"Failed to read the data from the reception buffer. The reception buffer does not have enough unconsumed "
+        f"bytes to recreate the objects. Specifically, the objects require {6} bytes, but the available payload size "
+        f"is {5} bytes."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.read_many(np.uint32(0), np.uint16(0))
+    message = (
+        "Failed to read the data from the reception buffer. Encountered an empty (size 0) numpy array as input "
+        "data_object. Reading empty arrays is not supported."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.read_many(np.uint32(0), np.empty(0, dtype=np.uint8))
+    assert protocol._rx.consumed_bytes == 0
+    assert protocol.read_many(np.uint32(0), np.uint8(0)) == (1, 2)
+
+
+def test_message_layout_transmission_cycle(protocol) -> None:
+    """Verifies that the write_many() and read_many() methods produce the same payload and objects with and without
+    the MessageLayout instance that describes the message.
+    """
+    image = np.arange(12, dtype=np.int16).reshape(3, 4)
+    nested = SampleNestedDataClass(
+        header=np.uint16(9), sample=SampleDataClass(uint_value=np.uint32(7), uint_array=np.array([1, 2, 3], np.uint8))
+    )
+    objects = (np.uint8(5), image, nested, np.bool_(True), np.array([-1, 2], dtype=np.int64))
+    layout = MessageLayout(*objects)
+    assert layout.nbytes == 1 + 24 + 2 + 4 + 3 + 1 + 16
+    assert repr(layout) == f"MessageLayout(field_count=7, nbytes={layout.nbytes})"
+
+    protocol.write_many(*objects)
+    expected = protocol.transmission_buffer[: protocol.bytes_in_transmission_buffer].tobytes()
+    protocol.reset_transmission_buffer()
+    protocol.write_many(*objects, layout=layout)
+    assert protocol.transmission_buffer[: protocol.bytes_in_transmission_buffer].tobytes() == expected
+
+    # Messages with non-contiguous arrays are copied by the compiled pass.
+    protocol.reset_transmission_buffer()
+    protocol.write_many(np.uint8(5), np.ascontiguousarray(image.T).T, *objects[2:], layout=MessageLayout(*objects))
+    assert protocol.transmission_buffer[: protocol.bytes_in_transmission_buffer].tobytes() == expected
+
+    protocol.write_many(*objects, layout=layout)
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+
+    # Writeable prototypes and dataclasses are filled in place. Read-only prototypes are replaced with new arrays.
+    patch = np.zeros((3, 4), dtype=np.int16)
+    read_nested = SampleNestedDataClass(
+        header=np.uint16(0), sample=SampleDataClass(uint_value=np.uint32(0), uint_array=np.zeros(3, np.uint8))
+    )
+    read_only = np.zeros(2, dtype=np.int64)
+    read_only.flags.writeable = False
+    prototypes = (np.uint8(0), patch, read_nested, np.bool_(False), read_only)
+    for _ in range(2):
+        received = protocol.read_many(*prototypes, layout=layout)
+        assert received[0] == 5 and isinstance(received[0], np.uint8)
+        assert received[1] is patch
+        assert np.array_equal(patch, image)
+        assert received[2] is read_nested
+        assert read_nested.header == 9 and isinstance(read_nested.header, np.uint16)
+        assert read_nested.sample.uint_value == 7 and isinstance(read_nested.sample.uint_value, np.uint32)
+        assert np.array_equal(read_nested.sample.uint_array, [1, 2, 3])
+        assert received[3] and isinstance(received[3], np.bool_)
+        assert received[4] is not read_only
+        assert np.array_equal(received[4], [-1, 2])
+        assert not read_only.any()
+    assert protocol._rx.consumed_bytes == 2 * layout.nbytes
+
+
+def test_message_layout_errors(protocol) -> None:
+    """Verifies the error handling behavior of the MessageLayout class and that the write_many() and read_many()
+    methods do not modify the buffers when the objects do not match the layout.
+    """
+    message = "Unable to initialize MessageLayout class. Expected at least one prototype, but encountered none."
+    with pytest.raises(ValueError, match=error_format(message)):
+        MessageLayout()
+    message = (
+        "Unable to initialize MessageLayout class. Encountered an empty (size 0) numpy array as one of the prototypes. "
+        "Empty arrays are not supported."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        MessageLayout(np.uint8(1), np.empty(0, dtype=np.uint8))
+    for prototype in (BitField(values=np.array([1, 0], dtype=np.uint8)), np.float16(1), 5):
+        message = (
+            f"Unable to initialize MessageLayout class. Encountered an unsupported prototype type "
+            f"({type(prototype).__name__}). The layout only supports the following numpy scalar or array types: "
+            f"{protocol._accepted_numpy_scalars}, and dataclasses with all attributes set to supported numpy scalar or "
+            f"array types."
+        )
+        with pytest.raises(TypeError, match=error_format(message)):
+            MessageLayout(np.uint8(1), prototype)
+
+    layout = MessageLayout(np.uint32(1), np.zeros(3, dtype=np.uint16))
+    for objects in (
+        (np.uint16(1), np.zeros(3, dtype=np.uint16)),  # Scalar type
+        (np.uint32(1), np.zeros(3, dtype=np.int16)),  # Array datatype
+        (np.uint32(1), np.zeros(4, dtype=np.uint16)),  # Array shape
+        (np.uint32(1),),  # Object count
+        (np.uint32(1), SampleDataClass(uint_value=np.uint32(1), uint_array=np.zeros(3, dtype=np.uint16))),
+    ):
+        for operation, method in (("write", protocol.write_many), ("read", protocol.read_many)):
+            message = (
+                f"Failed to {operation} the data using the MessageLayout. The input objects do not match the layout: "
+                f"the message's objects have to use the same types as the layout's prototypes, and the message's "
+                f"arrays have to use the same datatypes and shapes as the prototype arrays. Layout: {layout}."
+            )
+            with pytest.raises(TypeError, match=error_format(message)):
+                method(*objects, layout=layout)
+    assert protocol.bytes_in_transmission_buffer == 0
+
+    # Oversized writes and reads are reported without modifying the buffers.
+    large_layout = MessageLayout(np.uint16(1), np.empty(protocol._tx.buffer.size, dtype=np.uint8))
+    message = (
+        f"Failed to write the data to the transmission buffer. The transmission buffer does not have enough space to "
+        f"write the data starting at the index {0}. Specifically, given the data size of {large_layout.nbytes} "
+        f"bytes, the required buffer size is {large_layout.nbytes} bytes, but the available size is "
+        f"{protocol._tx.buffer.size} bytes."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.write_many(np.uint16(1), np.empty(protocol._tx.buffer.size, dtype=np.uint8), layout=large_layout)
+    assert protocol.bytes_in_transmission_buffer == 0
+
+    protocol.write_many(np.uint32(1), np.uint8(2))
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+    message = (
+        f"Failed to read the data from the reception buffer. The reception buffer does not have enough unconsumed "
+        f"bytes to recreate the objects. Specifically, the objects require {6} bytes, but the available payload size "
+        f"is {5} bytes."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.read_many(np.uint32(0), np.uint16(0), layout=MessageLayout(np.uint32(0), np.uint16(0)))
+    assert protocol._rx.consumed_bytes == 0
+    assert protocol.read_many(np.uint32(0), np.uint8(0), layout=MessageLayout(np.uint32(0), np.uint8(0))) == (1, 2)
+
+
+def test_send_records(protocol) -> None:
+    """Verifies that the send_records() method packs whole records into the fewest payloads and produces the same
+    packets as writing and sending the same batches of records with the write_data() and send_data() methods.
+    """
+    dtype = np.dtype([("trial", np.uint16), ("delay", np.float32), ("targets", np.uint8, (3,))])
+    records = np.zeros(100, dtype=dtype)
+    records["trial"] = np.arange(100)
+    records["delay"] = np.linspace(0, 1, 100)
+    records["targets"] = np.arange(300).reshape(100, 3) % 256
+
+    # Each 9-byte record is written as the consecutive data of its fields. The 254-byte payloads store 28 records.
+    records_per_packet = int(protocol._max_tx_payload_size) // dtype.itemsize
+    assert records_per_packet == 28
+    for start in range(0, records.size, records_per_packet):
+        protocol.write_data(records[start : start + records_per_packet].view(np.uint8))
+        protocol.send_data()
+    expected = protocol._port.tx_buffer
+    protocol._port.tx_buffer = b""
+
+    # Data staged in the transmission buffer is not affected by sending the records.
+    protocol.write_data(np.uint8(1))
+    assert protocol.send_records(records) == 100
+    assert protocol._port.tx_buffer == expected
+    assert protocol.transmitted_packets == 8
+    assert protocol.bytes_in_transmission_buffer == 1
+    protocol.reset_transmission_buffer()
+
+    # Aligned (padded) datatypes are repacked, and sequences of dataclasses produce the same packets as the equivalent
+    # structured array.
+    protocol._port.tx_buffer = b""
+    aligned = np.zeros(records.size, dtype=np.dtype(dtype.descr, align=True))
+    for name in dtype.names:
+        aligned[name] = records[name]
+    assert aligned.dtype.itemsize > dtype.itemsize
+    assert protocol.send_records(aligned) == 100
+    assert protocol._port.tx_buffer == expected
+
+    protocol._port.tx_buffer = b""
+    trial_records = [
+        SampleDataClass(uint_value=np.uint16(value), uint_array=np.array([value % 256], dtype=np.uint8))
+        for value in range(60)
+    ]
+    assert protocol.send_records(trial_records) == 60
+    expected_records = np.zeros(60, dtype=[("value", np.uint16), ("array", np.uint8, (1,))])
+    expected_records["value"] = np.arange(60)
+    expected_records["array"][:, 0] = np.arange(60)
+    packets = protocol._port.tx_buffer
+    protocol._port.tx_buffer = b""
+    assert protocol.send_records(expected_records) == 60
+    assert protocol._port.tx_buffer == packets
+
+    # The receiver reads whole records from each packet.
+    protocol._port.rx_buffer = expected
+    assert protocol.receive_data()
+    assert protocol.bytes_in_reception_buffer == records_per_packet * dtype.itemsize
+    received = protocol.read_data(np.zeros(records_per_packet * dtype.itemsize, dtype=np.uint8))
+    assert np.array_equal(received.view(dtype), records[:records_per_packet])
+
+    assert protocol.send_records([]) == 0
+    assert protocol.send_records(records[:0]) == 0
+
+
+def test_send_records_errors(protocol) -> None:
+    """Verifies the error handling behavior of the TransportLayer send_records() method."""
+    for invalid_records in ([1, 2], np.arange(4), np.zeros(2, dtype=[("value", np.complex64)])):
+        datatype = f" with the datatype {invalid_records.dtype}" if isinstance(invalid_records, np.ndarray) else ""
+        message = (
+            f"Unable to send the records. Expected a numpy structured array whose fields use the following numpy "
+            f"types: {protocol._accepted_numpy_scalars}, or a sequence of dataclasses with all attributes set to "
+            f"supported numpy scalar or array types, but encountered an object of type "
+            f"{type(invalid_records).__name__}{datatype}."
+        )
+        with pytest.raises(TypeError, match=error_format(message)):
+            protocol.send_records(invalid_records)
+
+    record = SampleDataClass(uint_value=np.uint8(1), uint_array=np.zeros(2, dtype=np.uint8))
+    message = (
+        f"Unable to send the records. All records have to be instances of the same dataclass "
+        f"({type(record).__name__}), but encountered a record of type {type(np.uint8(1)).__name__}."
+    )
+    with pytest.raises(TypeError, match=error_format(message)):
+        protocol.send_records([record, np.uint8(1)])
+
+    message = (
+        f"Unable to send the records. Each record has to contain between 1 and {protocol._max_tx_payload_size} bytes "
+        f"to fit into a transmitted payload, but encountered records of {300} bytes."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.send_records(np.zeros(2, dtype=[("samples", np.uint8, (300,))]))
+    assert protocol._port.tx_buffer == b""
+
+
+def test_bit_field_transmission_cycle(protocol) -> None:
+    """Verifies that BitField instances are serialized as bit-packed data blocks, both directly and as dataclass
+    fields.
+    """
+    # 12 boolean values use 2 bytes. The first value is stored in the least significant bit of the first byte.
+    channels = np.zeros(12, dtype=np.bool)
+    channels[[0, 3, 8, 11]] = True
+    protocol.write_data(BitField(channels))
+    assert protocol.bytes_in_transmission_buffer == 2
+    assert protocol.transmission_buffer[:2].tolist() == [0b00001001, 0b00001001]
+
+    # The fields of different widths are packed consecutively and can cross the byte boundaries: 3 + 5 + 6 + 2 bits.
+    status = BitField(np.array([5, 17, 42, 3], dtype=np.uint8), widths=(3, 5, 6, 2))
+    protocol.write_data(status)
+    assert protocol.bytes_in_transmission_buffer == 4
+    assert protocol.transmission_buffer[2:4].tolist() == [5 | (17 << 3), 42 | (3 << 6)]
+
+    # Writes the same data as a dataclass and verifies that it is received intact.
+    protocol.reset_transmission_buffer()
+    test_object = SampleBitFieldClass(channels=BitField(channels), status=status, counter=np.uint16(513))
+    protocol.write_data(test_object)
+    assert protocol.bytes_in_transmission_buffer == 6
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+
+    prototype = SampleBitFieldClass(
+        channels=BitField(np.zeros(12, dtype=np.bool)),
+        status=BitField(np.zeros(4, dtype=np.uint8), widths=(3, 5, 6, 2)),
+        counter=np.uint16(0),
+    )
+    received_object = protocol.read_data(prototype)
+    assert np.array_equal(received_object.channels.values, channels)
+    assert received_object.channels.values.dtype == np.bool
+    assert received_object.status.values.tolist() == [5, 17, 42, 3]
+    assert received_object.counter == 513
+
+    # Wide fields are supported up to the bit size of the values' datatype.
+    protocol.reset_transmission_buffer()
+    protocol._port.tx_buffer = b""
+    wide = BitField(np.array([1, 2**40 + 7, 2**64 - 1], dtype=np.uint64), widths=(1, 41, 64))
+    protocol.write_data(wide)
+    assert protocol.bytes_in_transmission_buffer == 14
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+    received_wide = protocol.read_data(BitField(np.zeros(3, dtype=np.uint64), widths=(1, 41, 64)))
+    assert received_wide.values.tolist() == wide.values.tolist()
+    assert repr(received_wide) == f"BitField(values={wide.values.tolist()}, widths=[1, 41, 64])"
+
+
+def test_bit_field_errors(protocol) -> None:
+    """Verifies the error handling of the BitField class and the BitField serialization."""
+    message = (
+        f"Unable to initialize BitField class. Expected a numpy array with one of the supported datatypes "
+        f"{BitField._accepted_numpy_types} for 'values' argument, but encountered {[1, 2]} of type {list.__name__}."
+    )
+    with pytest.raises(TypeError, match=error_format(message)):
+        # noinspection PyTypeChecker
+        BitField([1, 2])
+
+    message = (
+        "Unable to initialize BitField class. Expected a one-dimensional non-empty numpy array for 'values' argument, "
+        "but encountered an array with 2 dimensions and 4 elements."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        BitField(np.zeros((2, 2), dtype=np.uint8))
+
+    message = (
+        "Unable to initialize BitField class. Expected an integer between 1 and 8 or a sequence of 2 such integers "
+        "for 'widths' argument, but encountered (3, 9)."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        BitField(np.zeros(2, dtype=np.uint8), widths=(3, 9))
+
+    # Values that do not fit into their fields.
+    bit_field = BitField(np.array([7, 8], dtype=np.uint8), widths=3)
+    message = (
+        "Failed to write the data to the transmission buffer. At least one of the input BitField values [7, 8] does "
+        "not fit into the bit width of its field [3, 3]."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.write_data(bit_field)
+
+    # Reading more bits than available in the payload.
+    protocol.write_data(np.uint8(1))
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    protocol.receive_data()
+    prototype = BitField(np.zeros(9, dtype=np.bool))
+    message = (
+        f"Failed to read the data from the reception buffer. The reception buffer does not have enough "
+        f"unconsumed bytes to recreate the object. Specifically, the object requires {2} bytes, but the available "
+        f"payload size is {1} bytes."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.read_data(prototype)
+
+
+@pytest.mark.parametrize(
+    "values, delta, expected_size",
+    [
+        (np.array([0, 1, 127, 128, 300, 2**32 - 1], dtype=np.uint32), False, 1 + 1 + 1 + 2 + 2 + 5),
+        (np.array([0, -1, 1, -64, 64, -(2**31)], dtype=np.int32), False, 1 + 1 + 1 + 1 + 2 + 5),
+        (np.array([2**63 - 1, -(2**63)], dtype=np.int64), False, 10 + 10),
+        (np.array([0, 2**64 - 1], dtype=np.uint64), False, 1 + 10),
+        (np.arange(1_000_000, 1_000_100, 3, dtype=np.uint32), True, 3 + 33),
+        (np.array([100, 90, 95, -5, 120], dtype=np.int8), True, 2 + 1 + 1 + 2 + 2),
+        (np.array([2**64 - 1, 0, 5], dtype=np.uint64), True, 1 + 1 + 1),
+    ],
+)
+def test_varint_transmission_cycle(protocol, values, delta, expected_size) -> None:
+    """Verifies that VarintArray instances are serialized using the LEB128 encoding and received intact."""
+    data_object = VarintArray(values, delta=delta)
+    assert data_object.nbytes == expected_size
+    protocol.write_data(data_object)
+    assert protocol.bytes_in_transmission_buffer == expected_size
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+
+    received_object = protocol.read_data(VarintArray(np.zeros_like(values), delta=delta))
+    assert received_object.values.dtype == values.dtype
+    assert received_object.values.tolist() == values.tolist()
+    assert repr(received_object) == f"VarintArray(values={values.tolist()}, delta={delta})"
+
+
+def test_varint_encoding() -> None:
+    """Verifies the byte layout of the LEB128 and zigzag encodings against reference values."""
+    protocol = TransportLayer(port="COM7", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True)
+    protocol.write_data(VarintArray(np.array([300], dtype=np.uint16)))
+    protocol.write_data(VarintArray(np.array([-2, 2], dtype=np.int16)))
+    assert protocol.transmission_buffer[: protocol.bytes_in_transmission_buffer].tolist() == [0xAC, 0x02, 3, 4]
+
+    # Delta-encoded timestamps sampled every millisecond use 2 bytes per sample instead of 4 bytes, and encoder counts
+    # that change by less than 64 between samples use 1 byte per sample instead of 4 bytes.
+    timestamps = np.arange(3_000_000_000, 3_000_120_000, 1000, dtype=np.uint32)
+    assert VarintArray(timestamps, delta=True).nbytes == 5 + 119 * 2
+    counts = np.cumsum(np.random.default_rng(seed=0).integers(-63, 64, size=120)).astype(np.int32)
+    assert VarintArray(counts, delta=True).nbytes == counts.size
+
+
+def test_varint_errors(protocol) -> None:
+    """Verifies the error handling of the VarintArray class and the VarintArray serialization."""
+    message = (
+        f"Unable to initialize VarintArray class. Expected a numpy array with one of the supported datatypes "
+        f"{VarintArray._accepted_numpy_types} for 'values' argument, but encountered {[1.5]} of type "
+        f"{np.ndarray.__name__}."
+    )
+    with pytest.raises(TypeError, match=error_format(message)):
+        VarintArray(np.array([1.5]))
+
+    message = (
+        "Unable to initialize VarintArray class. Expected a one-dimensional non-empty numpy array for 'values' "
+        "argument, but encountered an array with 1 dimensions and 0 elements."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        VarintArray(np.empty(0, dtype=np.int32))
+
+    # Reading more values than stored in the payload.
+    protocol.write_data(VarintArray(np.array([1, 300], dtype=np.uint16)))
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    protocol.receive_data()
+    message = (
+        "Failed to read the data from the reception buffer. The reception buffer does not have enough unconsumed "
+        "bytes to decode 3 variable-length integers. The available payload size is 3 bytes."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.read_data(VarintArray(np.zeros(3, dtype=np.uint16)))
+
+    # Reading a value that does not terminate within 10 bytes.
+    protocol._port.tx_buffer = b""
+    protocol.write_data(np.full(11, 0xFF, dtype=np.uint8))
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    protocol.receive_data()
+    message = (
+        "Failed to read the data from the reception buffer. Encountered a variable-length integer that uses more "
+        "than 10 bytes, which indicates that the payload does not store the requested VarintArray data."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.read_data(VarintArray(np.zeros(1, dtype=np.uint64)))
+
+
 def test_receive_data_errors(protocol):
     """Verifies the error handling behavior of the TransportLayer class receive_data () method."""
     # Generates a test payload and uses TransportLayer internal methods to encode, checksum, and assemble the
@@ -466,7 +1171,7 @@ def test_receive_data_errors(protocol):
     preamble = np.array([129, 10], dtype=np.uint8)
 
     # Encodes the packet
-    packet = protocol._cobs_processor.encode_payload(test_payload)
+    packet = protocol._framing_processor.encode_payload(test_payload)
     packet_with_crc = np.empty(len(packet) + protocol._crc_processor.crc_byte_length, dtype=np.uint8)
     packet_with_crc[: len(packet)] = packet
     protocol._crc_processor.calculate_checksum(packet_with_crc, check=False)
@@ -495,7 +1200,7 @@ def test_receive_data_errors(protocol):
         protocol.receive_data()
 
     # Cleans up and resets the test buffer
-    protocol._leftover_bytes = b""  # Clears leftover bytes to prevent it from accumulating unprocessed bytes.
+    protocol._rx.stream_size = 0  # Clears the stream buffer to prevent it from accumulating unprocessed bytes.
     empty_buffer[-1] = 129
 
     # Packet reception stalls while waiting for additional payload bytes.
@@ -514,7 +1219,7 @@ def test_receive_data_errors(protocol):
         protocol.receive_data()
 
     # Cleans up and resets the test buffer
-    protocol._leftover_bytes = b""
+    protocol._rx.stream_size = 0
     # Does not reset the packet size, as the test below also modifies this value
     test_data[13] = 0
 
@@ -534,7 +1239,7 @@ def test_receive_data_errors(protocol):
         protocol.receive_data()
 
     # Cleans up and resets the test buffer
-    protocol._leftover_bytes = b""
+    protocol._rx.stream_size = 0
     test_data[1] = 10
 
     # Delimiter byte value found before reaching the end of the encoded packet.
@@ -553,7 +1258,7 @@ def test_receive_data_errors(protocol):
         protocol.receive_data()
 
     # Cleans up and resets the test buffer
-    protocol._leftover_bytes = b""
+    protocol._rx.stream_size = 0
     test_data[-3] = 10  # This was the initial value at index -4
 
     # Delimiter byte wasn't found at the end of the encoded packet.
@@ -571,7 +1276,7 @@ def test_receive_data_errors(protocol):
         protocol.receive_data()
 
     # Cleans up and resets the test buffer
-    protocol._leftover_bytes = b""
+    protocol._rx.stream_size = 0
     test_data[-2] = 0  # Restores the delimiter
 
     # CRC Checksum verification error.
@@ -586,13 +1291,13 @@ def test_receive_data_errors(protocol):
         protocol.receive_data()
 
     # Cleans up and resets the test buffer
-    protocol._leftover_bytes = b""
+    protocol._rx.stream_size = 0
 
     # COBS verification error.
     # For this test, creates a special test payload by introducing an error after COBS-encoding the payload, but
     # before generating the CRC checksum. This simulates for a very rare case where the packet corruption is so major
     # the CRC fails to detect the corruption. However, the corruption can break COBS-encoding, which COBS will detect.
-    packet = protocol._cobs_processor.encode_payload(payload=test_payload)
+    packet = protocol._framing_processor.encode_payload(payload=test_payload)
     packet[5] = 2  # Replaces one of the COBS_encoded values with a different value, introducing a COBS error
     packet_with_crc = np.empty(len(packet) + protocol._crc_processor.crc_byte_length, dtype=np.uint8)
     packet_with_crc[: len(packet)] = packet
@@ -607,3 +1312,1966 @@ def test_receive_data_errors(protocol):
     )
     with pytest.raises(RuntimeError, match=error_format(message)):
         protocol.receive_data()
+
+
+def test_reception_slots() -> None:
+    """Verifies that held payloads stay valid while the TransportLayer class receives the next payloads into the other
+    reception slots and that the bounded slot pool stops reception until a held payload is released.
+    """
+    protocol = TransportLayer(
+        port="COM7", microcontroller_serial_buffer_size=1024, baudrate=1000000, test_mode=True, reception_slots=2
+    )
+    for value in range(4):
+        protocol.write_data(np.full(4, value, dtype=np.uint8))
+        protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.free_reception_slots == 2
+
+    # The held payload stays readable through the instance until the next payload is received.
+    assert protocol.receive_data()
+    assert protocol.read_data(np.uint8(0)) == 0
+    first = protocol.hold_payload()
+    assert np.array_equal(first.data, [0, 0, 0, 0])
+    assert not first.data.flags.writeable
+    assert protocol.read_data(np.zeros(3, dtype=np.uint8)).tolist() == [0, 0, 0]
+    assert protocol.free_reception_slots == 1
+
+    # The next payload is received into the free slot, so the held payload is not overwritten.
+    assert protocol.receive_data()
+    assert np.array_equal(protocol.read_data(np.zeros(4, dtype=np.uint8)), [1, 1, 1, 1])
+    assert np.array_equal(first.data, [0, 0, 0, 0])
+    second = protocol.hold_payload()
+    assert protocol.free_reception_slots == 0
+
+    # If all slots are held, the incoming packets are left unprocessed until a payload is released.
+    assert not protocol.receive_data()
+    assert protocol._rx.stream_size > 0
+    with first:
+        assert first.data.tolist() == [0, 0, 0, 0]
+    assert first.released
+    assert protocol.free_reception_slots == 1
+    assert protocol.receive_data()
+    assert np.array_equal(protocol.read_data(np.zeros(4, dtype=np.uint8)), [2, 2, 2, 2])
+    assert np.array_equal(second.data, [1, 1, 1, 1])
+
+    # Releasing a payload twice has no effect, and a payload released before the next reception leaves its slot in use.
+    second.release()
+    second.release()
+    assert protocol.free_reception_slots == 2
+    third = protocol.hold_payload()
+    third.release()
+    assert protocol.receive_data()
+    assert np.array_equal(protocol.read_data(np.zeros(4, dtype=np.uint8)), [3, 3, 3, 3])
+    assert protocol.free_reception_slots == 2
+    assert len(protocol._rx.free_slots) == 1
+
+    # With a single slot, the held payload blocks reception until it is released.
+    protocol = TransportLayer(port="COM7", microcontroller_serial_buffer_size=1024, baudrate=1000000, test_mode=True)
+    protocol.write_data(np.uint8(5))
+    protocol.send_data()
+    protocol.write_data(np.uint8(6))
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+    held = protocol.hold_payload()
+    assert not protocol.receive_data()
+    held.release()
+    assert protocol.receive_data()
+    assert protocol.read_data(np.uint8(0)) == 6
+
+
+def test_hold_payload_errors(protocol) -> None:
+    """Verifies the error handling behavior of the TransportLayer hold_payload() method."""
+    message = (
+        "Unable to hold the received payload. The reception buffer does not store a payload. Call receive_data() to "
+        "receive a payload before holding it."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        protocol.hold_payload()
+
+    protocol.write_data(np.uint8(1))
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+    protocol.hold_payload()
+    message = "Unable to hold the received payload. The payload stored in the reception buffer is already held."
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        protocol.hold_payload()
+
+
+@pytest.mark.parametrize("framing_codec", [FramingCodec.COBS, FramingCodec.COBSR, FramingCodec.SLIP])
+@pytest.mark.parametrize("specialized_pipeline", [False, True])
+def test_lazy_decoding(framing_codec, specialized_pipeline) -> None:
+    """Verifies that the TransportLayer class defers decoding the received payloads until they are first accessed when
+    lazy decoding is enabled.
+    """
+    protocol = TransportLayer(
+        port="COM7",
+        microcontroller_serial_buffer_size=1024,
+        baudrate=1000000,
+        test_mode=True,
+        framing_codec=framing_codec,
+        specialized_pipeline=specialized_pipeline,
+        lazy_decoding=True,
+    )
+    payloads = ([7, 0, 2, 0], [0, 1], [200], [2, 0xC0, 0xDB, 9])
+    for payload in payloads:
+        protocol.write_data(np.array(payload, dtype=np.uint8))
+        protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+
+    # Peeking extracts the first byte from the verified, but still encoded, packet.
+    assert protocol.receive_data()
+    assert protocol.received_packets == 1
+    assert protocol._rx.encoded_size > 0
+    assert protocol._rx.bytes_in_buffer == 0
+    assert protocol.peek_payload() == 7
+    assert protocol._rx.encoded_size > 0
+
+    # The first read decodes the payload. Peeking after reading still returns the first payload byte.
+    assert protocol.read_data(np.zeros(2, dtype=np.uint8)).tolist() == [7, 0]
+    assert protocol._rx.encoded_size == 0
+    assert protocol.bytes_in_reception_buffer == 4
+    assert protocol.peek_payload() == 7
+
+    # Payloads dropped after peeking are never decoded, and receiving the next packet replaces the pending packet.
+    assert protocol.receive_data()
+    assert protocol.peek_payload() == 0
+    assert protocol.receive_data()
+    assert protocol.peek_payload() == 200
+    assert protocol.bytes_in_reception_buffer == 1
+    assert protocol.reception_buffer[0] == 200
+
+    # Holding the payload and scatter-gather reads also decode the pending payload.
+    assert protocol.receive_data()
+    with protocol.hold_payload() as held:
+        assert held.data.tolist() == payloads[3]
+    protocol._rx.consumed_bytes = 0
+    assert protocol.read_many(np.uint8(0), np.zeros(3, dtype=np.uint8))[1].tolist() == [0xC0, 0xDB, 9]
+
+    # Resetting the reception buffer discards the pending packet.
+    protocol.write_data(np.uint8(1))
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+    protocol.reset_reception_buffer()
+    assert protocol.bytes_in_reception_buffer == 0
+    message = (
+        "Unable to peek at the received payload. The reception buffer does not store a payload. Call receive_data() "
+        "to receive a payload before peeking at it."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        protocol.peek_payload()
+
+
+def test_lazy_decoding_errors() -> None:
+    """Verifies that the TransportLayer class raises the decoding error when a packet with a valid checksum stores an
+    incorrectly encoded payload.
+    """
+    protocol = TransportLayer(
+        port="COM7", microcontroller_serial_buffer_size=1024, baudrate=1000000, test_mode=True, lazy_decoding=True
+    )
+
+    # Builds a packet whose checksum matches a COBS-encoded payload with a length code that points past the
+    # terminating delimiter. The checksum is written to the postamble bytes at the end of the packet.
+    packet = np.array([2, 1, 3, 1, 0] + [0] * int(protocol._crc_processor.crc_byte_length), dtype=np.uint8)
+    protocol._crc_processor.calculate_checksum(packet, check=False)
+    protocol._port.rx_buffer = bytes([129, 3]) + packet.tobytes()
+    assert protocol.receive_data()
+    message = (
+        "Failed to decode the received serial packet. The packet's checksum is valid, but the packet does not store a "
+        "payload encoded with the instance's framing codec. This indicates that the Microcontroller uses a different "
+        "framing codec."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        protocol.read_data(np.uint8(0))
+    assert protocol.bytes_in_reception_buffer == 0
+
+
+def test_adaptive_reads(protocol) -> None:
+    """Verifies that the TransportLayer class reads many packets with each serial port call under sustained streaming
+    and skips the serial port query after the reads that return all requested bytes.
+    """
+    # Generates two bursts of five packets. Each burst is larger than the initial read size.
+    for value in range(10):
+        protocol.write_data(np.full(100, value, dtype=np.uint8))
+        protocol.send_data()
+    stream = protocol._port.tx_buffer
+    burst_size = len(stream) // 2
+    assert burst_size > protocol._rx.read_size
+
+    # The first availability check and reception query the port, and the reception reads the whole burst, which fills
+    # the request. The remaining packets of the burst are parsed from the stream buffer without calling the serial
+    # port.
+    protocol._port.rx_buffer = stream[:burst_size]
+    for value in range(5):
+        assert protocol.available
+        assert protocol.receive_data()
+        assert protocol.read_data(np.zeros(100, dtype=np.uint8)).tolist() == [value] * 100
+    assert protocol.reception_port_calls == 3
+    assert protocol._rx.read_saturated
+    assert protocol._rx.read_size == 2 * burst_size
+
+    # Since the previous read filled the request, the next reception reads the second burst without querying the port.
+    protocol._port.rx_buffer = stream[burst_size:]
+    for value in range(5, 10):
+        assert protocol.receive_data()
+        assert protocol.read_data(np.zeros(100, dtype=np.uint8)).tolist() == [value] * 100
+    assert protocol.reception_port_calls == 4
+    assert protocol.port_calls_per_packet == pytest.approx(0.4)
+    assert not protocol._rx.read_saturated
+
+    # Once the stream runs dry, each reception attempt queries the port.
+    assert not protocol.receive_data()
+    assert not protocol.available
+    assert protocol.reception_port_calls == 6
+
+
+def test_non_blocking_transmission(protocol) -> None:
+    """Verifies that the TransportLayer class stores the packet bytes not accepted by the serial port in the
+    transmission ring, transmits them in order, and signals backpressure through the watermarks.
+    """
+    tl = TransportLayer(
+        port="COM7",
+        microcontroller_serial_buffer_size=1024,
+        baudrate=1000000,
+        test_mode=True,
+        transmission_ring_size=300,
+    )
+
+    # Uses a blocking instance to generate the byte-stream the tested instance is expected to transmit.
+    for value in range(30):
+        protocol.write_data(np.full(10, value, dtype=np.uint8))
+        protocol.send_data()
+    expected_stream = protocol._port.tx_buffer
+    packet_size = len(expected_stream) // 30
+    protocol._port.tx_buffer = b""
+
+    # Limits the serial port's output queue, so that each packet only partially fits into the queue.
+    tl._port.tx_capacity = 20
+    events: list[str] = []
+    tl.set_transmission_watermarks(
+        high_watermark=40, low_watermark=10, on_high=lambda: events.append("high"), on_low=lambda: events.append("low")
+    )
+
+    # The first packet fits into the queue. The second packet is split between the queue and the ring. Since the queue
+    # is full, the third packet is fully stored in the ring, which raises the backlog above the high watermark.
+    for value in range(3):
+        tl.write_data(np.full(10, value, dtype=np.uint8))
+        tl.send_data()
+    assert tl.transmitted_packets == 3
+    assert tl.bytes_in_transmission_buffer == 0
+    assert tl.pending_transmission_bytes == 3 * packet_size - 20
+    assert tl.transmission_backlog == 3 * packet_size
+    assert tl.transmission_throttled
+    assert events == ["high"]
+
+    # Emulates the transmission of the queued bytes. The first flush only moves part of the pending bytes to the
+    # queue, so the backlog stays above the low watermark.
+    stream = tl._port.tx_buffer
+    tl._port.tx_buffer = b""
+    assert not tl.flush_transmission()
+    assert tl.transmission_throttled
+    stream += tl._port.tx_buffer
+    tl._port.tx_buffer = b""
+    assert tl.flush_transmission()
+    assert not tl.transmission_throttled
+    assert events == ["high", "low"]
+    stream += tl._port.tx_buffer
+    tl._port.tx_buffer = b""
+
+    # Fills the queue and then the ring with two packets. Afterward, the queue accepts one packet per transmitted
+    # packet, so the ring always stores two packets and the pending bytes wrap around the end of the ring.
+    tl.set_transmission_watermarks(high_watermark=0, low_watermark=0)
+    tl._port.tx_capacity = packet_size
+    for value in range(3, 30):
+        tl.write_data(np.full(10, value, dtype=np.uint8))
+        tl.send_data()
+        if value >= 5:
+            stream += tl._port.tx_buffer
+            tl._port.tx_buffer = b""
+    assert tl.pending_transmission_bytes == 2 * packet_size
+
+    # Waits for the serial port to accept the remaining bytes.
+    tl._port.tx_capacity = None
+    assert tl.flush_transmission(timeout=1000)
+    stream += tl._port.tx_buffer
+    assert stream == expected_stream
+
+    # The watermarks also work in the blocking mode, where the backlog only includes the serial port's queue.
+    protocol.set_transmission_watermarks(high_watermark=2 * packet_size, low_watermark=0)
+    protocol.write_data(np.zeros(10, dtype=np.uint8))
+    protocol.send_data()
+    assert not protocol.transmission_throttled
+    protocol.write_data(np.zeros(10, dtype=np.uint8))
+    protocol.send_data()
+    assert protocol.transmission_throttled
+    protocol._port.tx_buffer = b""
+    assert protocol.flush_transmission()
+    assert not protocol.transmission_throttled
+
+
+def test_non_blocking_transmission_errors() -> None:
+    """Verifies the error handling of the TransportLayer class's non-blocking transmission mode."""
+    message = (
+        "Unable to initialize TransportLayer class. Expected 0 or an integer value of at least 259 (the maximum packet "
+        "size) for 'transmission_ring_size' argument, but encountered 100 of type int."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer(
+            port="COM7",
+            microcontroller_serial_buffer_size=1024,
+            baudrate=1000000,
+            test_mode=True,
+            transmission_ring_size=100,
+        )
+
+    tl = TransportLayer(
+        port="COM7",
+        microcontroller_serial_buffer_size=1024,
+        baudrate=1000000,
+        test_mode=True,
+        transmission_ring_size=300,
+    )
+    tl._port.tx_capacity = 0
+
+    # Fills the ring until it can no longer store a maximum-size packet. The rejected payload stays in the
+    # transmission buffer.
+    for _ in range(3):
+        tl.write_data(np.zeros(10, dtype=np.uint8))
+        tl.send_data()
+    tl.write_data(np.zeros(10, dtype=np.uint8))
+    message = (
+        "Unable to send the data. The transmission ring has 255 free bytes, but the transmitted packets may require up "
+        "to 259 bytes. The serial port does not accept the data as fast as it is sent. Use the flush_transmission() "
+        "method or the transmission watermarks to wait for the serial port to accept the pending bytes before sending "
+        "more data."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        tl.send_data()
+    assert tl.bytes_in_transmission_buffer == 10
+    assert tl.transmitted_packets == 3
+
+    # Verifies that the flush times out if the serial port does not accept any bytes.
+    assert not tl.flush_transmission(timeout=1000)
+    assert tl.pending_transmission_bytes == 45
+
+    # Records that need two packets require the space for two maximum-size packets.
+    tl._port.tx_capacity = None
+    assert tl.flush_transmission()
+    message = (
+        "Unable to send the data. The transmission ring has 300 free bytes, but the transmitted packets may require up "
+        "to 518 bytes. The serial port does not accept the data as fast as it is sent. Use the flush_transmission() "
+        "method or the transmission watermarks to wait for the serial port to accept the pending bytes before sending "
+        "more data."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        tl.send_records(np.zeros(300, dtype=[("value", np.uint8)]))
+
+    message = (
+        "Unable to set the transmission watermarks. Expected non-negative integer values, with the 'low_watermark' "
+        "lower than the 'high_watermark' unless the 'high_watermark' is 0, but encountered a high_watermark of 10 and "
+        "a low_watermark of 10."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        tl.set_transmission_watermarks(high_watermark=10, low_watermark=10)
+
+
+def test_full_duplex_threads(protocol) -> None:
+    """Verifies that the TransportLayer class can concurrently send and receive data from two different threads.
+
+    This stress test runs the transmission and reception paths of the same instance in parallel and verifies that
+    neither direction corrupts the state of the other.
+    """
+    packet_count = 500
+    payload_prototype = np.zeros(shape=16, dtype=np.uint16)
+
+    # Uses a second instance to generate the byte-stream 'sent' by the Microcontroller. Since both instances use the
+    # same parameters, the stream also matches the bytes the tested instance is expected to transmit.
+    peer = TransportLayer(port="COM8", microcontroller_serial_buffer_size=1024, baudrate=1000000, test_mode=True)
+    for index in range(packet_count):
+        peer.write_data(np.full_like(payload_prototype, fill_value=index))
+        peer.send_data()
+    expected_stream = peer._port.tx_buffer
+    protocol._port.rx_buffer = expected_stream
+
+    errors: list[BaseException] = []
+    received_values: list[int] = []
+
+    def transmit() -> None:
+        """Sends all test payloads to the mocked serial port."""
+        try:
+            for value in range(packet_count):
+                protocol.write_data(np.full_like(payload_prototype, fill_value=value))
+                protocol.send_data()
+        except BaseException as error:  # pragma: no cover
+            errors.append(error)
+
+    def receive() -> None:
+        """Receives all test payloads from the mocked serial port."""
+        try:
+            while len(received_values) < packet_count:
+                if protocol.receive_data():
+                    payload = protocol.read_data(np.zeros_like(payload_prototype))
+                    assert np.all(payload == payload[0])
+                    received_values.append(int(payload[0]))
+        except BaseException as error:  # pragma: no cover
+            errors.append(error)
+
+    threads = [Thread(target=transmit), Thread(target=receive)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join(timeout=60)
+
+    # Verifies that both directions completed without errors and that no payload was lost, duplicated, or reordered.
+    assert not errors
+    assert received_values == list(range(packet_count))
+    assert protocol._port.tx_buffer == expected_stream
+    assert protocol.transmitted_packets == packet_count
+    assert protocol.received_packets == packet_count
+
+
+def test_same_direction_threads(protocol) -> None:
+    """Verifies that the TransportLayer class does not lose packets or counter updates when multiple threads use the
+    same direction of the same instance.
+
+    This test guards against relying on the GIL for atomicity, which does not hold on free-threaded Python builds.
+    """
+    thread_count = 8
+    packet_count = 200
+    errors: list[BaseException] = []
+
+    def transmit(value: int) -> None:
+        """Sends the test payloads to the mocked serial port."""
+        try:
+            for _ in range(packet_count):
+                # Holds the re-entrant transmission lock to stage and send each payload as a single operation.
+                with protocol._tx.lock:
+                    protocol.write_data(np.full(shape=8, fill_value=value, dtype=np.uint8))
+                    protocol.send_data()
+        except BaseException as error:  # pragma: no cover
+            errors.append(error)
+
+    threads = [Thread(target=transmit, args=(value,)) for value in range(thread_count)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join(timeout=60)
+
+    # Since each payload is staged and sent under the same lock acquisition, every packet must contain the payload
+    # of a single thread, and the counters must account for every packet.
+    assert not errors
+    assert protocol.transmitted_packets == thread_count * packet_count
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    received_values = []
+    while protocol.receive_data():
+        payload = protocol.read_data(np.zeros(shape=8, dtype=np.uint8))
+        assert np.all(payload == payload[0])
+        received_values.append(int(payload[0]))
+    assert sorted(received_values) == sorted(list(range(thread_count)) * packet_count)
+    assert protocol.received_packets == thread_count * packet_count
+
+
+def test_independent_instance_threads() -> None:
+    """Verifies that TransportLayer instances driven from separate threads do not interfere with each other through the
+    module-level state they share.
+
+    All instances share the compiled jitted kernels and the module-level default arguments of the packet parser, which
+    this test calls directly from every thread.
+    """
+    thread_count = 8
+    packet_count = 100
+    errors: list[BaseException] = []
+
+    def exchange(value: int) -> None:
+        """Sends the test payloads through a dedicated mocked instance and verifies that they are received unchanged."""
+        try:
+            tl = TransportLayer(port="COM8", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True)
+            for index in range(packet_count):
+                payload = np.full(shape=value + 1, fill_value=index, dtype=np.uint8)
+                tl.write_data(payload)
+                tl.send_data()
+                packet = tl._port.tx_buffer
+                tl._port.tx_buffer = b""
+
+                # Relies on the default (shared) value of the 'parsed_bytes' argument.
+                status, parsed_count, _, parsed_bytes = TransportLayer._parse_packet(
+                    np.frombuffer(packet, dtype=np.uint8),
+                    tl._start_byte,
+                    tl._framing_processor.processor,
+                    tl._max_rx_payload_size,
+                    tl._min_rx_payload_size,
+                    tl._postamble_size,
+                )
+                assert status == TransportLayerStatus.PACKET_PARSED
+                assert parsed_count == parsed_bytes.size == len(packet) - 2
+
+                tl._port.rx_buffer = packet
+                assert tl.receive_data()
+                assert np.array_equal(tl.read_data(np.zeros(shape=value + 1, dtype=np.uint8)), payload)
+            assert tl.transmitted_packets == packet_count
+            assert tl.received_packets == packet_count
+        except BaseException as error:  # pragma: no cover
+            errors.append(error)
+
+    threads = [Thread(target=exchange, args=(value,)) for value in range(thread_count)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join(timeout=60)
+
+    assert not errors
+
+
+@pytest.mark.parametrize(
+    "wait_strategy",
+    [WaitStrategy.spin(), WaitStrategy.hybrid(spin_duration=100, yield_duration=100), WaitStrategy.sleep()],
+)
+def test_receive_data_timeout(wait_strategy: WaitStrategy) -> None:
+    """Verifies that the TransportLayer receive_data() method waits for the packet to arrive using each of the
+    supported wait strategies.
+    """
+    protocol = TransportLayer(
+        port="COM7",
+        microcontroller_serial_buffer_size=64,
+        baudrate=1000000,
+        test_mode=True,
+        wait_strategy=wait_strategy,
+    )
+    assert protocol.wait_strategy == wait_strategy
+
+    # Verifies that the method returns False if the packet does not arrive before the timeout.
+    assert not protocol.receive_data(timeout=2000)
+
+    # Delivers the packet while the method is waiting for it.
+    protocol.write_data(np.uint8(7))
+    protocol.send_data()
+    stream = protocol._port.tx_buffer
+    writer = Thread(target=lambda: (sleep(0.005), protocol._port.feed(stream)))
+    writer.start()
+    assert protocol.receive_data(timeout=5_000_000)
+    writer.join()
+    assert protocol.read_data(np.uint8(0)) == 7
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="The poll() wait requires a pseudo-terminal.")
+def test_wait_high_file_descriptor() -> None:
+    """Verifies that the TransportLayer class waits for the serial port's bytes when the port's file descriptor does
+    not fit into the fixed-size descriptor set used by select().
+    """
+    controller, device = os.openpty()
+    protocol = TransportLayer(
+        port=os.ttyname(device),
+        microcontroller_serial_buffer_size=64,
+        baudrate=1000000,
+        wait_strategy=WaitStrategy.sleep(),
+    )
+
+    # Moves the port to a file descriptor above 1023 and registers the moved descriptor with a new poll object.
+    descriptor = protocol._port.fd
+    protocol._port.fd = os.dup2(descriptor, 1500)
+    os.close(descriptor)
+    protocol._poller = protocol._register_poller()
+
+    peer = TransportLayer(port="COM8", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True)
+    peer.write_data(np.uint8(7))
+    peer.send_data()
+    writer = Thread(target=lambda: (sleep(0.005), os.write(controller, peer._port.tx_buffer)))
+    writer.start()
+    assert protocol.receive_data(timeout=5_000_000)
+    writer.join()
+    assert protocol.read_data(np.uint8(0)) == 7
+
+    protocol._port.close()
+    os.close(controller)
+    os.close(device)
+
+
+def test_real_time_session(protocol) -> None:
+    """Verifies the functionality and error-handling of the TransportLayer real-time session methods.
+
+    The test does not assume that the host system grants the permissions required by all real-time features, and
+    only verifies that the features that were applied are reported and restored correctly.
+    """
+    # Verifies that stopping a session that was not started raises an error.
+    message = (
+        "Unable to stop the real-time session. The TransportLayer instance does not have an active real-time session."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        protocol.stop_real_time_session()
+
+    gc_enabled = gc.isenabled()
+    affinity = os.sched_getaffinity(0) if hasattr(os, "sched_getaffinity") else None
+    protocol.start_real_time_session(cpu_core=0, fifo_priority=1)
+
+    # Verifies that starting a second session raises an error.
+    message = (
+        "Unable to start the real-time session. The TransportLayer instance already has an active real-time session. "
+        "Stop the active session before starting a new one."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        protocol.start_real_time_session()
+    assert not gc.isenabled()
+
+    # Sends the test packets to itself and verifies that the session records the latency of each received packet.
+    for index in range(10):
+        protocol.write_data(np.uint8(index))
+        protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    while protocol.receive_data():
+        pass
+
+    report = protocol.stop_real_time_session()
+    assert gc.isenabled() == gc_enabled
+    assert report.gc_disabled == gc_enabled
+    assert report.packet_count == 10
+    assert 0 <= report.median_latency <= report.p99_latency <= report.p999_latency <= report.maximum_latency
+    if report.cpu_core is not None:
+        assert os.sched_getaffinity(0) == affinity
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="Memory locking is only supported on Linux and macOS.")
+def test_overlapping_real_time_sessions(monkeypatch) -> None:
+    """Verifies that the overlapping real-time sessions of multiple instances only restore the process-wide features
+    when the last session ends.
+    """
+    unlock_calls: list[int] = []
+    monkeypatch.setattr("ataraxis_transport_layer_pc.transport_layer._mlockall", lambda flags: 0)
+    monkeypatch.setattr("ataraxis_transport_layer_pc.transport_layer._munlockall", lambda: unlock_calls.append(0))
+    gc.enable()
+
+    first, second = (
+        TransportLayer(port=port, microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True)
+        for port in ("COM7", "COM8")
+    )
+    first.start_real_time_session()
+    second.start_real_time_session()
+    assert not gc.isenabled()
+
+    # Stopping the first session keeps the features used by the second session.
+    first_report = first.stop_real_time_session()
+    assert first_report.gc_disabled
+    assert first_report.memory_locked
+    assert not gc.isenabled()
+    assert not unlock_calls
+
+    # Stopping the last session restores the features.
+    second_report = second.stop_real_time_session()
+    assert second_report.gc_disabled
+    assert second_report.memory_locked
+    assert gc.isenabled()
+    assert len(unlock_calls) == 1
+
+
+def wait_for_drained_packets(protocol: TransportLayer, packet_count: int) -> bool:
+    """Waits up to one second for the transmission tracker's watcher thread to record the requested number of drained
+    packets.
+
+    Returns:
+        True if the watcher thread recorded the requested number of drained packets and False if the wait timed out.
+    """
+    for _ in range(1000):
+        with protocol._tx.lock:
+            if protocol._tx.tracker.packet_count >= packet_count:
+                return True
+        sleep(0.001)
+    return False
+
+
+def complete_drained_packets(protocol: TransportLayer) -> int:
+    """Records the packets drained by the mocked serial port without waiting for the watcher thread.
+
+    Returns:
+        The number of drained packets recorded by the transmission tracker.
+    """
+    with protocol._tx.lock:
+        protocol._complete_drained_packets(tracker=protocol._tx.tracker)
+        return protocol._tx.tracker.packet_count
+
+
+def test_transmission_tracking(protocol) -> None:
+    """Verifies that the TransportLayer class records the outbound latency of each packet once the serial port drains
+    it.
+    """
+    protocol.start_transmission_tracking()
+    for index in range(3):
+        protocol.write_data(np.full(10, index, dtype=np.uint8))
+        protocol.send_data()
+    packet_size = len(protocol._port.tx_buffer) // 3
+    assert complete_drained_packets(protocol) == 0
+
+    # Emulates the transmission of the first packet. The remaining packets are still queued by the serial port.
+    protocol._port.tx_buffer = protocol._port.tx_buffer[packet_size:]
+    assert complete_drained_packets(protocol) == 1
+
+    # Emulates the transmission of the remaining packets and waits for the watcher thread to record them.
+    protocol._port.tx_buffer = b""
+    assert wait_for_drained_packets(protocol, packet_count=3)
+
+    # Records sent as multiple packets are tracked as separate packets. The last packet stays queued by the serial
+    # port.
+    protocol.send_records(np.zeros(300, dtype=[("value", np.uint8)]))
+    protocol._port.tx_buffer = protocol._port.tx_buffer[-1:]
+    assert complete_drained_packets(protocol) == 4
+
+    report = protocol.stop_transmission_tracking()
+    assert protocol._tx.tracker is None
+    assert report.packet_count == 4
+    assert report.pending_count == 1
+    assert report.failed_count == 0
+    assert report.timestamps.shape == (4, 2)
+    assert np.all(report.timestamps[:, 1] >= report.timestamps[:, 0])
+    assert np.all(np.diff(report.timestamps[:, 0].astype(np.int64)) >= 0)
+    assert len(report.histogram) == 32
+    assert sum(report.histogram) == 4
+    assert 0 <= report.median_latency <= report.p99_latency <= report.p999_latency <= report.maximum_latency
+
+    # Packets stored in the transmission ring are not drained until they are handed off to the serial port.
+    tl = TransportLayer(
+        port="COM7",
+        microcontroller_serial_buffer_size=1024,
+        baudrate=1000000,
+        test_mode=True,
+        transmission_ring_size=300,
+    )
+    tl._port.tx_capacity = 0
+    tl.start_transmission_tracking()
+    tl.write_data(np.zeros(10, dtype=np.uint8))
+    tl.send_data()
+    assert complete_drained_packets(tl) == 0
+    tl._port.tx_capacity = None
+    assert tl.flush_transmission()
+    tl._port.tx_buffer = b""
+    assert complete_drained_packets(tl) == 1
+    report = tl.stop_transmission_tracking()
+    assert report.packet_count == 1
+    assert report.pending_count == 0
+
+    # The tracker keeps the timestamps of the most recent packets, ordered from the oldest to the newest packet. Shrinks
+    # the tracker's buffer to verify that the oldest timestamps are overwritten.
+    tl.start_transmission_tracking()
+    tl._tx.tracker.timestamps = np.zeros(shape=(2, 2), dtype=np.uint64)
+    for _ in range(3):
+        tl.write_data(np.zeros(10, dtype=np.uint8))
+        tl.send_data()
+        tl._port.tx_buffer = b""
+        complete_drained_packets(tl)
+    report = tl.stop_transmission_tracking()
+    assert report.packet_count == 3
+    assert report.timestamps.shape == (2, 2)
+    assert report.timestamps[0, 0] < report.timestamps[1, 0]
+
+
+def test_transmission_tracking_reconnection() -> None:
+    """Verifies that the TransportLayer class reports the tracked packets lost when the serial port is reopened as
+    failed.
+    """
+    tl = TransportLayer(
+        port="COM7",
+        microcontroller_serial_buffer_size=1024,
+        baudrate=1000000,
+        test_mode=True,
+        transmission_ring_size=300,
+    )
+    tl.start_transmission_tracking()
+    for index in range(3):
+        tl.write_data(np.full(10, index, dtype=np.uint8))
+        tl.send_data()
+    packet_size = len(tl._port.tx_buffer) // 3
+
+    # Emulates the transmission of the first packet and the first half of the second packet. Then, fills the serial
+    # port's output queue, so that the fourth packet is stored in the transmission ring.
+    tl._port.tx_buffer = tl._port.tx_buffer[packet_size + packet_size // 2 :]
+    tl._port.tx_capacity = len(tl._port.tx_buffer)
+    tl.write_data(np.full(10, 3, dtype=np.uint8))
+    tl.send_data()
+    assert tl._tx.ring_count == packet_size
+
+    # Reopening the port records the drained first packet and counts the packets queued by the closed port's driver as
+    # failed. The packet stored in the transmission ring is still pending.
+    assert tl.reconnect()
+    with tl._tx.lock:
+        assert tl._tx.tracker.packet_count == 1
+        assert tl._tx.tracker.failed_count == 2
+        assert len(tl._tx.tracker.pending) == 1
+
+    # Emulates the closed port's driver discarding its queue and transmits the pending packet through the reopened
+    # port.
+    tl._port.tx_buffer = b""
+    tl._port.tx_capacity = None
+    assert tl.flush_transmission()
+    tl._port.tx_buffer = b""
+    assert complete_drained_packets(tl) == 2
+
+    report = tl.stop_transmission_tracking()
+    assert report.packet_count == 2
+    assert report.failed_count == 2
+    assert report.pending_count == 0
+
+
+def test_transmission_tracking_errors(protocol) -> None:
+    """Verifies the error handling of the TransportLayer class's transmission tracking methods."""
+    message = (
+        "Unable to stop the transmission tracking. The TransportLayer instance is not tracking the transmitted packets."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        protocol.stop_transmission_tracking()
+
+    protocol.start_transmission_tracking()
+    message = (
+        "Unable to start the transmission tracking. The TransportLayer instance is already tracking the transmitted "
+        "packets. Stop the active tracking before starting a new one."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        protocol.start_transmission_tracking()
+    report = protocol.stop_transmission_tracking()
+    assert report.packet_count == 0
+    assert report.maximum_latency == 0
+    assert sum(report.histogram) == 0
+
+
+def test_forward_error_correction() -> None:
+    """Verifies that the TransportLayer class corrects the corrupted packets when forward error correction is enabled.
+
+    Corrupts the maximum correctable number of bytes of each packet, including the delimiter byte, to verify that the
+    correction is applied before the delimiter and CRC checks.
+    """
+    sender = TransportLayer(
+        port="COM7", microcontroller_serial_buffer_size=1024, baudrate=1000000, test_mode=True, fec_parity_size=8
+    )
+    receiver = TransportLayer(
+        port="COM8", microcontroller_serial_buffer_size=1024, baudrate=1000000, test_mode=True, fec_parity_size=8
+    )
+
+    # The encoded payload, the 1-byte CRC checksum, and the 8 parity bytes have to fit into a 255-byte block.
+    assert sender._max_tx_payload_size == 244
+    assert receiver._max_rx_payload_size == 244
+
+    test_payload = np.array([1, 2, 3, 4, 0, 0, 7, 8, 9, 10], dtype=np.uint8)
+    sender.write_data(test_payload)
+    sender.send_data()
+    packet = np.frombuffer(sender._port.tx_buffer, dtype=np.uint8).copy()
+    assert packet.size == 2 + 12 + 1 + 8  # Preamble, encoded payload, CRC checksum, and parity bytes
+
+    # Corrupts 4 bytes: an encoded payload byte, the delimiter byte, the CRC checksum, and a parity byte.
+    corrupted = packet.copy()
+    corrupted[[5, 13, 14, 20]] ^= np.uint8(0x5A)
+    receiver._port.rx_buffer = corrupted.tobytes()
+    assert receiver.receive_data()
+    assert np.array_equal(receiver.read_data(np.zeros(10, dtype=np.uint8)), test_payload)
+
+    # Corrupts more bytes than the parity bytes can correct. The CRC check detects the uncorrected corruption.
+    corrupted[[3, 6, 7, 9, 11]] ^= np.uint8(0x33)
+    receiver._port.rx_buffer = corrupted.tobytes()
+    message = (
+        "Failed to process the received serial packet. This indicates that the packet was corrupted during "
+        "transmission or reception."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        receiver.receive_data()
+
+
+def test_compression() -> None:
+    """Verifies that the TransportLayer class compresses the compressible payloads and sends the incompressible payloads
+    uncompressed when compression is enabled.
+    """
+    protocol = TransportLayer(
+        port="COM7", microcontroller_serial_buffer_size=1024, baudrate=1000000, test_mode=True, compression=True
+    )
+
+    # The compression header uses one byte of the transmitted payload.
+    assert protocol._max_tx_payload_size == 253
+    assert protocol._max_rx_payload_size == 254
+
+    # A sparse event array is compressed into two 1-byte literal blocks, each followed by a 99-byte match.
+    events = np.zeros(200, dtype=np.uint8)
+    events[100] = 7
+    protocol.write_data(events)
+    protocol.send_data()
+    packet_size = len(protocol._port.tx_buffer)
+    assert packet_size == 2 + (1 + 2 + 2 + 2 + 2) + 2 + 1  # Preamble, header, blocks, COBS overhead, CRC
+
+    # An incompressible payload is sent uncompressed, using one extra byte for the header.
+    ramp = np.arange(100, dtype=np.uint8)
+    protocol.write_data(ramp)
+    protocol.send_data()
+    assert len(protocol._port.tx_buffer) - packet_size == 2 + (1 + 100) + 2 + 1
+
+    # Verifies that both payloads are received intact.
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+    assert protocol.bytes_in_reception_buffer == 200
+    assert np.array_equal(protocol.read_data(np.zeros(200, dtype=np.uint8)), events)
+    assert protocol.receive_data()
+    assert protocol.bytes_in_reception_buffer == 100
+    assert np.array_equal(protocol.read_data(np.zeros(100, dtype=np.uint8)), ramp)
+
+    # Payloads with an unknown header value are rejected.
+    peer = TransportLayer(port="COM8", microcontroller_serial_buffer_size=1024, baudrate=1000000, test_mode=True)
+    peer.write_data(np.array([2, 1, 2, 3], dtype=np.uint8))
+    peer.send_data()
+    protocol._port.rx_buffer = peer._port.tx_buffer
+    message = (
+        "Failed to process the received serial packet. This indicates that the packet was corrupted during "
+        "transmission or reception."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        protocol.receive_data()
+
+
+def test_delta_transmission() -> None:
+    """Verifies that the TransportLayer class transmits the payloads as patches to the previous payload, rebuilds the
+    payloads on reception, and recovers from lost payloads at the next keyframe.
+    """
+    sender, receiver = (
+        TransportLayer(
+            port=port,
+            microcontroller_serial_buffer_size=1024,
+            baudrate=1000000,
+            test_mode=True,
+            delta_keyframe_interval=4,
+        )
+        for port in ("COM7", "COM8")
+    )
+
+    # The delta header uses two bytes of the transmitted payload.
+    assert sender._max_tx_payload_size == 252
+    assert sender._max_rx_payload_size == 254
+
+    def send(state: np.ndarray) -> bytes:
+        """Sends the state and returns the transmitted packet."""
+        sender._port.tx_buffer = b""
+        sender.write_data(state)
+        sender.send_data()
+        return sender._port.tx_buffer
+
+    def receive(packet: bytes) -> np.ndarray:
+        """Receives the packet and returns the rebuilt state."""
+        receiver._port.rx_buffer = packet
+        assert receiver.receive_data()
+        return receiver.read_data(np.zeros(receiver.bytes_in_reception_buffer, dtype=np.uint8))
+
+    # The first payload is a keyframe that stores the full state.
+    state = np.zeros(100, dtype=np.uint8)
+    packet = send(state)
+    assert len(packet) == 2 + (2 + 100) + 2 + 1  # Preamble, header, payload, COBS overhead, CRC
+    assert np.array_equal(receive(packet), state)
+
+    # A single changed byte is sent as a single 3-byte patch.
+    state[10] = 5
+    packet = send(state)
+    assert len(packet) == 2 + (3 + 2 + 1) + 2 + 1  # Preamble, header, patch, COBS overhead, CRC
+    assert np.array_equal(receive(packet), state)
+
+    # Changed bytes separated by a single unchanged byte are merged into a single patch. The payload can also grow.
+    state = np.concatenate((state, np.ones(2, dtype=np.uint8)))
+    state[20] = 1
+    state[22] = 1
+    packet = send(state)
+    assert len(packet) == 2 + (3 + (2 + 3) + (2 + 2)) + 2 + 1
+    assert np.array_equal(receive(packet), state)
+
+    # An unchanged payload is sent as a delta frame without patches.
+    packet = send(state)
+    assert len(packet) == 2 + 3 + 2 + 1
+    assert np.array_equal(receive(packet), state)
+
+    # Each keyframe is followed by at most three delta frames, even if the state does not change.
+    packet = send(state)
+    assert len(packet) == 2 + (2 + 102) + 2 + 1
+    assert np.array_equal(receive(packet), state)
+
+    # Payloads that change too many bytes are sent as keyframes before the end of the keyframe cycle.
+    state = np.arange(102, dtype=np.uint8)
+    packet = send(state)
+    assert len(packet) == 2 + (2 + 102) + 2 + 1
+    assert np.array_equal(receive(packet), state)
+
+    # If a delta frame is lost, the receiver rejects all following delta frames until the next keyframe.
+    state[0] = 50
+    send(state)
+    for sequence in (8, 9):
+        state[sequence] = 60
+        packet = send(state)
+        message = (
+            f"Failed to rebuild the received delta frame {sequence}. The payload it was encoded against has not been "
+            f"received. All delta frames are discarded until the next keyframe is received."
+        )
+        with pytest.raises(RuntimeError, match=error_format(message)):
+            receive(packet)
+    assert np.array_equal(receive(send(state)), state)
+
+    # Malformed patches are rejected without modifying the reference.
+    peer = TransportLayer(port="COM9", microcontroller_serial_buffer_size=1024, baudrate=1000000, test_mode=True)
+    peer.write_data(np.array([1, 11, 102, 100, 5, 1, 1, 1, 1, 1], dtype=np.uint8))
+    peer.send_data()
+    message = (
+        "Failed to process the received serial packet. This indicates that the packet was corrupted during "
+        "transmission or reception."
+    )
+    receiver._port.rx_buffer = peer._port.tx_buffer
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        receiver.receive_data()
+    assert np.array_equal(receiver._rx.delta_reference[:102], state)
+
+
+@pytest.mark.parametrize(
+    "framing_codec, encoded_size",
+    [
+        (FramingCodec.COBS, 7 + 2),  # Overhead and delimiter bytes
+        (FramingCodec.COBSR, 7 + 1),  # The last payload byte replaces the final length code
+        (FramingCodec.SLIP, 7 + 2 + 1),  # Two escaped bytes and the delimiter byte
+        (FramingCodec.HDLC, 7 + 2 + 1),  # Two escaped bytes and the delimiter byte
+    ],
+)
+def test_framing_codecs(framing_codec: FramingCodec, encoded_size: int) -> None:
+    """Verifies that the TransportLayer class sends and receives packets using each supported framing codec."""
+    protocol = TransportLayer(
+        port="COM7",
+        microcontroller_serial_buffer_size=256,
+        baudrate=1000000,
+        test_mode=True,
+        framing_codec=framing_codec,
+    )
+    assert protocol._delimiter_byte == protocol._framing_processor.processor.delimiter
+
+    # The payload contains the delimiter and escape byte-values of all codecs.
+    payload = np.array([0, 0xC0, 0x7E, 0x7D, 0xDB, 5, 200], dtype=np.uint8)
+    for _ in range(2):
+        protocol.write_data(payload)
+        protocol.send_data()
+    assert len(protocol._port.tx_buffer) == 2 * (2 + encoded_size + 1)  # Preamble, encoded payload, CRC
+
+    # Verifies that both packets are received intact when they arrive together.
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    for _ in range(2):
+        assert protocol.receive_data()
+        assert np.array_equal(protocol.read_data(np.zeros(7, dtype=np.uint8)), payload)
+
+    # Verifies that a packet whose delimiter is never received stalls the reception once the inter-byte timeout runs
+    # out, instead of waiting for the maximum possible packet size.
+    protocol._port.rx_buffer = protocol._port.tx_buffer[:6]
+    maximum_size = protocol._framing_processor.processor.maximum_encoded_size(7) + 1
+    message = (
+        f"Failed to parse the incoming serial packet data. The byte number {5} out of {maximum_size} was not "
+        f"received in time ({protocol._timeout} microseconds), following the reception of the previous byte. Packet "
+        f"reception staled."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        protocol.receive_data()
+
+
+@pytest.mark.parametrize(
+    "framing_codec, escaped_byte, maximum_payload_size",
+    [
+        (FramingCodec.COBS, 0, 56),  # The buffer size minus the 8 preamble, overhead, and postamble bytes
+        (FramingCodec.SLIP, 0xDB, 30),  # 2 * 30 + 1 encoded bytes, the 2-byte preamble, and the 1-byte CRC
+        (FramingCodec.HDLC, 0x7D, 30),
+    ],
+)
+def test_framing_codec_transmission_limit(
+    framing_codec: FramingCodec, escaped_byte: int, maximum_payload_size: int
+) -> None:
+    """Verifies that the largest packet that can be sent with each framing codec fits into the microcontroller's
+    serial buffer.
+    """
+    protocol = TransportLayer(
+        port="COM7",
+        microcontroller_serial_buffer_size=64,
+        baudrate=1000000,
+        test_mode=True,
+        framing_codec=framing_codec,
+    )
+    assert protocol._max_tx_payload_size == maximum_payload_size
+
+    # A payload made entirely of escaped byte-values produces the largest possible packet.
+    payload = np.full(maximum_payload_size, fill_value=escaped_byte, dtype=np.uint8)
+    protocol.write_data(payload)
+    protocol.send_data()
+    assert len(protocol._port.tx_buffer) <= 64
+
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+    assert np.array_equal(protocol.read_data(np.zeros(maximum_payload_size, dtype=np.uint8)), payload)
+
+    # Verifies that the payload headers cannot use up the entire transmission limit.
+    message = (
+        f"Unable to initialize TransportLayer class. The microcontroller_serial_buffer_size of {9} bytes is too small "
+        f"to transmit any payload bytes using the slip framing codec and the requested packet postamble and payload "
+        f"headers."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer(
+            port="COM7",
+            microcontroller_serial_buffer_size=9,
+            baudrate=1000000,
+            test_mode=True,
+            framing_codec=FramingCodec.SLIP,
+            compression=True,
+            delta_keyframe_interval=4,
+        )
+
+
+@pytest.mark.parametrize(
+    "polynomial, initial_crc_value, final_crc_xor_value, framing_codec",
+    [
+        (np.uint8(0x07), np.uint8(0x00), np.uint8(0x00), FramingCodec.COBS),
+        (np.uint16(0x1021), np.uint16(0xFFFF), np.uint16(0x0000), FramingCodec.SLIP),
+        (np.uint32(0x04C11DB7), np.uint32(0xFFFFFFFF), np.uint32(0x00000000), FramingCodec.COBSR),
+    ],
+)
+def test_specialized_pipeline(
+    polynomial: np.unsignedinteger,
+    initial_crc_value: np.unsignedinteger,
+    final_crc_xor_value: np.unsignedinteger,
+    framing_codec: FramingCodec,
+) -> None:
+    """Verifies that the specialized packet pipeline produces and accepts the same packets as the generic methods and
+    that the instances with the same configuration share the compiled pipeline.
+    """
+    arguments = {
+        "port": "COM7",
+        "microcontroller_serial_buffer_size": 256,
+        "baudrate": 1000000,
+        "polynomial": polynomial,
+        "initial_crc_value": initial_crc_value,
+        "final_crc_xor_value": final_crc_xor_value,
+        "test_mode": True,
+        "framing_codec": framing_codec,
+    }
+    generic = TransportLayer(**arguments)
+    specialized = TransportLayer(**arguments, specialized_pipeline=True)
+    assert generic._pipeline is None
+    assert specialized._pipeline is TransportLayer(**arguments, specialized_pipeline=True)._pipeline
+
+    # Verifies that both paths construct identical packets.
+    payload = np.array([0, 0xC0, 0x7E, 0x7D, 0xDB, 5, 200, 0, 129], dtype=np.uint8)
+    for protocol in (generic, specialized):
+        protocol.write_data(payload)
+        protocol.send_data()
+    assert specialized._port.tx_buffer == generic._port.tx_buffer
+
+    # Verifies that the specialized pipeline receives the packet intact.
+    specialized._port.rx_buffer = specialized._port.tx_buffer
+    assert specialized.receive_data()
+    assert np.array_equal(specialized.read_data(np.zeros(9, dtype=np.uint8)), payload)
+
+    # Verifies that the specialized pipeline detects the corrupted packets.
+    packet = bytearray(specialized._port.tx_buffer)
+    packet[3] ^= 0xFF
+    specialized._port.rx_buffer = bytes(packet)
+    message = (
+        "Failed to process the received serial packet. This indicates that the packet was corrupted during "
+        "transmission or reception."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        specialized.receive_data()
+
+
+def test_specialized_pipeline_threads() -> None:
+    """Verifies that the instances created concurrently from multiple threads with the same configuration share the
+    compiled pipeline.
+    """
+    # Uses a configuration that no other test uses, so that the pipeline is built by the tested threads.
+    arguments = {
+        "port": "COM7",
+        "microcontroller_serial_buffer_size": 200,
+        "baudrate": 1000000,
+        "test_mode": True,
+        "specialized_pipeline": True,
+    }
+    pipelines: list[Any] = []
+
+    def build_instance() -> None:
+        pipelines.append(TransportLayer(**arguments)._pipeline)
+
+    threads = [Thread(target=build_instance) for _ in range(8)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    assert len(pipelines) == 8
+    assert all(pipeline is pipelines[0] for pipeline in pipelines)
+
+
+@pytest.mark.parametrize("specialized_pipeline", [False, True])
+def test_crc_preset(specialized_pipeline: bool) -> None:
+    """Verifies that the TransportLayer class sends and receives packets using a CRC preset and that the instances
+    with the same CRC parameters share the CRC processor.
+    """
+    protocol = TransportLayer(
+        port="COM7",
+        microcontroller_serial_buffer_size=256,
+        baudrate=1000000,
+        test_mode=True,
+        crc_preset=CRCPreset.CRC_16_GENIBUS,
+        specialized_pipeline=specialized_pipeline,
+    )
+    peer = TransportLayer(
+        port="COM8",
+        microcontroller_serial_buffer_size=256,
+        baudrate=1000000,
+        polynomial=np.uint16(0x1021),
+        initial_crc_value=np.uint16(0xFFFF),
+        final_crc_xor_value=np.uint16(0xFFFF),
+        test_mode=True,
+    )
+    assert protocol._crc_processor is peer._crc_processor
+    assert protocol._postamble_size == 2
+
+    # The preset uses a non-zero final XOR value, which the packet verification has to account for.
+    payload = np.array([1, 2, 3, 0, 5], dtype=np.uint8)
+    protocol.write_data(payload)
+    protocol.send_data()
+    protocol._port.rx_buffer = protocol._port.tx_buffer
+    assert protocol.receive_data()
+    assert np.array_equal(protocol.read_data(np.zeros(5, dtype=np.uint8)), payload)
+
+
+def exchange_peer_payload(
+    peer: TransportLayer, controller: int, payload: NDArray[np.uint8] | None
+) -> NDArray[np.uint8]:
+    """Receives the next payload sent over the controller end of the pseudo-terminal and, if provided, answers it with
+    the input payload.
+
+    This helper emulates the Microcontroller side of the communication, using the mocked peer instance to decode and
+    encode the packets.
+    """
+    while not peer.receive_data():
+        peer._port.feed(os.read(controller, 1024))
+    received = peer.reception_buffer[: peer.bytes_in_reception_buffer]
+    if payload is not None:
+        peer.write_data(payload)
+        peer.send_data()
+        os.write(controller, peer._port.tx_buffer)
+        peer._port.tx_buffer = b""
+    return received
+
+
+def exchange_handshake_message(
+    peer: TransportLayer, controller: int, message_type: int, payload: NDArray[np.uint8] | None
+) -> NDArray[np.uint8]:
+    """Receives the next handshake message of the input type sent over the controller end of the pseudo-terminal and,
+    if provided, answers it with the input payload.
+
+    Since the instance resends the unanswered handshake messages, the repeated messages of the previous types are
+    discarded.
+    """
+    received = exchange_peer_payload(peer, controller, None)
+    while received[1] != message_type:
+        received = exchange_peer_payload(peer, controller, None)
+    received = received.copy()
+    if payload is not None:
+        peer.write_data(payload)
+        peer.send_data()
+        os.write(controller, peer._port.tx_buffer)
+        peer._port.tx_buffer = b""
+    return received
+
+
+def build_capabilities(
+    version: int = 1, buffer_size: int = 512, crc_byte_length: int = 2, codec_mask: int = 0b0110, features: int = 0x83
+) -> NDArray[np.uint8]:
+    """Builds the capabilities message of a Microcontroller that uses the CRC-16-CCITT-FALSE checksum."""
+    message = np.zeros(20, dtype=np.uint8)
+    message[:3] = (255, 1, version)
+    message[3:5] = np.array([buffer_size], dtype="<u2").view(np.uint8)
+    message[5] = crc_byte_length
+    message[6:18] = np.array([0x1021, 0xFFFF, 0], dtype="<u4").view(np.uint8)
+    message[18:] = (codec_mask, features)
+    return message
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="The connection handshake test requires a pseudo-terminal.")
+def test_connection_handshake() -> None:
+    """Verifies that the TransportLayer class negotiates the fastest mutually supported configuration with the
+    Microcontroller and communicates using the negotiated configuration.
+    """
+    controller, device = os.openpty()
+    baseline = TransportLayer(port="COM8", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True)
+    received: list[NDArray[np.uint8]] = []
+
+    def emulate_microcontroller() -> None:
+        # Misses the first request, as if the Microcontroller was running its bootloader, and sends a corrupted packet
+        # before answering the resent request.
+        exchange_peer_payload(baseline, controller, None)
+        baseline.write_data(build_capabilities(features=0xBB))
+        baseline.send_data()
+        corrupted = bytearray(baseline._port.tx_buffer)
+        corrupted[-1] ^= 0xFF
+        baseline._port.tx_buffer = b""
+        os.write(controller, bytes(corrupted))
+        received.append(exchange_handshake_message(baseline, controller, 0, build_capabilities(features=0xBB)))
+        selection = exchange_handshake_message(baseline, controller, 2, None)
+        received.append(selection)
+        acknowledgment = selection.copy()
+        acknowledgment[1] = 3
+        baseline.write_data(acknowledgment)
+        baseline.send_data()
+        os.write(controller, baseline._port.tx_buffer)
+
+    peer_thread = Thread(target=emulate_microcontroller)
+    peer_thread.start()
+    # Uses a long timeout to account for the JIT compilation of the emulated Microcontroller's methods.
+    protocol = TransportLayer.negotiate(
+        port=os.ttyname(device),
+        baudrate=1000000,
+        timeout=10000000,
+        compression=True,
+        delta_keyframe_interval=10,
+        fec_parity_size=4,
+    )
+    peer_thread.join()
+    try:
+        # The request carries the handshake code, message type, and protocol version. The selection uses COBS/R, the
+        # fastest codec supported by the Microcontroller, drops forward error correction, which the Microcontroller
+        # does not support, and adds record batching. The extended frames and acknowledgments are never selected.
+        assert received[0].tolist() == [255, 0, 1]
+        assert received[1].tolist() == [255, 2, 1, 1, 19, 0, 10, 0]
+
+        capabilities = protocol.capabilities
+        assert capabilities.protocol_version == 1
+        assert capabilities.buffer_size == 512
+        assert capabilities.crc_byte_length == 2
+        assert (capabilities.polynomial, capabilities.initial_crc_value, capabilities.final_crc_xor_value) == (
+            0x1021,
+            0xFFFF,
+            0,
+        )
+        assert capabilities.framing_codecs == (FramingCodec.COBSR, FramingCodec.SLIP)
+        # All feature bits are preserved, including the reserved bit 7.
+        assert capabilities.features == (
+            MicrocontrollerFeature.COMPRESSION
+            | MicrocontrollerFeature.DELTA_TRANSMISSION
+            | MicrocontrollerFeature.EXTENDED_FRAMES
+            | MicrocontrollerFeature.BATCHING
+            | MicrocontrollerFeature.ACKNOWLEDGMENTS
+            | 0x80
+        )
+
+        # The instance uses the whole buffer of the Microcontroller, minus the compression and delta headers.
+        assert protocol._max_tx_payload_size == 251
+        assert protocol._crc_processor.crc_byte_length == 2
+        assert protocol._fec_processor is None
+
+        # Verifies that the Microcontroller configured with the negotiated parameters decodes the instance's packets.
+        peer = TransportLayer(
+            port="COM8",
+            microcontroller_serial_buffer_size=512,
+            baudrate=1000000,
+            polynomial=np.uint16(0x1021),
+            initial_crc_value=np.uint16(0xFFFF),
+            final_crc_xor_value=np.uint16(0),
+            test_mode=True,
+            compression=True,
+            delta_keyframe_interval=10,
+            framing_codec=FramingCodec.COBSR,
+        )
+        payload = np.arange(200, dtype=np.uint8)
+        protocol.write_data(payload)
+        protocol.send_data()
+        assert exchange_peer_payload(peer, controller, None).tolist() == payload.tolist()
+
+        # The records are batched only if the Microcontroller supports record batching.
+        records = np.zeros(3, dtype=[("trial", np.uint16), ("delay", np.float32)])
+        assert protocol.send_records(records) == 3
+        assert protocol.transmitted_packets == 2
+        features = capabilities.features & ~MicrocontrollerFeature.BATCHING
+        protocol._capabilities = replace(capabilities, features=features)
+        assert protocol.send_records(records) == 3
+        assert protocol.transmitted_packets == 5
+    finally:
+        protocol._port.close()
+        os.close(controller)
+        os.close(device)
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="The connection handshake test requires a pseudo-terminal.")
+def test_connection_handshake_errors() -> None:
+    """Verifies the error handling of the TransportLayer class's connection handshake."""
+    message = (
+        "Unable to negotiate the TransportLayer configuration. The framing_codec, polynomial argument(s) are "
+        "determined by the connection handshake and cannot be provided."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer.negotiate(port="COM8", baudrate=1000000, polynomial=np.uint8(7), framing_codec="cobs")
+
+    message = (
+        "Unable to negotiate the TransportLayer configuration. Expected an integer value between 0 and 65535 for "
+        "'delta_keyframe_interval' argument, but encountered 70000 of type int."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        TransportLayer.negotiate(port="COM8", baudrate=1000000, delta_keyframe_interval=70000)
+
+    def negotiate_with(
+        capabilities: NDArray[np.uint8] | None, acknowledgment: NDArray[np.uint8] | None, timeout: int = 10000000
+    ) -> None:
+        """Runs the handshake against a Microcontroller that replies with the input messages and verifies that the
+        failed handshake releases the serial port.
+
+        The default timeout accounts for the JIT compilation of the emulated Microcontroller's methods.
+        """
+        descriptor_count = len(os.listdir("/dev/fd"))
+        controller, device = os.openpty()
+        baseline = TransportLayer(port="COM8", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True)
+
+        def emulate_microcontroller() -> None:
+            exchange_handshake_message(baseline, controller, 0, capabilities)
+            if acknowledgment is not None:
+                exchange_handshake_message(baseline, controller, 2, acknowledgment)
+
+        peer_thread = Thread(target=emulate_microcontroller, daemon=True)
+        peer_thread.start()
+        try:
+            TransportLayer.negotiate(
+                port=os.ttyname(device), baudrate=1000000, timeout=timeout, compression=True, delta_keyframe_interval=10
+            )
+        finally:
+            peer_thread.join(timeout=1)
+
+            # The emulated Microcontroller does not receive the configuration selection unless it acknowledges it. The
+            # remaining messages can only be the resent requests.
+            if acknowledgment is None:
+                os.set_blocking(controller, False)
+                with contextlib.suppress(BlockingIOError):
+                    baseline._port.feed(os.read(controller, 4096))
+                while baseline.receive_data():
+                    assert baseline.reception_buffer[1] == 0
+            os.close(controller)
+            os.close(device)
+            assert len(os.listdir("/dev/fd")) == descriptor_count
+
+    message = (
+        "Unable to negotiate the TransportLayer configuration. The Microcontroller did not respond to the connection "
+        "handshake within 100000 microseconds. Make sure that the Microcontroller's firmware supports the connection "
+        "handshake."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        negotiate_with(capabilities=None, acknowledgment=None, timeout=100000)
+
+    message = (
+        "Unable to negotiate the TransportLayer configuration. Expected a 20-byte capabilities message of the "
+        "handshake protocol version 1, but the Microcontroller sent a 20-byte message of the version 2."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        negotiate_with(capabilities=build_capabilities(version=2), acknowledgment=None)
+
+    with pytest.raises(RuntimeError, match="reported an invalid configuration"):
+        negotiate_with(capabilities=build_capabilities(crc_byte_length=3), acknowledgment=None)
+    with pytest.raises(RuntimeError, match="reported an invalid configuration"):
+        negotiate_with(capabilities=build_capabilities(codec_mask=0), acknowledgment=None)
+
+    # The selected configuration is verified before it is sent to the Microcontroller. The Microcontroller's buffer is
+    # too small to transmit the compression and delta headers.
+    with pytest.raises(ValueError, match="is too small to transmit"):
+        negotiate_with(capabilities=build_capabilities(buffer_size=8), acknowledgment=None)
+
+    message = (
+        "Unable to negotiate the TransportLayer configuration. The Microcontroller did not acknowledge the selected "
+        "configuration."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        negotiate_with(
+            capabilities=build_capabilities(),
+            acknowledgment=np.array([255, 3, 1, 0, 0, 0, 0, 0], dtype=np.uint8),
+        )
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="The baudrate probing test requires a pseudo-terminal.")
+def test_baudrate_probing() -> None:
+    """Verifies that the TransportLayer class measures each candidate baudrate with echo probes and switches the serial
+    port to the fastest error-free baudrate.
+    """
+    controller, device = os.openpty()
+    peer = TransportLayer(port="COM8", microcontroller_serial_buffer_size=64, baudrate=115200, test_mode=True)
+    received: list[NDArray[np.uint8]] = []
+
+    # Compiles the emulated Microcontroller's methods before probing, as the probes use short timeouts.
+    peer.write_data(np.zeros(5, dtype=np.uint8))
+    peer.send_data()
+    peer._port.rx_buffer = peer._port.tx_buffer
+    peer._port.tx_buffer = b""
+    peer.receive_data()
+
+    def emulate_microcontroller(probe_count: int) -> None:
+        """Echoes the probes received while the serial port is set to at most 500000 baud. At higher baudrates,
+        drops, corrupts, or alters the echoed probes.
+        """
+        for _ in range(probe_count):
+            probe = exchange_peer_payload(peer, controller, None)
+            received.append(probe)
+            echo = probe.copy()
+            echo[1] = 5
+            sequence = int(probe[3])
+            if protocol._port.baudrate > 500000:
+                if sequence % 3 == 0:
+                    continue
+                if sequence % 3 == 2:
+                    echo[-1] ^= 1
+            peer.write_data(echo)
+            peer.send_data()
+            packet = peer._port.tx_buffer
+            peer._port.tx_buffer = b""
+            if protocol._port.baudrate > 500000 and sequence % 3 == 1:
+                packet = packet[:-2] + bytes([packet[-2] ^ 0x0F]) + packet[-1:]
+            os.write(controller, packet)
+
+    protocol = TransportLayer(port=os.ttyname(device), microcontroller_serial_buffer_size=64, baudrate=115200)
+    try:
+        peer_thread = Thread(target=emulate_microcontroller, args=(9,), daemon=True)
+        peer_thread.start()
+        report = protocol.probe_baudrate(
+            candidates=(115200, 1000000, 500000), probe_count=3, probe_size=16, timeout=500000
+        )
+        peer_thread.join(timeout=10)
+
+        # Each probe carries the handshake code, the echo request type, the protocol version, the sequence number, and
+        # the test pattern. The sequence numbers continue across the baudrates.
+        assert received[0].tolist() == [255, 4, 1, 0, 0, *range(11)]
+        assert [int(probe[3]) for probe in received] == list(range(9))
+
+        # The 1000000 baudrate loses one probe, corrupts one probe, and echoes one probe with different data, so the
+        # fastest error-free baudrate is 500000.
+        assert report.baudrate == 500000
+        assert [measurement.baudrate for measurement in report.measurements] == [115200, 1000000, 500000]
+        assert [measurement.error_count for measurement in report.measurements] == [0, 3, 0]
+        assert [measurement.error_rate for measurement in report.measurements] == [0.0, 1.0, 0.0]
+        assert report.measurements[0].throughput > 0
+        assert report.measurements[1].throughput == 0
+        assert protocol._port.baudrate == 500000
+
+        # If none of the baudrates is error-free, the original baudrate is restored. By default, the probes use the
+        # maximum payload size.
+        received.clear()
+        peer_thread = Thread(target=emulate_microcontroller, args=(3,), daemon=True)
+        peer_thread.start()
+        report = protocol.probe_baudrate(candidates=[1000000], probe_count=3, timeout=500000)
+        peer_thread.join(timeout=10)
+        assert report.baudrate is None
+        assert report.measurements[0].error_count == 3
+        assert received[0].size == protocol._max_tx_payload_size
+        assert protocol._port.baudrate == 500000
+    finally:
+        del protocol
+        os.close(controller)
+        os.close(device)
+
+
+def test_baudrate_probing_errors(protocol) -> None:
+    """Verifies the error handling of the TransportLayer class's baudrate probing."""
+    message = (
+        "Unable to probe the baudrate. Expected a non-empty iterable of positive integers for 'candidates' argument, "
+        "but encountered (115200, 0)."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.probe_baudrate(candidates=(115200, 0))
+
+    message = (
+        "Unable to probe the baudrate. Expected a positive integer value for 'probe_count' argument, but encountered 0 "
+        "of type int."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.probe_baudrate(candidates=(115200,), probe_count=0)
+
+    message = (
+        "Unable to probe the baudrate. Expected 0 or an integer value between 5 and 254 (the maximum payload size) for "
+        "'probe_size' argument, but encountered 4 of type int."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.probe_baudrate(candidates=(115200,), probe_size=4)
+
+    message = (
+        "Unable to probe the baudrate. Expected a positive integer value for 'timeout' argument, but encountered -1 of "
+        "type int."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.probe_baudrate(candidates=(115200,), timeout=-1)
+
+    # The mocked serial port does not echo the probes, so all probes are lost.
+    report = protocol.probe_baudrate(candidates=(115200,), probe_count=2, timeout=1000)
+    assert report.baudrate is None
+    assert report.measurements[0].error_count == 2
+
+
+def test_baudrate_probing_stale_responses(protocol) -> None:
+    """Verifies that the TransportLayer class does not count the stale responses received at the previous baudrate
+    against the probed baudrate.
+    """
+    peer = TransportLayer(port="COM8", microcontroller_serial_buffer_size=1024, baudrate=1000000, test_mode=True)
+    probe = np.array([255, 4, 1, 7, 0, 1, 2, 3], dtype=np.uint8)
+    echo = probe.copy()
+    echo[1] = 5
+
+    # Switching the baudrate discards the bytes received at the previous baudrate and resets the reception state.
+    protocol._port.feed(b"\x01\x02\x03")
+    protocol._rx.stream_size = 2
+    protocol._rx.read_saturated = True
+    protocol._set_baudrate(baudrate=500000, timeout=1000)
+    assert protocol._port.in_waiting == 0
+    assert protocol._rx.stream_size == 0
+    assert not protocol._rx.read_saturated
+    assert protocol._baudrate == 500000
+
+    # A corrupted packet, such as a late response to a probe sent at the previous baudrate, does not fail the probe
+    # if the uncorrupted response arrives within the timeout.
+    peer.write_data(echo)
+    peer.send_data()
+    packet = peer._port.tx_buffer
+    corrupted = packet[:-2] + bytes([packet[-2] ^ 0x0F]) + packet[-1:]
+    protocol._port.feed(corrupted + packet)
+    assert protocol._exchange_echo_probe(probe=probe, timeout=100000)
+
+    # A corrupted response without the uncorrupted one fails the probe once the timeout runs out.
+    protocol._port.feed(corrupted)
+    assert not protocol._exchange_echo_probe(probe=probe, timeout=1000)
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="The GIL-free reception engine requires a POSIX file descriptor.")
+def test_gil_free_reception() -> None:
+    """Verifies that the GIL-free reception engine receives, validates, and decodes packets from a real file descriptor.
+
+    Uses a pseudo-terminal pair to emulate the serial connection. The test writes to the 'controller' end of the pair,
+    and the tested instance reads from the 'device' end.
+    """
+    payload_prototype = np.zeros(shape=16, dtype=np.uint8)
+
+    # Uses a mocked instance to generate the byte-stream 'sent' by the Microcontroller.
+    peer = TransportLayer(port="COM8", microcontroller_serial_buffer_size=256, baudrate=1000000, test_mode=True)
+    for index in range(5):
+        peer.write_data(np.full_like(payload_prototype, fill_value=index))
+        peer.send_data()
+    stream = peer._port.tx_buffer
+
+    controller, device = os.openpty()
+    protocol = TransportLayer(
+        port=os.ttyname(device), microcontroller_serial_buffer_size=256, baudrate=1000000, gil_free_reception=True
+    )
+    try:
+        # Verifies that the engine returns False when there are no bytes to receive.
+        assert not protocol.receive_data()
+
+        # Sends the first packet in two chunks, with the second chunk arriving while the engine is waiting for the
+        # packet's bytes. Sends the remaining packets together with the second chunk to verify that the engine
+        # preserves the unconsumed stream bytes.
+        os.write(controller, stream[:10])
+        writer = Thread(target=lambda: (sleep(0.002), os.write(controller, stream[10:])))
+        writer.start()
+        received_values = []
+        while len(received_values) < 5:
+            if protocol.receive_data():
+                received_values.append(int(protocol.read_data(payload_prototype.copy())[0]))
+        writer.join()
+        assert received_values == list(range(5))
+
+        # Verifies that the engine raises the same error as the default reception path when the packet's bytes are
+        # not received in time.
+        os.write(controller, stream[:10])
+        message = (
+            f"Failed to parse the incoming serial packet data. The byte number {9} out of {19} was not received in "
+            f"time ({protocol._timeout} microseconds), following the reception of the previous byte. Packet "
+            f"reception staled."
+        )
+        with pytest.raises(RuntimeError, match=error_format(message)):
+            protocol.receive_data()
+    finally:
+        protocol._port.close()
+        os.close(controller)
+        os.close(device)
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="The reconnection test requires a pseudo-terminal.")
+@pytest.mark.parametrize("gil_free_reception", [False, True])
+@pytest.mark.parametrize("wait_strategy", [WaitStrategy.spin(), WaitStrategy.hybrid()])
+def test_reconnection(gil_free_reception: bool, wait_strategy: WaitStrategy, tmp_path) -> None:
+    """Verifies that the TransportLayer class detects the Microcontroller's disconnection and reopens the serial port
+    in place, preserving its state.
+
+    Closing the 'controller' end of a pseudo-terminal pair hangs up the 'device' end, which emulates unplugging the
+    Microcontroller's USB device. The disconnection has to be detected both by the default (spin) wait strategy, which
+    never sleeps in poll(), and by the strategy with the sleep phase.
+    """
+    # Uses a mocked instance to generate the packet 'sent' by the Microcontroller.
+    peer = TransportLayer(port="COM8", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True)
+    payload = np.arange(10, dtype=np.uint8)
+    peer.write_data(payload)
+    peer.send_data()
+    packet = peer._port.tx_buffer
+
+    controller, device = os.openpty()
+    protocol = TransportLayer(
+        port=os.ttyname(device),
+        microcontroller_serial_buffer_size=64,
+        baudrate=1000000,
+        gil_free_reception=gil_free_reception,
+        wait_strategy=wait_strategy,
+    )
+    assert protocol.connected
+    assert protocol.reconnections == 0
+    os.write(controller, packet)
+    assert protocol.receive_data(timeout=1000000)
+
+    # Verifies that the disconnection is detected and reported.
+    os.close(controller)
+    with pytest.raises(ConnectionError, match="was disconnected"):
+        protocol.receive_data(timeout=1000000)
+    assert not protocol.connected
+    os.close(device)
+
+    # Verifies that the port is reopened in place, preserving the instance's statistics.
+    controller, device = os.openpty()
+    assert protocol.reconnect(port=os.ttyname(device))
+    assert protocol.connected
+    assert protocol.reconnections == 1
+    assert protocol.received_packets == 1
+    os.write(controller, packet)
+    assert protocol.receive_data(timeout=1000000)
+    assert protocol.received_packets == 2
+    protocol.write_data(payload)
+    protocol.send_data()
+    assert os.read(controller, 1024) == packet
+
+    # Verifies the automatic reconnection. The instance reopens the port by its name, so the test connects it through
+    # a symbolic link that is redirected to a new pseudo-terminal while the instance is disconnected.
+    link = tmp_path / "serial"
+    link.symlink_to(os.ttyname(device))
+    assert protocol.reconnect(port=str(link))
+    protocol.set_reconnection_policy(timeout=1000000, initial_backoff=1000, maximum_backoff=10000)
+    os.close(controller)
+    os.close(device)
+    controller, device = os.openpty()
+    link.unlink()
+    link.symlink_to(os.ttyname(device))
+    assert not protocol.receive_data(timeout=1000000)
+    assert protocol.connected
+    assert protocol.reconnections == 3
+    os.write(controller, packet)
+    assert protocol.receive_data(timeout=1000000)
+
+    # Verifies that the automatic reconnection reports the disconnection if it fails to reopen the port within the
+    # timeout.
+    protocol.set_reconnection_policy(timeout=50000, initial_backoff=1000, maximum_backoff=10000)
+    os.close(controller)
+    os.close(device)
+    link.unlink()
+    message = "was not reconnected within 50000 microseconds"
+    start = perf_counter()
+    with pytest.raises(ConnectionError, match=message):
+        protocol.receive_data(timeout=1000000)
+    assert perf_counter() - start >= 0.05
+    assert not protocol.connected
+    protocol._port.close()
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="The end-of-stream test requires a pseudo-terminal.")
+def test_end_of_stream_disconnection() -> None:
+    """Verifies that the TransportLayer class treats a serial port read that returns the end of the stream as the
+    Microcontroller's disconnection, but not a read that finds no new bytes.
+
+    Closing the 'controller' end of a pseudo-terminal pair makes the reads of the 'device' end return no bytes, the
+    same as the reads of an unplugged USB serial device.
+    """
+    controller, device = os.openpty()
+    protocol = TransportLayer(port=os.ttyname(device), microcontroller_serial_buffer_size=64, baudrate=1000000)
+
+    # Forces each reception to read the port without querying the number of available bytes first. The port does not
+    # have any bytes to read.
+    protocol._rx.read_saturated = True
+    assert not protocol.receive_data(timeout=2000)
+    assert protocol.connected
+
+    os.close(controller)
+    protocol._rx.read_saturated = True
+    with pytest.raises(ConnectionError, match="was disconnected"):
+        protocol.receive_data(timeout=1000000)
+    assert not protocol.connected
+
+    protocol._port.close()
+    os.close(device)
+
+
+def test_reconnection_state(protocol) -> None:
+    """Verifies that reopening the serial port discards the connection-specific state and preserves the rest of the
+    TransportLayer's state.
+    """
+    payload = np.arange(10, dtype=np.uint8)
+    tl = TransportLayer(
+        port="COM8", microcontroller_serial_buffer_size=64, baudrate=1000000, test_mode=True, delta_keyframe_interval=8
+    )
+    for _ in range(2):
+        tl.write_data(payload)
+        tl.send_data()
+    assert tl._tx.delta_frame_count == 2
+
+    # Emulates the bytes of a partially received packet left over from the previous connection.
+    tl._rx.stream_size = 5
+
+    # The mocked port is reopened without locating the Microcontroller's port.
+    assert tl.reconnect()
+    assert tl.reconnections == 1
+    assert tl.connected
+    assert tl.transmitted_packets == 2
+
+    # After the reconnection, the stream bytes of the previous connection are discarded, and the next payload is sent
+    # as a keyframe.
+    assert not tl.receive_data()
+    assert tl._rx.stream_size == 0
+    tl.write_data(payload)
+    tl.send_data()
+    assert tl._tx.delta_frame_count == 1
+
+    # Verifies that the port is not replaced while another thread uses either path.
+    for lock in (tl._rx.lock, tl._tx.lock):
+        reconnections = tl.reconnections
+        with lock:
+            reconnection = Thread(target=tl.reconnect)
+            reconnection.start()
+            reconnection.join(timeout=0.05)
+            assert reconnection.is_alive()
+            assert tl.reconnections == reconnections
+        reconnection.join()
+        assert tl.reconnections == reconnections + 1
+
+    message = (
+        "Unable to set the reconnection policy. Expected a non-negative integer value for 'timeout' argument, but "
+        "encountered -1 of type int."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.set_reconnection_policy(timeout=-1)
+
+    message = (
+        "Unable to set the reconnection policy. Expected a positive integer value for 'initial_backoff' argument, but "
+        "encountered 0 of type int."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.set_reconnection_policy(timeout=0, initial_backoff=0)
+
+    message = (
+        "Unable to set the reconnection policy. Expected an integer value of at least 1000 (the initial backoff) for "
+        "'maximum_backoff' argument, but encountered 100 of type int."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        protocol.set_reconnection_policy(timeout=0, initial_backoff=1000, maximum_backoff=100)
+
+
+def build_sysfs_tree(root) -> None:
+    """Builds the sysfs directory tree of a host with two USB CDC-ACM devices, a USB-serial converter, a PNP serial
+    port, a placeholder platform serial port, and a virtual terminal.
+
+    The tree reproduces the relative links used by sysfs.
+    """
+
+    def link(path, target) -> None:
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.symlink_to(os.path.relpath(target, path.parent))
+
+    def add_port(name: str, device, subsystem: str | None) -> None:
+        tty = device / "tty" / name
+        tty.mkdir(parents=True)
+        link(root / "class" / "tty" / name, tty)
+        if subsystem is not None:
+            link(tty / "device", device)
+            link(device / "subsystem", root / "bus" / subsystem)
+
+    def add_usb_device(path, attributes: dict[str, str]) -> None:
+        path.mkdir(parents=True)
+        for name, value in attributes.items():
+            (path / name).write_text(f"{value}\n")
+
+    usb = root / "devices" / "usb1"
+    add_usb_device(
+        usb / "1-1",
+        {
+            "idVendor": "2341",
+            "idProduct": "003e",
+            "serial": "SN1",
+            "manufacturer": "Arduino (www.arduino.cc)",
+            "product": "Arduino Due",
+            "bNumInterfaces": " 2",
+        },
+    )
+    add_port("ttyACM0", usb / "1-1" / "1-1:1.0", "usb")
+    add_usb_device(usb / "1-3", {"idVendor": "2341", "idProduct": "003e", "serial": "SN3", "bNumInterfaces": " 1"})
+    add_port("ttyACM1", usb / "1-3" / "1-3:1.0", "usb")
+    add_usb_device(
+        usb / "1-2",
+        {"idVendor": "0403", "idProduct": "6001", "serial": "SN2", "manufacturer": "FTDI", "bNumInterfaces": " 1"},
+    )
+    add_port("ttyUSB0", usb / "1-2" / "1-2:1.0" / "ttyUSB0", "usb-serial")
+    add_port("ttyS0", root / "devices" / "pnp0" / "00:01", "pnp")
+    (root / "devices" / "pnp0" / "00:01" / "id").write_text("PNP0501\n")
+    add_port("ttyS1", root / "devices" / "platform" / "serial8250", "platform")
+    add_port("tty0", root / "devices" / "virtual", None)
+
+
+@pytest.mark.skipif(sys.platform != "linux", reason="The sysfs port discovery is only used on Linux.")
+def test_port_discovery(tmp_path, monkeypatch) -> None:
+    """Verifies the sysfs-based serial port discovery, filtering, and caching."""
+    build_sysfs_tree(tmp_path)
+    (tmp_path / "kernel").mkdir()
+    (tmp_path / "kernel" / "uevent_seqnum").write_text("5\n")
+    monkeypatch.setattr("ataraxis_transport_layer_pc.transport_layer._SYSFS_TTY_ROOT", str(tmp_path / "class" / "tty"))
+    monkeypatch.setattr("ataraxis_transport_layer_pc.transport_layer._SYSFS_KERNEL_ROOT", str(tmp_path / "kernel"))
+
+    # Verifies that the discovery skips the virtual terminals and the placeholder ports and reports the same
+    # information as the pySerial's enumeration.
+    ports = list_available_ports()
+    assert [info.device for info in ports] == ["/dev/ttyACM0", "/dev/ttyACM1", "/dev/ttyS0", "/dev/ttyUSB0"]
+    arduino = ports[0]
+    assert (arduino.vid, arduino.pid, arduino.serial_number) == (0x2341, 0x3E, "SN1")
+    assert arduino.manufacturer == "Arduino (www.arduino.cc)"
+    assert (arduino.product, arduino.location) == ("Arduino Due", "1-1:1.0")
+    assert arduino.description == "Arduino Due"
+    assert arduino.hwid == "USB VID:PID=2341:003E SER=SN1 LOCATION=1-1:1.0"
+    assert ports[1].location == "1-3"
+    assert (ports[2].description, ports[2].hwid, ports[2].vid) == ("ttyS0", "PNP0501", None)
+    assert (ports[3].vid, ports[3].pid, ports[3].location) == (0x0403, 0x6001, "1-2")
+
+    # Verifies the filters. Non-USB ports never match the filters.
+    assert [info.device for info in list_available_ports(vid=0x2341)] == ["/dev/ttyACM0", "/dev/ttyACM1"]
+    assert [info.device for info in list_available_ports(vid=0x2341, pid=0x3E, serial_number="SN3")] == [
+        "/dev/ttyACM1"
+    ]
+    assert [info.device for info in list_available_ports(manufacturer="ftdi")] == ["/dev/ttyUSB0"]
+    assert list_available_ports(vid=0x0403, pid=0x3E) == ()
+
+    # Verifies that the serial number of the opened port's device is read from the port's sysfs entry without
+    # enumerating the ports.
+    def fail_scan(*args: Any) -> None:
+        raise AssertionError
+
+    with monkeypatch.context() as patch:
+        patch.setattr("ataraxis_transport_layer_pc.transport_layer._scan_sysfs_ports", fail_scan)
+        assert _find_serial_number("/dev/ttyACM0") == "SN1"
+        assert _find_serial_number("/dev/ttyUSB0") == "SN2"
+        assert _find_serial_number("/dev/ttyS0") is None
+        assert _find_serial_number("/dev/tty0") is None
+        assert _find_serial_number("/dev/ttyACM7") is None
+
+    # Verifies that the cached ports are reused until the kernel emits a new device event.
+    assert len(list_available_ports(use_cache=True)) == 4
+    (tmp_path / "class" / "tty" / "ttyUSB0").unlink()
+    assert len(list_available_ports(use_cache=True)) == 4
+    assert [info.device for info in list_available_ports(manufacturer="FTDI", use_cache=True)] == ["/dev/ttyUSB0"]
+    (tmp_path / "kernel" / "uevent_seqnum").write_text("6\n")
+    assert len(list_available_ports(use_cache=True)) == 3
+    assert list_available_ports(manufacturer="FTDI", use_cache=True) == ()
+
+    # Verifies that the port of a specific device is located by its USB attributes.
+    assert find_port(serial_number="SN1") == "/dev/ttyACM0"
+    assert find_port(vid=0x2341, serial_number="SN3", use_cache=True) == "/dev/ttyACM1"
+    assert find_port(serial_number="SN4") is None
+
+    message = (
+        "Unable to find the serial port. Provide at least one of the 'vid', 'pid', 'serial_number', or 'manufacturer' "
+        "arguments to identify the device."
+    )
+    with pytest.raises(ValueError, match=error_format(message)):
+        find_port()
+
+    message = (
+        "Unable to find the serial port. Expected a single port to match the provided filters, but found 2 matching "
+        "ports: /dev/ttyACM0, /dev/ttyACM1. Use additional filters, such as the serial number, to identify the device."
+    )
+    with pytest.raises(RuntimeError, match=error_format(message)):
+        find_port(vid=0x2341)